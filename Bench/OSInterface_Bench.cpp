@@ -0,0 +1,607 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "OSInterface_Bench.h"
+#include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_CountingSemaphore.h"
+#include "OSInterface_EventGroup.h"
+#include "OSInterface_Mutex.h"
+#include "OSInterface_Timer.h"
+#include "OSInterface_UntypedQueue.h"
+
+/**
+ * @brief Start a worker once the gate opens, and tell the gate when it returns
+ *
+ * @note Worker must have a `OSInterface_Bench::Gate* gate` member and a `void run()` method.
+ */
+template <typename Worker> static void workerEntry(void* arg)
+{
+    auto*                    worker = static_cast<Worker*>(arg);
+    OSInterface_Bench::Gate* gate   = worker->gate;
+    gate->start->waitBits(OSInterface_Bench::Gate::START_BIT, OSInterface_EventGroup::WAIT_ALL, false, UINT32_MAX);
+    worker->run();
+    gate->done->signal();
+}
+
+/**
+ * @return double The value below which percent % of the sorted samples fall (nearest rank)
+ */
+static double percentile(const std::vector<double>& sorted, const double percent)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    const auto rank = static_cast<size_t>(std::ceil(percent / 100 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+OSInterface_Bench::OSInterface_Bench(OSInterface& os, const Format format, FILE* out) :
+    os(os), format(format), out(out)
+{
+    gate.start = os.osCreateEventGroup();
+    gate.done  = os.osCreateCountingSemaphore(UINT32_MAX, 0);
+}
+
+OSInterface_Bench::~OSInterface_Bench()
+{
+    // The last worker may still be returning from done->signal()
+    os.osSleep(10);
+    delete gate.start;
+    delete gate.done;
+}
+
+void OSInterface_Bench::setQuick(const bool quick)
+{
+    this->quick = quick;
+}
+
+void OSInterface_Bench::addFilter(const char* filter)
+{
+    filters.push_back(filter);
+}
+
+uint32_t OSInterface_Bench::runAll()
+{
+    if (gate.start == nullptr || gate.done == nullptr)
+    {
+        fprintf(stderr, "OSInterface_Bench: could not create the worker gate\n");
+        return 1;
+    }
+    failures = 0;
+    benchMutexUncontended();
+    benchMutexContended();
+    benchSemaphorePingPong();
+    benchQueueThroughput();
+    benchTimerJitter();
+    benchMallocFree();
+    benchProcessSpawn();
+    fflush(out);
+    return failures;
+}
+
+bool OSInterface_Bench::selected(const char* name) const
+{
+    return filters.empty() || std::any_of(filters.begin(), filters.end(),
+                                          [name](const char* filter) { return strstr(name, filter) != nullptr; });
+}
+
+uint32_t OSInterface_Bench::iterations(const uint32_t full) const
+{
+    return quick ? std::max<uint32_t>(full / 10, 1) : full;
+}
+
+double OSInterface_Bench::toNanos(const uint64_t ticks) const
+{
+    return static_cast<double>(ticks) * 1e9 / static_cast<double>(os.osTicksPerSecond());
+}
+
+/**
+ * @brief Start one thread per worker and release them all at once
+ *
+ * @return uint64_t Ticks when the workers were released
+ */
+template <typename Worker> uint64_t OSInterface_Bench::startWorkers(std::vector<Worker>& workers)
+{
+    gate.start->clearBits(Gate::START_BIT);
+    for (Worker& worker : workers)
+    {
+        worker.gate = &gate;
+        os.osRunProcess(workerEntry<Worker>, "OSInterface_Bench", &worker);
+    }
+    const uint64_t start = os.osTicks();
+    gate.start->setBits(Gate::START_BIT);
+    return start;
+}
+
+void OSInterface_Bench::joinWorkers(const size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        gate.done->wait(UINT32_MAX);
+    }
+}
+
+/**
+ * @brief Run the workers to completion
+ *
+ * @return uint64_t Ticks from the release of the workers to the return of the last one
+ */
+template <typename Worker> uint64_t OSInterface_Bench::runWorkers(std::vector<Worker>& workers)
+{
+    const uint64_t start = startWorkers(workers);
+    joinWorkers(workers.size());
+    return os.osTicks() - start;
+}
+
+void OSInterface_Bench::report(const char* name, const char* parameters, std::vector<double>& samples_ns,
+                               const uint64_t operations, const uint64_t elapsed_ticks)
+{
+    std::sort(samples_ns.begin(), samples_ns.end());
+    const double seconds = toNanos(elapsed_ticks) / 1e9;
+    const double rate    = seconds > 0 ? static_cast<double>(operations) / seconds : 0;
+    if (format == CSV)
+    {
+        if (!headerWritten)
+        {
+            fprintf(out, "benchmark,parameters,samples,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,ops_per_second\n");
+        }
+        fprintf(out, "%s,%s,%zu,%.1f,%.1f,%.1f,%.1f,%.1f,%.0f\n", name, parameters, samples_ns.size(),
+                percentile(samples_ns, 50), percentile(samples_ns, 90), percentile(samples_ns, 99),
+                percentile(samples_ns, 99.9), percentile(samples_ns, 100), rate);
+    }
+    else
+    {
+        if (!headerWritten)
+        {
+            fprintf(out, "%-22s %-44s %8s %10s %10s %10s %10s %10s %12s\n", "benchmark", "parameters", "samples",
+                    "p50_ns", "p90_ns", "p99_ns", "p99.9_ns", "max_ns", "ops/s");
+        }
+        fprintf(out, "%-22s %-44s %8zu %10.1f %10.1f %10.1f %10.1f %10.1f %12.0f\n", name, parameters,
+                samples_ns.size(), percentile(samples_ns, 50), percentile(samples_ns, 90), percentile(samples_ns, 99),
+                percentile(samples_ns, 99.9), percentile(samples_ns, 100), rate);
+    }
+    headerWritten = true;
+    fflush(out);
+}
+
+void OSInterface_Bench::failed(const char* name, const char* parameters)
+{
+    fprintf(stderr, "OSInterface_Bench: %s (%s) skipped, an object could not be created\n", name, parameters);
+    failures++;
+}
+
+void OSInterface_Bench::benchMutexUncontended()
+{
+    static const char* NAME = "mutex_uncontended";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    for (const OSInterface_Mutex::Mode mode : {OSInterface_Mutex::BLOCKING, OSInterface_Mutex::ADAPTIVE})
+    {
+        const char*        parameters = mode == OSInterface_Mutex::BLOCKING ? "mode=blocking" : "mode=adaptive";
+        OSInterface_Mutex* mutex      = os.osCreateMutex(mode);
+        if (mutex == nullptr)
+        {
+            failed(NAME, parameters);
+            continue;
+        }
+        const uint32_t      batches = iterations(1000000) / BATCH_SIZE;
+        std::vector<double> samples;
+        samples.reserve(batches);
+        const uint64_t start = os.osTicks();
+        for (uint32_t i = 0; i < batches; i++)
+        {
+            const uint64_t batchStart = os.osTicks();
+            for (uint32_t j = 0; j < BATCH_SIZE; j++)
+            {
+                mutex->wait(UINT32_MAX);
+                mutex->signal();
+            }
+            samples.push_back(toNanos(os.osTicks() - batchStart) / BATCH_SIZE);
+        }
+        const uint64_t elapsed = os.osTicks() - start;
+        delete mutex;
+        report(NAME, parameters, samples, static_cast<uint64_t>(batches) * BATCH_SIZE, elapsed);
+    }
+}
+
+struct MutexWorker
+{
+    OSInterface_Bench::Gate* gate;
+    OSInterface*             os;
+    OSInterface_Mutex*       mutex;
+    uint64_t*                counter;
+    uint32_t                 iterations;
+    std::vector<uint64_t>    waits_ticks; // Time to acquire the mutex
+
+    void run()
+    {
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            const uint64_t start = os->osTicks();
+            mutex->wait(UINT32_MAX);
+            waits_ticks.push_back(os->osTicks() - start);
+            (*counter)++;
+            mutex->signal();
+        }
+    }
+};
+
+void OSInterface_Bench::benchMutexContended()
+{
+    static const char* NAME = "mutex_contended";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    for (const OSInterface_Mutex::Mode mode : {OSInterface_Mutex::BLOCKING, OSInterface_Mutex::ADAPTIVE})
+    {
+        for (const uint32_t threads : {2U, 4U, 8U})
+        {
+            char parameters[64];
+            snprintf(parameters, sizeof(parameters), "mode=%s threads=%u",
+                     mode == OSInterface_Mutex::BLOCKING ? "blocking" : "adaptive", threads);
+            OSInterface_Mutex* mutex = os.osCreateMutex(mode);
+            if (mutex == nullptr)
+            {
+                failed(NAME, parameters);
+                continue;
+            }
+            uint64_t                 counter = 0;
+            std::vector<MutexWorker> workers(threads);
+            for (MutexWorker& worker : workers)
+            {
+                worker.os         = &os;
+                worker.mutex      = mutex;
+                worker.counter    = &counter;
+                worker.iterations = iterations(400000) / threads;
+                worker.waits_ticks.reserve(worker.iterations);
+            }
+            const uint64_t elapsed = runWorkers(workers);
+            delete mutex;
+
+            std::vector<double> samples;
+            samples.reserve(counter);
+            for (const MutexWorker& worker : workers)
+            {
+                for (const uint64_t wait : worker.waits_ticks)
+                {
+                    samples.push_back(toNanos(wait));
+                }
+            }
+            report(NAME, parameters, samples, counter, elapsed);
+        }
+    }
+}
+
+struct PongWorker
+{
+    OSInterface_Bench::Gate*     gate;
+    OSInterface_BinarySemaphore* ping;
+    OSInterface_BinarySemaphore* pong;
+    uint32_t                     iterations;
+
+    void run()
+    {
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            ping->wait(UINT32_MAX);
+            pong->signal();
+        }
+    }
+};
+
+void OSInterface_Bench::benchSemaphorePingPong()
+{
+    static const char* NAME       = "semaphore_pingpong";
+    static const char* PARAMETERS = "threads=2";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    OSInterface_BinarySemaphore* ping = os.osCreateBinarySemaphore();
+    OSInterface_BinarySemaphore* pong = os.osCreateBinarySemaphore();
+    if (ping == nullptr || pong == nullptr)
+    {
+        delete ping;
+        delete pong;
+        failed(NAME, PARAMETERS);
+        return;
+    }
+    std::vector<PongWorker> workers(1);
+    workers[0].ping       = ping;
+    workers[0].pong       = pong;
+    workers[0].iterations = iterations(20000);
+
+    std::vector<double> samples;
+    samples.reserve(workers[0].iterations);
+    const uint64_t start = startWorkers(workers);
+    for (uint32_t i = 0; i < workers[0].iterations; i++)
+    {
+        const uint64_t roundTripStart = os.osTicks();
+        ping->signal();
+        pong->wait(UINT32_MAX);
+        samples.push_back(toNanos(os.osTicks() - roundTripStart));
+    }
+    const uint64_t elapsed = os.osTicks() - start;
+    joinWorkers(workers.size());
+    delete ping;
+    delete pong;
+    report(NAME, PARAMETERS, samples, workers[0].iterations, elapsed);
+}
+
+struct QueueWorker
+{
+    OSInterface_Bench::Gate*  gate;
+    OSInterface*              os;
+    OSInterface_UntypedQueue* queue;
+    bool                      producer;
+    uint32_t                  messages;
+    uint32_t                  messageSize;
+    std::vector<uint64_t>     batches_ticks; // Consumers only, time to receive BATCH_SIZE messages
+
+    void run()
+    {
+        std::vector<uint8_t> message(messageSize);
+        if (producer)
+        {
+            for (uint32_t i = 0; i < messages; i++)
+            {
+                queue->sendToBack(message.data(), UINT32_MAX);
+            }
+            return;
+        }
+        uint64_t batchStart = os->osTicks();
+        for (uint32_t i = 1; i <= messages; i++)
+        {
+            queue->receive(message.data(), UINT32_MAX);
+            if (i % OSInterface_Bench::BATCH_SIZE == 0)
+            {
+                const uint64_t now = os->osTicks();
+                batches_ticks.push_back(now - batchStart);
+                batchStart = now;
+            }
+        }
+    }
+};
+
+void OSInterface_Bench::benchQueueThroughput()
+{
+    static const char* NAME = "queue_throughput";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    struct Pattern
+    {
+        const char*                             name;
+        bool                                    specified;
+        OSInterface_UntypedQueue::AccessPattern accessPattern;
+    };
+    static constexpr Pattern PATTERNS[] = {
+        {"default", false, OSInterface_UntypedQueue::MULTI_PRODUCER_MULTI_CONSUMER},
+        {"mpmc", true, OSInterface_UntypedQueue::MULTI_PRODUCER_MULTI_CONSUMER},
+        {"spsc", true, OSInterface_UntypedQueue::SINGLE_PRODUCER_SINGLE_CONSUMER},
+    };
+    static constexpr uint32_t QUEUE_LENGTH = 256;
+    const uint32_t            total        = iterations(240000); // Divisible by every thread count below
+
+    for (const uint32_t messageSize : {8U, 64U, 512U})
+    {
+        for (const uint32_t threads : {1U, 2U, 4U})
+        {
+            for (const Pattern& pattern : PATTERNS)
+            {
+                if (pattern.accessPattern == OSInterface_UntypedQueue::SINGLE_PRODUCER_SINGLE_CONSUMER && threads != 1)
+                {
+                    continue;
+                }
+                char parameters[64];
+                snprintf(parameters, sizeof(parameters), "queue=%s size=%u producers=%u consumers=%u", pattern.name,
+                         messageSize, threads, threads);
+                OSInterface_UntypedQueue* queue =
+                    pattern.specified ? os.osCreateUntypedQueue(QUEUE_LENGTH, messageSize, pattern.accessPattern)
+                                      : os.osCreateUntypedQueue(QUEUE_LENGTH, messageSize);
+                if (queue == nullptr)
+                {
+                    failed(NAME, parameters);
+                    continue;
+                }
+                std::vector<QueueWorker> workers(2 * threads);
+                for (uint32_t i = 0; i < workers.size(); i++)
+                {
+                    workers[i].os          = &os;
+                    workers[i].queue       = queue;
+                    workers[i].producer    = i < threads;
+                    workers[i].messages    = total / threads;
+                    workers[i].messageSize = messageSize;
+                    workers[i].batches_ticks.reserve(total / threads / BATCH_SIZE);
+                }
+                const uint64_t elapsed = runWorkers(workers);
+                delete queue;
+
+                std::vector<double> samples;
+                for (const QueueWorker& worker : workers)
+                {
+                    for (const uint64_t batch : worker.batches_ticks)
+                    {
+                        samples.push_back(toNanos(batch) / BATCH_SIZE);
+                    }
+                }
+                report(NAME, parameters, samples, total, elapsed);
+            }
+        }
+    }
+}
+
+struct TimerState
+{
+    OSInterface*                 os;
+    OSInterface_BinarySemaphore* finished;
+    std::vector<uint64_t>        expiries_ticks;
+    uint32_t                     expiries;
+};
+
+static void timerCallback(void* arg)
+{
+    auto* state = static_cast<TimerState*>(arg);
+    if (state->expiries_ticks.size() < state->expiries)
+    {
+        state->expiries_ticks.push_back(state->os->osTicks());
+        if (state->expiries_ticks.size() == state->expiries)
+        {
+            state->finished->signal();
+        }
+    }
+}
+
+void OSInterface_Bench::benchTimerJitter()
+{
+    static const char* NAME = "timer_jitter";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    for (const uint32_t period_ms : {1U, 10U})
+    {
+        char parameters[64];
+        snprintf(parameters, sizeof(parameters), "period_ms=%u", period_ms);
+        TimerState state{&os, os.osCreateBinarySemaphore(), {}, iterations(period_ms == 1 ? 1000 : 200)};
+        state.expiries_ticks.reserve(state.expiries);
+        OSInterface_Timer* timer = nullptr;
+        if (state.finished != nullptr)
+        {
+            timer = os.osCreateTimer(period_ms, OSInterface_Timer::PERIODIC, timerCallback, &state,
+                                     "OSInterface_Bench");
+        }
+        if (timer == nullptr)
+        {
+            delete state.finished;
+            failed(NAME, parameters);
+            continue;
+        }
+        const uint64_t start = os.osTicks();
+        timer->start();
+        state.finished->wait(UINT32_MAX);
+        const uint64_t elapsed = os.osTicks() - start;
+        timer->stop();
+        delete timer;
+        delete state.finished;
+
+        // Deviation of each interval from the period, early or late
+        const double        period_ns = period_ms * 1e6;
+        std::vector<double> samples;
+        samples.reserve(state.expiries);
+        uint64_t previous = start;
+        for (const uint64_t expiry : state.expiries_ticks)
+        {
+            samples.push_back(std::abs(toNanos(expiry - previous) - period_ns));
+            previous = expiry;
+        }
+        report(NAME, parameters, samples, state.expiries, elapsed);
+    }
+}
+
+struct AllocationWorker
+{
+    OSInterface_Bench::Gate* gate;
+    OSInterface*             os;
+    uint32_t                 size;
+    uint32_t                 batches;
+    std::vector<uint64_t>    batches_ticks; // Time to allocate then free BATCH_SIZE blocks
+
+    void run()
+    {
+        void* blocks[OSInterface_Bench::BATCH_SIZE];
+        for (uint32_t i = 0; i < batches; i++)
+        {
+            const uint64_t start = os->osTicks();
+            for (void*& block : blocks)
+            {
+                block = os->osMalloc(size);
+            }
+            for (void* block : blocks)
+            {
+                os->osFree(block);
+            }
+            batches_ticks.push_back(os->osTicks() - start);
+        }
+    }
+};
+
+void OSInterface_Bench::benchMallocFree()
+{
+    static const char* NAME = "malloc_free";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    for (const uint32_t size : {16U, 256U, 4096U})
+    {
+        for (const uint32_t threads : {1U, 4U})
+        {
+            char parameters[64];
+            snprintf(parameters, sizeof(parameters), "size=%u threads=%u", size, threads);
+            std::vector<AllocationWorker> workers(threads);
+            for (AllocationWorker& worker : workers)
+            {
+                worker.os      = &os;
+                worker.size    = size;
+                worker.batches = iterations(500000) / BATCH_SIZE / threads;
+                worker.batches_ticks.reserve(worker.batches);
+            }
+            const uint64_t elapsed = runWorkers(workers);
+
+            std::vector<double> samples;
+            uint64_t            operations = 0;
+            for (const AllocationWorker& worker : workers)
+            {
+                for (const uint64_t batch : worker.batches_ticks)
+                {
+                    samples.push_back(toNanos(batch) / (2 * BATCH_SIZE));
+                }
+                operations += 2 * static_cast<uint64_t>(worker.batches) * BATCH_SIZE;
+            }
+            report(NAME, parameters, samples, operations, elapsed);
+        }
+    }
+}
+
+struct SpawnState
+{
+    OSInterface*                   os;
+    OSInterface_CountingSemaphore* started;
+    uint64_t                       start_ticks;
+};
+
+static void spawnedProcess(void* arg)
+{
+    auto* state        = static_cast<SpawnState*>(arg);
+    state->start_ticks = state->os->osTicks();
+    state->started->signal();
+}
+
+void OSInterface_Bench::benchProcessSpawn()
+{
+    static const char* NAME       = "process_spawn";
+    static const char* PARAMETERS = "sequential";
+    if (!selected(NAME))
+    {
+        return;
+    }
+    const uint32_t      spawns = iterations(500);
+    std::vector<double> samples;
+    samples.reserve(spawns);
+    SpawnState     state{&os, gate.done, 0};
+    const uint64_t start = os.osTicks();
+    for (uint32_t i = 0; i < spawns; i++)
+    {
+        const uint64_t spawnStart = os.osTicks();
+        os.osRunProcess(spawnedProcess, "OSInterface_Bench", &state);
+        gate.done->wait(UINT32_MAX);
+        samples.push_back(toNanos(state.start_ticks - spawnStart));
+    }
+    report(NAME, PARAMETERS, samples, spawns, os.osTicks() - start);
+}
@@ -0,0 +1,115 @@
+#ifndef OSINTERFACE_OSINTERFACE_BENCH_H
+#define OSINTERFACE_OSINTERFACE_BENCH_H
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "OSInterface.h"
+#include "OSInterface_Static.h"
+
+/**
+ * @brief Standard benchmarks of the primitives of an OSInterface implementation
+ *
+ * The suite only goes through the OSInterface API, so any backend can be measured by handing it to the suite, and
+ * worker threads are started with osRunProcess(). Durations are measured with osTicks(). Each benchmark reports the
+ * percentiles of its samples in nanoseconds and its throughput in operations per second. Operations too short to be
+ * timed one by one are timed in batches, a sample is then the mean duration of the operations of a batch.
+ */
+class OSInterface_Bench
+{
+public:
+    using Format = enum { TEXT, CSV };
+
+    static constexpr uint32_t BATCH_SIZE = 64; // Operations timed together when one is too short to time alone
+
+    /**
+     * @brief Create the suite
+     *
+     * @param os Implementation to measure
+     * @param format Format of the results, CSV has one header line and one line per result
+     * @param out Destination of the results
+     */
+    OSInterface_Bench(OSInterface& os, Format format, FILE* out);
+
+    OSInterface_Bench(const OSInterface_Bench&)            = delete;
+    OSInterface_Bench& operator=(const OSInterface_Bench&) = delete;
+    OSInterface_Bench(OSInterface_Bench&&)                 = delete;
+    OSInterface_Bench& operator=(OSInterface_Bench&&)      = delete;
+
+    ~OSInterface_Bench();
+
+    /**
+     * @brief Run about a tenth of the iterations, for a quick check rather than stable numbers
+     */
+    void setQuick(bool quick);
+
+    /**
+     * @brief Only run the benchmarks whose name contains one of the filters
+     *
+     * @param filter Part of a benchmark name, such as "mutex" or "queue_throughput"
+     */
+    void addFilter(const char* filter);
+
+    /**
+     * @brief Run every selected benchmark and write its results
+     *
+     * @return The number of benchmarks that could not run because an object could not be created
+     */
+    uint32_t runAll();
+
+    void benchMutexUncontended();
+    void benchMutexContended();
+    void benchSemaphorePingPong();
+    void benchQueueThroughput();
+    void benchTimerJitter();
+    void benchMallocFree();
+    void benchProcessSpawn();
+
+    /**
+     * @brief Measure the cost of virtual dispatch, by timing the same uncontended mutex, semaphore and queue operations
+     * called through the OSInterface API and directly on the classes of the backend
+     *
+     * @note Defined in OSInterface_BenchDispatch.h. Not run by runAll(), which only knows the OSInterface API.
+     * @param backend The implementation given at construction
+     * @return The number of benchmarks that could not run because an object could not be created
+     */
+    template <OSInterfaceStaticBackend Backend> uint32_t benchDispatch(Backend& backend);
+
+    /**
+     * @brief Gate shared by the worker threads of a benchmark
+     */
+    struct Gate
+    {
+        OSInterface_EventGroup*        start{nullptr}; // START_BIT releases the workers
+        OSInterface_CountingSemaphore* done{nullptr};  // Signaled by each worker when it returns
+
+        static constexpr uint32_t START_BIT = 1;
+    };
+
+private:
+    [[nodiscard]] bool     selected(const char* name) const;
+    [[nodiscard]] uint32_t iterations(uint32_t full) const;
+    [[nodiscard]] double   toNanos(uint64_t ticks) const;
+
+    template <typename Worker> uint64_t startWorkers(std::vector<Worker>& workers);
+    template <typename Worker> uint64_t runWorkers(std::vector<Worker>& workers);
+    void                                joinWorkers(size_t count);
+
+    template <OSInterfaceBackend Backend> void benchDispatchCalls(Backend& backend, const char* parameters);
+    template <typename Operation> void timeBatches(const char* name, const char* parameters, Operation operation);
+
+    void report(const char* name, const char* parameters, std::vector<double>& samples_ns, uint64_t operations,
+                uint64_t elapsed_ticks);
+    void failed(const char* name, const char* parameters);
+
+    OSInterface&             os;
+    const Format             format;
+    FILE*                    out;
+    bool                     quick{false};
+    bool                     headerWritten{false};
+    std::vector<const char*> filters;
+    uint32_t                 failures{0};
+    Gate                     gate;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_BENCH_H
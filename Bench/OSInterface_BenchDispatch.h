@@ -0,0 +1,110 @@
+#ifndef OSINTERFACE_OSINTERFACE_BENCHDISPATCH_H
+#define OSINTERFACE_OSINTERFACE_BENCHDISPATCH_H
+
+#include <cstdint>
+#include <vector>
+#include "OSInterface_Bench.h"
+#include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_Mutex.h"
+#include "OSInterface_Static.h"
+#include "OSInterface_UntypedQueue.h"
+
+template <OSInterfaceStaticBackend Backend> uint32_t OSInterface_Bench::benchDispatch(Backend& backend)
+{
+    const uint32_t failuresBefore = failures;
+    // Same objects, same loops: only the way the calls are made differs
+    benchDispatchCalls(os, "call=virtual");
+    benchDispatchCalls(backend, "call=static");
+    fflush(out);
+    return failures - failuresBefore;
+}
+
+/**
+ * @brief Time the uncontended operations of the primitives created by a backend
+ *
+ * @tparam Backend OSInterface, whose calls are all virtual, or a final implementation, whose calls are direct
+ */
+template <OSInterfaceBackend Backend> void OSInterface_Bench::benchDispatchCalls(Backend& backend,
+                                                                                const char* parameters)
+{
+    static const char* MUTEX_NAME     = "dispatch_mutex";
+    static const char* SEMAPHORE_NAME = "dispatch_semaphore";
+    static const char* QUEUE_NAME     = "dispatch_queue";
+
+    if (selected(MUTEX_NAME))
+    {
+        typename OSInterface_Types<Backend>::Mutex* mutex = backend.osCreateMutex();
+        if (mutex == nullptr)
+        {
+            failed(MUTEX_NAME, parameters);
+        }
+        else
+        {
+            timeBatches(MUTEX_NAME, parameters, [mutex] {
+                mutex->wait(UINT32_MAX);
+                mutex->signal();
+            });
+            delete mutex;
+        }
+    }
+
+    if (selected(SEMAPHORE_NAME))
+    {
+        typename OSInterface_Types<Backend>::BinarySemaphore* semaphore = backend.osCreateBinarySemaphore();
+        if (semaphore == nullptr)
+        {
+            failed(SEMAPHORE_NAME, parameters);
+        }
+        else
+        {
+            timeBatches(SEMAPHORE_NAME, parameters, [semaphore] {
+                semaphore->signal();
+                semaphore->wait(UINT32_MAX);
+            });
+            delete semaphore;
+        }
+    }
+
+    if (selected(QUEUE_NAME))
+    {
+        typename OSInterface_Types<Backend>::UntypedQueue* queue = backend.osCreateUntypedQueue(1, sizeof(uint32_t));
+        if (queue == nullptr)
+        {
+            failed(QUEUE_NAME, parameters);
+        }
+        else
+        {
+            uint32_t message = 0;
+            timeBatches(QUEUE_NAME, parameters, [queue, &message] {
+                queue->sendToBack(&message, 0);
+                queue->receive(&message, 0);
+            });
+            delete queue;
+        }
+    }
+}
+
+/**
+ * @brief Time batches of an operation too short to be timed alone, and report the mean duration per batch
+ */
+template <typename Operation> void OSInterface_Bench::timeBatches(const char* name, const char* parameters,
+                                                                  Operation operation)
+{
+    const uint32_t      batches = iterations(1000000) / BATCH_SIZE;
+    std::vector<double> samples;
+    samples.reserve(batches);
+    const uint64_t start = os.osTicks();
+    for (uint32_t i = 0; i < batches; i++)
+    {
+        const uint64_t batchStart = os.osTicks();
+        for (uint32_t j = 0; j < BATCH_SIZE; j++)
+        {
+            operation();
+        }
+        samples.push_back(toNanos(os.osTicks() - batchStart) / BATCH_SIZE);
+    }
+    const uint64_t elapsed = os.osTicks() - start;
+    report(name, parameters, samples, static_cast<uint64_t>(batches) * BATCH_SIZE, elapsed);
+}
+
+#endif // OSINTERFACE_OSINTERFACE_BENCHDISPATCH_H
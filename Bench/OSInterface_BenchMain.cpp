@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @brief Runs the OSInterface_Bench suite on OSInterface_Linux
+ *
+ * Usage: OSInterface_bench [--csv] [--quick] [filter...]
+ *
+ * --csv writes one header line and one line per result, to compare runs across releases. --quick runs about a tenth
+ * of the iterations. Filters only run the benchmarks whose name contains one of them. The dispatch_* benchmarks then
+ * compare calls through the OSInterface API with direct calls on the OSInterface_Linux classes.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "OSInterface_Bench.h"
+#include "OSInterface_BenchDispatch.h"
+#include "OSInterface_Linux.h"
+
+int main(const int argc, const char* argv[])
+{
+    OSInterface_Bench::Format format = OSInterface_Bench::TEXT;
+    bool                      quick  = false;
+    std::vector<const char*>  filters;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+        {
+            format = OSInterface_Bench::CSV;
+        }
+        else if (strcmp(argv[i], "--quick") == 0)
+        {
+            quick = true;
+        }
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "Usage: %s [--csv] [--quick] [filter...]\n", argv[0]);
+            return 2;
+        }
+        else
+        {
+            filters.push_back(argv[i]);
+        }
+    }
+
+    OSInterface_Linux os;
+    OSInterface_Bench bench(os, format, stdout);
+    bench.setQuick(quick);
+    for (const char* filter : filters)
+    {
+        bench.addFilter(filter);
+    }
+    uint32_t failures = bench.runAll();
+    failures += bench.benchDispatch(os);
+    return failures == 0 ? 0 : 1;
+}
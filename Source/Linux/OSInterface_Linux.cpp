@@ -0,0 +1,278 @@
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <pthread.h>
+#include <system_error>
+#include <thread>
+#include "OSInterface_Linux.h"
+#include "OSInterface_LinuxAllocator.h"
+#include "OSInterface_LinuxBinarySemaphore.h"
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_LinuxCountingSemaphore.h"
+#include "OSInterface_LinuxEventGroup.h"
+#include "OSInterface_LinuxLockFreeQueue.h"
+#include "OSInterface_LinuxMessageBuffer.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_LinuxPriorityQueue.h"
+#include "OSInterface_LinuxRWLock.h"
+#include "OSInterface_LinuxStreamBuffer.h"
+#include "OSInterface_LinuxUntypedQueue.h"
+#include "OSInterface_LinuxWaitSet.h"
+
+static const char* TAG = "OSInterface_Linux";
+
+/**
+ * @brief Add an object to the instrumentation registry, so that it shows up in the dumps even before it is named
+ */
+template <typename Object> static Object* published(Object* object)
+{
+#ifdef OSInterface_INSTRUMENTATION
+    if (object != nullptr)
+    {
+        object->getStats().publish();
+    }
+#endif
+    return object;
+}
+
+template <typename Queue> static Queue* createQueue(const uint32_t maxMessages, const uint32_t messageSize)
+{
+    auto* queue = new (std::nothrow) Queue(maxMessages, messageSize);
+    if (queue != nullptr && !queue->isValid())
+    {
+        delete queue;
+        queue = nullptr;
+    }
+    return published(queue);
+}
+
+void OSInterface_Linux::osSleep(const uint32_t ms)
+{
+    const OSInterface_LinuxDeadline deadline(ms);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline.get(), nullptr) == EINTR)
+    {
+    }
+}
+
+uint32_t OSInterface_Linux::osMillis()
+{
+    return static_cast<uint32_t>(OSInterface_LinuxClock::nowMillis());
+}
+
+void OSInterface_Linux::osSleepMicros(const uint32_t us)
+{
+    const OSInterface_LinuxDeadline deadline =
+        OSInterface_LinuxDeadline::after(us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline.get(), nullptr) == EINTR)
+    {
+    }
+}
+
+uint64_t OSInterface_Linux::osMillis64()
+{
+    return OSInterface_LinuxClock::nowMillis();
+}
+
+uint64_t OSInterface_Linux::osMicros64()
+{
+    return OSInterface_LinuxClock::nowMicros();
+}
+
+uint64_t OSInterface_Linux::osTicks()
+{
+    return OSInterface_LinuxClock::nowNanos();
+}
+
+uint64_t OSInterface_Linux::osTicksPerSecond()
+{
+    return OSInterface_LinuxClock::NANOS_PER_SECOND;
+}
+
+OSInterface_LinuxMutex* OSInterface_Linux::osCreateMutex()
+{
+    return published(new (std::nothrow) OSInterface_LinuxMutex());
+}
+
+OSInterface_LinuxMutex* OSInterface_Linux::osCreateMutex(const OSInterface_Mutex::Mode mode)
+{
+    return published(new (std::nothrow) OSInterface_LinuxMutex(mode == OSInterface_Mutex::ADAPTIVE));
+}
+
+OSInterface_LinuxRWLock* OSInterface_Linux::osCreateRWLock()
+{
+    return new (std::nothrow) OSInterface_LinuxRWLock();
+}
+
+OSInterface_LinuxBinarySemaphore* OSInterface_Linux::osCreateBinarySemaphore()
+{
+    return published(new (std::nothrow) OSInterface_LinuxBinarySemaphore());
+}
+
+OSInterface_LinuxCountingSemaphore* OSInterface_Linux::osCreateCountingSemaphore(const uint32_t maxCount,
+                                                                                 const uint32_t initialCount)
+{
+    if (maxCount == 0 || initialCount > maxCount)
+    {
+        return nullptr;
+    }
+    return new (std::nothrow) OSInterface_LinuxCountingSemaphore(maxCount, initialCount);
+}
+
+OSInterface_LinuxEventGroup* OSInterface_Linux::osCreateEventGroup()
+{
+    return new (std::nothrow) OSInterface_LinuxEventGroup();
+}
+
+OSInterface_LinuxTimer* OSInterface_Linux::osCreateTimer(const uint32_t period, const OSInterface_Timer::Mode mode,
+                                                         const OSInterfaceProcess callback, void* callbackArg,
+                                                         const char* timerName)
+{
+    if (period == 0 || callback == nullptr)
+    {
+        return nullptr;
+    }
+    return new (std::nothrow) OSInterface_LinuxTimer(timerService, period, mode, callback, callbackArg, timerName);
+}
+
+OSInterface_LinuxUntypedQueue* OSInterface_Linux::osCreateUntypedQueue(const uint32_t maxMessages,
+                                                                       const uint32_t messageSize)
+{
+    return createQueue<OSInterface_LinuxUntypedQueue>(maxMessages, messageSize);
+}
+
+OSInterface_UntypedQueue* OSInterface_Linux::osCreateUntypedQueue(
+    const uint32_t maxMessages, const uint32_t messageSize, const OSInterface_UntypedQueue::AccessPattern accessPattern)
+{
+    if (accessPattern == OSInterface_UntypedQueue::SINGLE_PRODUCER_SINGLE_CONSUMER)
+    {
+        return osCreateUntypedQueue<OSInterface_LinuxSPSCQueue>(maxMessages, messageSize);
+    }
+    return osCreateUntypedQueue<OSInterface_LinuxMPMCQueue>(maxMessages, messageSize);
+}
+
+template <typename Queue>
+    requires std::same_as<Queue, OSInterface_LinuxSPSCQueue> || std::same_as<Queue, OSInterface_LinuxMPMCQueue>
+Queue* OSInterface_Linux::osCreateUntypedQueue(const uint32_t maxMessages, const uint32_t messageSize)
+{
+    return createQueue<Queue>(maxMessages, messageSize);
+}
+
+template OSInterface_LinuxSPSCQueue* OSInterface_Linux::osCreateUntypedQueue<OSInterface_LinuxSPSCQueue>(
+    uint32_t maxMessages, uint32_t messageSize);
+template OSInterface_LinuxMPMCQueue* OSInterface_Linux::osCreateUntypedQueue<OSInterface_LinuxMPMCQueue>(
+    uint32_t maxMessages, uint32_t messageSize);
+
+OSInterface_LinuxPriorityQueue* OSInterface_Linux::osCreatePriorityQueue(const uint32_t maxMessages,
+                                                                         const uint32_t messageSize,
+                                                                         const uint32_t priorityLevels)
+{
+    auto* queue = new (std::nothrow) OSInterface_LinuxPriorityQueue(maxMessages, messageSize, priorityLevels);
+    if (queue != nullptr && !queue->isValid())
+    {
+        delete queue;
+        queue = nullptr;
+    }
+    return published(queue);
+}
+
+OSInterface_LinuxMessageBuffer* OSInterface_Linux::osCreateMessageBuffer(const uint32_t capacity)
+{
+    auto* buffer = new (std::nothrow) OSInterface_LinuxMessageBuffer(capacity);
+    if (buffer != nullptr && !buffer->isValid())
+    {
+        delete buffer;
+        buffer = nullptr;
+    }
+    return buffer;
+}
+
+OSInterface_LinuxStreamBuffer* OSInterface_Linux::osCreateStreamBuffer(const uint32_t capacity,
+                                                                       const uint32_t triggerLevel)
+{
+    if (triggerLevel > capacity)
+    {
+        return nullptr;
+    }
+    auto* buffer = new (std::nothrow) OSInterface_LinuxStreamBuffer(capacity, triggerLevel);
+    if (buffer != nullptr && !buffer->isValid())
+    {
+        delete buffer;
+        buffer = nullptr;
+    }
+    return buffer;
+}
+
+OSInterface_LinuxWaitSet* OSInterface_Linux::osCreateWaitSet()
+{
+    return new (std::nothrow) OSInterface_LinuxWaitSet();
+}
+
+void* OSInterface_Linux::osMalloc(const uint32_t size)
+{
+    return OSInterface_LinuxAllocator::allocate(size);
+}
+
+void OSInterface_Linux::osFree(void* ptr)
+{
+    OSInterface_LinuxAllocator::free(ptr);
+}
+
+void OSInterface_Linux::osGetMemoryStats(OSInterface_MemoryStats& stats)
+{
+    OSInterface_LinuxAllocator::getStats(stats);
+}
+
+void OSInterface_Linux::osRunProcess(const OSInterfaceProcess process, void* arg)
+{
+    osRunProcess(process, nullptr, arg);
+}
+
+void OSInterface_Linux::osRunProcess(const OSInterfaceProcess process, const char* processName, void* arg)
+{
+    try
+    {
+        std::thread thread(process, arg);
+        if (processName != nullptr)
+        {
+            // Linux limits thread names to 15 characters plus the terminator
+            char name[16];
+            strncpy(name, processName, sizeof(name) - 1);
+            name[sizeof(name) - 1] = '\0';
+            pthread_setname_np(thread.native_handle(), name);
+        }
+        thread.detach();
+    }
+    catch (const std::system_error& error)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': %s", processName != nullptr ? processName : "",
+                            error.what());
+    }
+}
+
+OSInterface_LinuxProcess* OSInterface_Linux::osRunProcess(const OSInterfaceProcess process, void* arg,
+                                                          const OSInterface_ProcessAttributes& attributes)
+{
+    auto* handle = new (std::nothrow) OSInterface_LinuxProcess(process, arg);
+    if (handle == nullptr)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s'", attributes.name != nullptr ? attributes.name : "");
+        return nullptr;
+    }
+    // start() logs the failures
+    if (!handle->start(attributes))
+    {
+        delete handle;
+        handle = nullptr;
+    }
+    return handle;
+}
+
+OSInterface_LinuxJob* OSInterface_Linux::osSubmit(const OSInterfaceProcess job, void* arg)
+{
+    OSInterface_LinuxJob* handle = executor.submit(job, arg);
+    if (handle == nullptr)
+    {
+        OSInterfaceLogError(TAG, "Could not submit job");
+    }
+    return handle;
+}
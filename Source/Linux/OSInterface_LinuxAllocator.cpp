@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <mutex>
+#include "OSInterface_LinuxAllocator.h"
+#include "OSInterface_LinuxLockFreeQueue.h"
+#include "OSInterface_LinuxMutex.h"
+
+static constexpr uint32_t SIZE_CLASS_COUNT = OSInterface_LinuxAllocator::SIZE_CLASS_COUNT;
+static constexpr uint32_t LARGE_BLOCK      = UINT32_MAX;
+
+struct BlockHeader
+{
+    uint32_t sizeClass; // LARGE_BLOCK for blocks allocated from the system heap directly
+    uint32_t size;      // Size requested by the caller
+    uint64_t padding;
+};
+
+static_assert(sizeof(BlockHeader) == OSInterface_LinuxAllocator::HEADER_SIZE, "The header must keep 16-byte alignment");
+
+// Overlays the header of a free block
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct alignas(OSInterface_LINUX_CACHE_LINE_SIZE) SizeClassPool
+{
+    OSInterface_LinuxMutex lock;
+    FreeBlock*             freeBlocks{nullptr}; // Guarded by lock
+    std::atomic<uint32_t>  blocks{0};
+};
+
+struct ThreadCache
+{
+    struct Bin
+    {
+        FreeBlock*           blocks{nullptr};
+        uint32_t             count{0};
+        std::atomic<int64_t> inUse{0}; // Blocks allocated minus blocks freed by the thread, only written by it
+    };
+
+    ThreadCache();
+
+    ThreadCache(const ThreadCache&)            = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ThreadCache(ThreadCache&&)                 = delete;
+    ThreadCache& operator=(ThreadCache&&)      = delete;
+
+    ~ThreadCache();
+
+    Bin bins[SIZE_CLASS_COUNT];
+
+    // Guarded by the registry lock
+    ThreadCache* previous{nullptr};
+    ThreadCache* next{nullptr};
+};
+
+struct AllocatorState
+{
+    SizeClassPool pools[SIZE_CLASS_COUNT];
+
+    OSInterface_LinuxMutex registryLock;
+    ThreadCache*           threads{nullptr};                  // Guarded by registryLock
+    int64_t                exitedInUse[SIZE_CLASS_COUNT]{};   // Guarded by registryLock, inUse of exited threads
+
+    std::atomic<uint64_t> bytesInUse{0}; // Bytes of the blocks allocated, headers included
+    std::atomic<uint64_t> peakBytesInUse{0};
+    std::atomic<uint64_t> failedAllocations{0};
+};
+
+static AllocatorState& state()
+{
+    // Never deleted, detached threads may still free memory while static objects are destroyed
+    static auto* instance = new AllocatorState();
+    return *instance;
+}
+
+// Set once the cache of the thread is destroyed, for memory freed by thread_local destructors running after it
+static thread_local bool threadCacheDestroyed = false;
+
+static ThreadCache* threadCache()
+{
+    if (threadCacheDestroyed)
+    {
+        return nullptr;
+    }
+    static thread_local ThreadCache cache;
+    return &cache;
+}
+
+static uint32_t blockSize(const uint32_t sizeClass)
+{
+    return OSInterface_LinuxAllocator::MIN_BLOCK_SIZE << sizeClass;
+}
+
+static uint32_t sizeClassOf(const uint32_t size)
+{
+    const uint64_t total = static_cast<uint64_t>(size) + OSInterface_LinuxAllocator::HEADER_SIZE;
+    if (total > OSInterface_LinuxAllocator::MAX_BLOCK_SIZE)
+    {
+        return LARGE_BLOCK;
+    }
+    constexpr uint32_t MIN_SHIFT = std::countr_zero(OSInterface_LinuxAllocator::MIN_BLOCK_SIZE);
+    const uint32_t     shift     = std::bit_width(static_cast<uint32_t>(total) - 1);
+    return shift > MIN_SHIFT ? shift - MIN_SHIFT : 0;
+}
+
+static uint32_t cacheLimit(const uint32_t sizeClass)
+{
+    return std::clamp(OSInterface_LinuxAllocator::CACHE_SIZE / blockSize(sizeClass), 8u, 256u);
+}
+
+// The only places bytesInUse changes, so that the peak is the highest value it had
+static void addInUse(const uint64_t bytes)
+{
+    AllocatorState& allocator = state();
+    const uint64_t  inUse     = allocator.bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    uint64_t        peak      = allocator.peakBytesInUse.load(std::memory_order_relaxed);
+    while (inUse > peak && !allocator.peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed))
+    {
+    }
+}
+
+static void removeInUse(const uint64_t bytes)
+{
+    state().bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+static bool carveChunk(SizeClassPool& pool, const uint32_t sizeClass)
+{
+    auto* chunk = static_cast<uint8_t*>(std::malloc(OSInterface_LinuxAllocator::CHUNK_SIZE));
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+    const uint32_t size = blockSize(sizeClass);
+    // Linked from the end so that blocks are handed out in address order
+    for (uint32_t offset = OSInterface_LinuxAllocator::CHUNK_SIZE; offset != 0;)
+    {
+        offset -= size;
+        auto* block     = reinterpret_cast<FreeBlock*>(chunk + offset);
+        block->next     = pool.freeBlocks;
+        pool.freeBlocks = block;
+    }
+    pool.blocks.fetch_add(OSInterface_LinuxAllocator::CHUNK_SIZE / size, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Move up to count free blocks of a pool to a list, carving a new chunk if the pool is empty
+ *
+ * @return uint32_t Number of blocks moved
+ */
+static uint32_t takeBlocks(const uint32_t sizeClass, FreeBlock*& list, const uint32_t count)
+{
+    SizeClassPool& pool  = state().pools[sizeClass];
+    uint32_t       taken = 0;
+    {
+        std::lock_guard guard(pool.lock);
+        if (pool.freeBlocks == nullptr && !carveChunk(pool, sizeClass))
+        {
+            return 0;
+        }
+        while (taken < count && pool.freeBlocks != nullptr)
+        {
+            FreeBlock* block = pool.freeBlocks;
+            pool.freeBlocks  = block->next;
+            block->next      = list;
+            list             = block;
+            taken++;
+        }
+    }
+    return taken;
+}
+
+/**
+ * @brief Give a list of blocks, from first to last, back to their pool
+ */
+static void giveBlocks(const uint32_t sizeClass, FreeBlock* first, FreeBlock* last)
+{
+    SizeClassPool& pool = state().pools[sizeClass];
+    {
+        std::lock_guard guard(pool.lock);
+        last->next      = pool.freeBlocks;
+        pool.freeBlocks = first;
+    }
+}
+
+static void drain(ThreadCache::Bin& bin, const uint32_t sizeClass, const uint32_t count)
+{
+    FreeBlock* first = bin.blocks;
+    FreeBlock* last  = first;
+    for (uint32_t i = 1; i < count; i++)
+    {
+        last = last->next;
+    }
+    bin.blocks = last->next;
+    bin.count -= count;
+    giveBlocks(sizeClass, first, last);
+}
+
+static void addExitedInUse(const uint32_t sizeClass, const int64_t blocks)
+{
+    AllocatorState& allocator = state();
+    std::lock_guard guard(allocator.registryLock);
+    allocator.exitedInUse[sizeClass] += blocks;
+}
+
+ThreadCache::ThreadCache()
+{
+    AllocatorState& allocator = state();
+    std::lock_guard guard(allocator.registryLock);
+    next = allocator.threads;
+    if (next != nullptr)
+    {
+        next->previous = this;
+    }
+    allocator.threads = this;
+}
+
+ThreadCache::~ThreadCache()
+{
+    threadCacheDestroyed = true;
+    for (uint32_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; sizeClass++)
+    {
+        if (bins[sizeClass].count != 0)
+        {
+            drain(bins[sizeClass], sizeClass, bins[sizeClass].count);
+        }
+    }
+
+    AllocatorState& allocator = state();
+    std::lock_guard guard(allocator.registryLock);
+    for (uint32_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; sizeClass++)
+    {
+        allocator.exitedInUse[sizeClass] += bins[sizeClass].inUse.load(std::memory_order_relaxed);
+    }
+    if (previous != nullptr)
+    {
+        previous->next = next;
+    }
+    else
+    {
+        allocator.threads = next;
+    }
+    if (next != nullptr)
+    {
+        next->previous = previous;
+    }
+}
+
+void* OSInterface_LinuxAllocator::allocate(const uint32_t size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    AllocatorState& allocator = state();
+    const uint32_t  sizeClass = sizeClassOf(size);
+    BlockHeader*    header    = nullptr;
+    if (sizeClass == LARGE_BLOCK)
+    {
+        const uint64_t bytes = static_cast<uint64_t>(size) + HEADER_SIZE;
+        header               = static_cast<BlockHeader*>(std::malloc(bytes));
+    }
+    else if (ThreadCache* cache = threadCache(); cache != nullptr)
+    {
+        ThreadCache::Bin& bin = cache->bins[sizeClass];
+        if (bin.blocks == nullptr)
+        {
+            bin.count += takeBlocks(sizeClass, bin.blocks, cacheLimit(sizeClass) / 2);
+        }
+        if (bin.blocks != nullptr)
+        {
+            header     = reinterpret_cast<BlockHeader*>(bin.blocks);
+            bin.blocks = bin.blocks->next;
+            bin.count--;
+            bin.inUse.store(bin.inUse.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        FreeBlock* block = nullptr;
+        if (takeBlocks(sizeClass, block, 1) != 0)
+        {
+            header = reinterpret_cast<BlockHeader*>(block);
+            addExitedInUse(sizeClass, 1);
+        }
+    }
+
+    if (header == nullptr)
+    {
+        allocator.failedAllocations.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    header->sizeClass = sizeClass;
+    header->size      = size;
+    addInUse(sizeClass == LARGE_BLOCK ? static_cast<uint64_t>(size) + HEADER_SIZE : blockSize(sizeClass));
+    return header + 1;
+}
+
+void OSInterface_LinuxAllocator::free(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    auto*          header    = static_cast<BlockHeader*>(ptr) - 1;
+    const uint32_t sizeClass = header->sizeClass;
+    if (sizeClass == LARGE_BLOCK)
+    {
+        removeInUse(static_cast<uint64_t>(header->size) + HEADER_SIZE);
+        std::free(header);
+        return;
+    }
+    removeInUse(blockSize(sizeClass));
+
+    auto*        block = reinterpret_cast<FreeBlock*>(header);
+    ThreadCache* cache = threadCache();
+    if (cache == nullptr)
+    {
+        giveBlocks(sizeClass, block, block);
+        addExitedInUse(sizeClass, -1);
+        return;
+    }
+    ThreadCache::Bin& bin = cache->bins[sizeClass];
+    block->next           = bin.blocks;
+    bin.blocks            = block;
+    bin.count++;
+    bin.inUse.store(bin.inUse.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    if (bin.count > cacheLimit(sizeClass))
+    {
+        drain(bin, sizeClass, cacheLimit(sizeClass) / 2);
+    }
+}
+
+void OSInterface_LinuxAllocator::getStats(OSInterface_MemoryStats& stats)
+{
+    AllocatorState& allocator = state();
+
+    int64_t inUse[SIZE_CLASS_COUNT];
+    {
+        std::lock_guard guard(allocator.registryLock);
+        std::copy(std::begin(allocator.exitedInUse), std::end(allocator.exitedInUse), inUse);
+        for (const ThreadCache* cache = allocator.threads; cache != nullptr; cache = cache->next)
+        {
+            for (uint32_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; sizeClass++)
+            {
+                inUse[sizeClass] += cache->bins[sizeClass].inUse.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (uint32_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; sizeClass++)
+    {
+        OSInterface_MemoryStats::SizeClass& entry = stats.sizeClasses[sizeClass];
+        entry.blockSize   = blockSize(sizeClass);
+        entry.blocks      = allocator.pools[sizeClass].blocks.load(std::memory_order_relaxed);
+        // Threads are not stopped, a block freed by one thread may be counted before its allocation by another
+        entry.blocksInUse = static_cast<uint32_t>(std::clamp<int64_t>(inUse[sizeClass], 0, entry.blocks));
+    }
+    stats.bytesInUse        = allocator.bytesInUse.load(std::memory_order_relaxed);
+    stats.peakBytesInUse    = allocator.peakBytesInUse.load(std::memory_order_relaxed);
+    stats.failedAllocations = allocator.failedAllocations.load(std::memory_order_relaxed);
+    stats.sizeClassCount    = SIZE_CLASS_COUNT;
+}
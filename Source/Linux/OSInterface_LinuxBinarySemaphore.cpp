@@ -0,0 +1,43 @@
+#include "OSInterface_LinuxBinarySemaphore.h"
+#include "OSInterface_LinuxFutex.h"
+
+bool OSInterface_LinuxBinarySemaphore::waitContended(const uint64_t timeout_ns)
+{
+#ifdef OSInterface_INSTRUMENTATION
+    const uint64_t start  = OSInterface_LinuxClock::nowNanos();
+    const bool     result = sleepContended(timeout_ns);
+    stats.wait.record(timeout_ns, OSInterface_LinuxClock::nowNanos() - start, result);
+    return result;
+#else
+    return sleepContended(timeout_ns);
+#endif
+}
+
+bool OSInterface_LinuxBinarySemaphore::sleepContended(const uint64_t timeout_ns)
+{
+    if (timeout_ns == 0)
+    {
+        return false;
+    }
+
+    const OSInterface_LinuxDeadline deadline = OSInterface_LinuxDeadline::after(timeout_ns);
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool acquired = tryTake();
+    while (!acquired)
+    {
+        if (!OSInterface_LinuxFutex::wait(state, EMPTY, &deadline))
+        {
+            acquired = tryTake();
+            break;
+        }
+        acquired = tryTake();
+    }
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+    return acquired;
+}
+
+void OSInterface_LinuxBinarySemaphore::wakeOne()
+{
+    OSInterface_LinuxFutex::wake(state, 1);
+}
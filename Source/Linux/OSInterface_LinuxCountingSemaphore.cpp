@@ -0,0 +1,51 @@
+#include <algorithm>
+#include "OSInterface_LinuxCountingSemaphore.h"
+
+uint32_t OSInterface_LinuxCountingSemaphore::give(const uint32_t added)
+{
+    uint32_t current = count.load(std::memory_order_relaxed);
+    uint32_t given   = 0;
+    do
+    {
+        given = std::min(added, maxCount - current);
+        if (given == 0)
+        {
+            return 0;
+        }
+    }
+    while (!count.compare_exchange_weak(current, current + given, std::memory_order_release,
+                                        std::memory_order_relaxed));
+
+    // A single count may only satisfy a waiter for several counts if every waiter gets a chance to look at it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (bulkWaiters.load(std::memory_order_seq_cst) != 0)
+    {
+        available.notifyAll();
+    }
+    else
+    {
+        available.notifyBatch(given);
+    }
+    return given;
+}
+
+bool OSInterface_LinuxCountingSemaphore::take(const uint32_t taken, const uint64_t timeout_ns)
+{
+    if (taken > maxCount)
+    {
+        return false;
+    }
+    if (taken <= 1)
+    {
+        return available.awaitFor([this, taken] { return tryTake(taken); }, timeout_ns);
+    }
+
+    if (tryTake(taken))
+    {
+        return true;
+    }
+    bulkWaiters.fetch_add(1, std::memory_order_seq_cst);
+    const bool result = available.awaitFor([this, taken] { return tryTake(taken); }, timeout_ns);
+    bulkWaiters.fetch_sub(1, std::memory_order_relaxed);
+    return result;
+}
@@ -0,0 +1,38 @@
+#include "OSInterface_LinuxEventGroup.h"
+
+uint32_t OSInterface_LinuxEventGroup::setBits(const uint32_t bits)
+{
+    const uint32_t previous = flags.fetch_or(bits, std::memory_order_acq_rel);
+    if ((previous | bits) != previous)
+    {
+        changed.notifyAll();
+    }
+    return previous | bits;
+}
+
+uint32_t OSInterface_LinuxEventGroup::wait(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                                           const uint64_t timeout_ns)
+{
+    if (bits == 0)
+    {
+        return getBits();
+    }
+
+    uint32_t   observed  = 0;
+    const auto satisfied = [this, bits, mode, clearOnExit, &observed]
+    {
+        observed = flags.load(std::memory_order_acquire);
+        while (mode == WAIT_ALL ? (observed & bits) == bits : (observed & bits) != 0)
+        {
+            if (!clearOnExit ||
+                flags.compare_exchange_weak(observed, observed & ~bits, std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    changed.awaitFor(satisfied, timeout_ns);
+    return observed;
+}
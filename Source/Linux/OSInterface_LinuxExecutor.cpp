@@ -0,0 +1,252 @@
+#include <cstdio>
+#include <mutex>
+#include <new>
+#include <pthread.h>
+#include <system_error>
+#include "OSInterface_LinuxExecutor.h"
+
+static const char* TAG = "OSInterface_LinuxExecutor";
+
+// Worker running on the calling thread, if any, so that jobs submitted from a job stay on its worker
+static thread_local OSInterface_LinuxExecutor* currentExecutor = nullptr;
+static thread_local uint32_t                   currentWorker   = 0;
+
+OSInterface_LinuxJob::OSInterface_LinuxJob(const OSInterfaceProcess job, void* arg) : job(job), arg(arg)
+{
+}
+
+OSInterface_LinuxJob::~OSInterface_LinuxJob()
+{
+    waitUntil(nullptr);
+}
+
+bool OSInterface_LinuxJob::wait(const uint32_t maxTimeToWait_ms)
+{
+    if (maxTimeToWait_ms == 0)
+    {
+        return isDone();
+    }
+    const OSInterface_LinuxDeadline deadline(maxTimeToWait_ms);
+    return waitUntil(&deadline);
+}
+
+bool OSInterface_LinuxJob::isDone()
+{
+    return state.load(std::memory_order_acquire) == DONE;
+}
+
+bool OSInterface_LinuxJob::waitUntil(const OSInterface_LinuxDeadline* deadline)
+{
+    uint32_t current = state.load(std::memory_order_acquire);
+    while (current != DONE)
+    {
+        // Helping with other jobs is bounded by the deadline, a steady stream of them must not extend the wait
+        if (deadline != nullptr && deadline->expired())
+        {
+            return isDone();
+        }
+        if (currentExecutor != nullptr && currentExecutor->runQueued(currentWorker))
+        {
+            current = state.load(std::memory_order_acquire);
+            continue;
+        }
+        if (current == PENDING &&
+            !state.compare_exchange_weak(current, WAITED, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            continue;
+        }
+        if (!OSInterface_LinuxFutex::wait(state, WAITED, deadline))
+        {
+            return isDone();
+        }
+        current = state.load(std::memory_order_acquire);
+    }
+    return true;
+}
+
+void OSInterface_LinuxJob::run()
+{
+    job(arg);
+    // Once DONE is visible the handle may be deleted at any time. Waking a futex whose memory was freed is harmless, at
+    // worst a waiter on reused memory wakes up spuriously and checks its condition again.
+    if (state.exchange(DONE, std::memory_order_acq_rel) == WAITED)
+    {
+        OSInterface_LinuxFutex::wakeAll(state);
+    }
+}
+
+OSInterface_LinuxExecutor::~OSInterface_LinuxExecutor()
+{
+    stopping.store(true, std::memory_order_seq_cst);
+    jobQueued.notifyAll();
+    const uint32_t count = workerCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        workers[i].thread.join();
+    }
+}
+
+OSInterface_LinuxJob* OSInterface_LinuxExecutor::submit(const OSInterfaceProcess job, void* arg)
+{
+    if (workerCount.load(std::memory_order_acquire) == 0 && !start())
+    {
+        return nullptr;
+    }
+    auto* handle = new (std::nothrow) OSInterface_LinuxJob(job, arg);
+    if (handle == nullptr)
+    {
+        return nullptr;
+    }
+
+    const uint32_t index = currentExecutor == this
+                               ? currentWorker
+                               : nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                                     workerCount.load(std::memory_order_relaxed);
+    push(workers[index], *handle);
+    jobQueued.notifyOne();
+    return handle;
+}
+
+bool OSInterface_LinuxExecutor::start()
+{
+    std::lock_guard guard(startLock);
+    if (workerCount.load(std::memory_order_relaxed) != 0)
+    {
+        return true;
+    }
+
+    const unsigned int cpus  = std::thread::hardware_concurrency();
+    const uint32_t     count = cpus == 0 ? 1 : cpus;
+    workers.reset(new (std::nothrow) Worker[count]);
+    if (workers == nullptr)
+    {
+        return false;
+    }
+    uint32_t started = 0;
+    try
+    {
+        for (; started < count; started++)
+        {
+            workers[started].thread = std::thread(&OSInterface_LinuxExecutor::run, this, started);
+            char name[16];
+            snprintf(name, sizeof(name), "OSInterfaceW%u", started % 1000); // Names are limited to 15 characters
+            pthread_setname_np(workers[started].thread.native_handle(), name);
+        }
+    }
+    catch (const std::system_error& error)
+    {
+        OSInterfaceLogError(TAG, "Could not start worker %u: %s", started, error.what());
+    }
+    workerCount.store(started, std::memory_order_release);
+    return started != 0;
+}
+
+void OSInterface_LinuxExecutor::push(Worker& worker, OSInterface_LinuxJob& job)
+{
+    std::lock_guard guard(worker.lock);
+    job.previous = worker.newest;
+    job.next     = nullptr;
+    if (worker.newest != nullptr)
+    {
+        worker.newest->next = &job;
+    }
+    else
+    {
+        worker.oldest = &job;
+    }
+    worker.newest = &job;
+    queuedJobs.fetch_add(1, std::memory_order_release);
+}
+
+OSInterface_LinuxJob* OSInterface_LinuxExecutor::popNewest(Worker& worker)
+{
+    std::lock_guard       guard(worker.lock);
+    OSInterface_LinuxJob* job = worker.newest;
+    if (job != nullptr)
+    {
+        worker.newest = job->previous;
+        if (worker.newest != nullptr)
+        {
+            worker.newest->next = nullptr;
+        }
+        else
+        {
+            worker.oldest = nullptr;
+        }
+    }
+    return job;
+}
+
+OSInterface_LinuxJob* OSInterface_LinuxExecutor::popOldest(Worker& worker)
+{
+    std::lock_guard       guard(worker.lock);
+    OSInterface_LinuxJob* job = worker.oldest;
+    if (job != nullptr)
+    {
+        worker.oldest = job->next;
+        if (worker.oldest != nullptr)
+        {
+            worker.oldest->previous = nullptr;
+        }
+        else
+        {
+            worker.newest = nullptr;
+        }
+    }
+    return job;
+}
+
+OSInterface_LinuxJob* OSInterface_LinuxExecutor::take(const uint32_t index)
+{
+    if (queuedJobs.load(std::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+    OSInterface_LinuxJob* job   = popNewest(workers[index]);
+    const uint32_t        count = workerCount.load(std::memory_order_acquire);
+    for (uint32_t i = 1; job == nullptr && i < count; i++)
+    {
+        job = popOldest(workers[(index + i) % count]);
+    }
+    if (job != nullptr)
+    {
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+bool OSInterface_LinuxExecutor::runQueued(const uint32_t index)
+{
+    OSInterface_LinuxJob* job = take(index);
+    if (job == nullptr)
+    {
+        return false;
+    }
+    job->run(); // The handle must not be touched afterwards, its owner may delete it as soon as it is done
+    return true;
+}
+
+void OSInterface_LinuxExecutor::run(const uint32_t index)
+{
+    currentExecutor = this;
+    currentWorker   = index;
+    while (true)
+    {
+        if (runQueued(index))
+        {
+            continue;
+        }
+        const uint32_t key = jobQueued.prepareWait();
+        if (queuedJobs.load(std::memory_order_seq_cst) != 0)
+        {
+            jobQueued.cancelWait();
+            continue;
+        }
+        if (stopping.load(std::memory_order_seq_cst))
+        {
+            jobQueued.cancelWait();
+            return;
+        }
+        jobQueued.commitWait(key, nullptr);
+    }
+}
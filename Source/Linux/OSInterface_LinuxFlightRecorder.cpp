@@ -0,0 +1,195 @@
+#ifdef OSInterface_ASYNC_LOG
+
+    #include <atomic>
+    #include <cerrno>
+    #include <chrono>
+    #include <cstring>
+    #include <ctime>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #include "OSInterface_LinuxFlightRecorder.h"
+    #include "OSInterface_Log.h"
+
+static const char* TAG = "OSInterface_LinuxFlightRecorder";
+
+static constexpr uint32_t RECORD_ALIGNMENT = 4;
+
+OSInterface_LinuxFlightRecorder::OSInterface_LinuxFlightRecorder(const char* path, uint32_t recordAreaSize,
+                                                                 const uint32_t stringTableSize)
+{
+    recordAreaSize -= recordAreaSize % RECORD_ALIGNMENT;
+    if (recordAreaSize < 2 * sizeof(OSInterface_FlightRecordHeader))
+    {
+        OSInterfaceLogError(TAG, "Record area of %u bytes is too small", recordAreaSize);
+        return;
+    }
+
+    const int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        OSInterfaceLogError(TAG, "Could not create '%s': %s", path, strerror(errno));
+        return;
+    }
+    const size_t size = sizeof(OSInterface_FlightRecordFile) + stringTableSize + recordAreaSize;
+    void*        mapping =
+        ftruncate(fd, static_cast<off_t>(size)) == 0 ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                                                      : MAP_FAILED;
+    const int error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        OSInterfaceLogError(TAG, "Could not map '%s': %s", path, strerror(error));
+        return;
+    }
+
+    file       = static_cast<OSInterface_FlightRecordFile*>(mapping);
+    mappedSize = size;
+    strings    = static_cast<uint8_t*>(mapping) + sizeof(OSInterface_FlightRecordFile);
+    records    = strings + stringTableSize;
+
+    // The file was truncated, so every other field starts at 0
+    timespec realtime{};
+    clock_gettime(CLOCK_REALTIME, &realtime);
+    memcpy(file->magic, OSInterface_FLIGHT_RECORD_MAGIC, sizeof(file->magic));
+    file->version           = OSInterface_FLIGHT_RECORD_VERSION;
+    file->headerSize        = sizeof(OSInterface_FlightRecordFile);
+    file->stringTableSize   = stringTableSize;
+    file->recordAreaSize    = recordAreaSize;
+    file->pointerSize       = sizeof(void*);
+    file->longDoubleSize    = sizeof(long double);
+    file->startRealtime_ns  = static_cast<uint64_t>(realtime.tv_sec) * 1000000000 + realtime.tv_nsec;
+    file->startMonotonic_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now().time_since_epoch())
+                                  .count();
+}
+
+OSInterface_LinuxFlightRecorder::~OSInterface_LinuxFlightRecorder()
+{
+    if (file != nullptr)
+    {
+        munmap(file, mappedSize);
+    }
+}
+
+bool OSInterface_LinuxFlightRecorder::isValid() const
+{
+    return file != nullptr;
+}
+
+void OSInterface_LinuxFlightRecorder::write(const OSInterface_LogRecord& record)
+{
+    if (file == nullptr)
+    {
+        return;
+    }
+    const uint16_t tag     = tagId(record.tag);
+    const uint16_t message = messageId(record.format, record.signature);
+    const uint64_t size    = (sizeof(OSInterface_FlightRecordHeader) + record.argumentsSize + RECORD_ALIGNMENT - 1) /
+                          RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+    if (tag == NO_ID || message == NO_ID || size > UINT16_MAX || size > file->recordAreaSize / 2)
+    {
+        droppedRecords++;
+        return;
+    }
+
+    const uint32_t area       = file->recordAreaSize;
+    uint64_t       head       = file->head;
+    const uint64_t contiguous = area - head % area;
+    const uint64_t skip       = size > contiguous ? contiguous : 0;
+    advanceTail(head, skip + size);
+    if (skip != 0)
+    {
+        const uint16_t wrap = 0;
+        memcpy(&records[head % area], &wrap, sizeof(wrap));
+        head += skip;
+    }
+
+    const OSInterface_FlightRecordHeader header{static_cast<uint16_t>(size), record.level,
+                                                static_cast<uint8_t>(size - sizeof(header) - record.argumentsSize),
+                                                tag, message, record.timestamp_ns};
+    uint8_t*                             destination = &records[head % area];
+    memcpy(destination, &header, sizeof(header));
+    memcpy(destination + sizeof(header), record.arguments, record.argumentsSize);
+    // Published last, a crash while copying leaves the record out of the file
+    std::atomic_ref(file->head).store(head + size, std::memory_order_release);
+}
+
+void OSInterface_LinuxFlightRecorder::flush()
+{
+    if (file != nullptr)
+    {
+        std::atomic_ref(file->droppedRecords)
+            .store(droppedRecords + OSInterface_AsyncLog::droppedRecords(), std::memory_order_relaxed);
+    }
+}
+
+uint16_t OSInterface_LinuxFlightRecorder::addString(const uint16_t kind, const char* first, const char* second,
+                                                    uint16_t& count)
+{
+    const size_t firstLength  = strlen(first) + 1;
+    const size_t secondLength = second != nullptr ? strlen(second) + 1 : 0;
+    const size_t length       = firstLength + secondLength;
+    const size_t used         = file->stringTableUsed;
+    if (count == NO_ID || length > UINT16_MAX ||
+        used + sizeof(OSInterface_FlightRecordString) + length > file->stringTableSize)
+    {
+        return NO_ID;
+    }
+
+    const OSInterface_FlightRecordString entry{kind, static_cast<uint16_t>(length)};
+    memcpy(&strings[used], &entry, sizeof(entry));
+    memcpy(&strings[used + sizeof(entry)], first, firstLength);
+    if (second != nullptr)
+    {
+        memcpy(&strings[used + sizeof(entry) + firstLength], second, secondLength);
+    }
+    std::atomic_ref(file->stringTableUsed).store(used + sizeof(entry) + length, std::memory_order_release);
+    return count++;
+}
+
+uint16_t OSInterface_LinuxFlightRecorder::tagId(const char* tag)
+{
+    const auto found = tags.find(tag);
+    if (found != tags.end())
+    {
+        return found->second;
+    }
+    const uint16_t id = addString(OSInterface_FLIGHT_RECORD_TAG, tag, nullptr, tagCount);
+    if (id != NO_ID)
+    {
+        tags.emplace(tag, id);
+    }
+    return id;
+}
+
+uint16_t OSInterface_LinuxFlightRecorder::messageId(const char* format, const char* signature)
+{
+    const auto found = messages.find({format, signature});
+    if (found != messages.end())
+    {
+        return found->second;
+    }
+    const uint16_t id = addString(OSInterface_FLIGHT_RECORD_MESSAGE, format, signature, messageCount);
+    if (id != NO_ID)
+    {
+        messages.emplace(std::make_pair(format, signature), id);
+    }
+    return id;
+}
+
+void OSInterface_LinuxFlightRecorder::advanceTail(const uint64_t head, const uint64_t size)
+{
+    const uint32_t area = file->recordAreaSize;
+    uint64_t       tail = file->tail;
+    while (head + size - tail > area)
+    {
+        uint16_t recordSize = 0;
+        memcpy(&recordSize, &records[tail % area], sizeof(recordSize));
+        tail += recordSize != 0 ? recordSize : area - tail % area;
+    }
+    // Published before the records are overwritten
+    std::atomic_ref(file->tail).store(tail, std::memory_order_release);
+}
+
+#endif // OSInterface_ASYNC_LOG
@@ -0,0 +1,33 @@
+#include <cerrno>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include "OSInterface_LinuxFutex.h"
+
+bool OSInterface_LinuxFutex::wait(std::atomic<uint32_t>& word, const uint32_t expected,
+                                  const OSInterface_LinuxDeadline* deadline)
+{
+    // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline, so spurious wake-ups do not stretch the timeout
+    const long result = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                                expected, deadline != nullptr ? deadline->get() : nullptr, nullptr,
+                                FUTEX_BITSET_MATCH_ANY);
+    return result == 0 || errno != ETIMEDOUT;
+}
+
+void OSInterface_LinuxFutex::wake(std::atomic<uint32_t>& word, const int count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE | FUTEX_PRIVATE_FLAG, count, nullptr, nullptr, 0);
+}
+
+void OSInterface_LinuxFutex::wakeAll(std::atomic<uint32_t>& word)
+{
+    wake(word, INT_MAX);
+}
+
+bool OSInterface_LinuxSpin::isUseful()
+{
+    static const bool multiCore = std::thread::hardware_concurrency() > 1;
+    return multiCore;
+}
@@ -0,0 +1,738 @@
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include "OSInterface_LinuxLockFreeQueue.h"
+
+static bool isPowerOfTwo(const uint32_t value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+OSInterface_LinuxSPSCQueue::OSInterface_LinuxSPSCQueue(const uint32_t maxMessages, const uint32_t messageSize) :
+    maxMessages(maxMessages), messageSize(messageSize), powerOfTwo(isPowerOfTwo(maxMessages)),
+    storage(new(std::nothrow) uint8_t[static_cast<size_t>(maxMessages) * messageSize])
+{
+#ifdef OSInterface_INSTRUMENTATION
+    notEmpty.instrument(&stats.wait);
+    notFull.instrument(&stats.sendWait);
+#endif
+}
+
+bool OSInterface_LinuxSPSCQueue::isValid() const
+{
+    return storage != nullptr && maxMessages > 0 && messageSize > 0;
+}
+
+size_t OSInterface_LinuxSPSCQueue::offsetOf(const uint64_t position) const
+{
+    const uint64_t slot = powerOfTwo ? position & (maxMessages - 1) : position % maxMessages;
+    return static_cast<size_t>(slot) * messageSize;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::length()
+{
+    // Load the head first so that a concurrent receive can never make the result negative
+    const uint64_t currentHead = head.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(tail.load(std::memory_order_acquire) - currentHead);
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::size()
+{
+    return maxMessages;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::available()
+{
+    return maxMessages - length();
+}
+
+bool OSInterface_LinuxSPSCQueue::isEmpty()
+{
+    return length() == 0;
+}
+
+bool OSInterface_LinuxSPSCQueue::isFull()
+{
+    return length() >= maxMessages;
+}
+
+void OSInterface_LinuxSPSCQueue::reset()
+{
+    cachedTail = tail.load(std::memory_order_acquire);
+    head.store(cachedTail, std::memory_order_release);
+    notFull.notifyAll();
+}
+
+uint8_t* OSInterface_LinuxSPSCQueue::tryReserveReceive()
+{
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    if (position == cachedTail)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (position == cachedTail)
+        {
+            return nullptr;
+        }
+    }
+    return &storage[offsetOf(position)];
+}
+
+uint8_t* OSInterface_LinuxSPSCQueue::tryReserveSend()
+{
+    const uint64_t position = tail.load(std::memory_order_relaxed);
+    if (position - cachedHead == maxMessages)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (position - cachedHead == maxMessages)
+        {
+            return nullptr;
+        }
+    }
+    return &storage[offsetOf(position)];
+}
+
+bool OSInterface_LinuxSPSCQueue::tryReceive(void* message)
+{
+    const uint8_t* slot = tryReserveReceive();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(message, slot, messageSize);
+    releaseReceive(slot);
+    return true;
+}
+
+bool OSInterface_LinuxSPSCQueue::trySend(const void* message)
+{
+    uint8_t* slot = tryReserveSend();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(slot, message, messageSize);
+    commitSend(slot);
+    return true;
+}
+
+bool OSInterface_LinuxSPSCQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notEmpty.await([this, message] { return tryReceive(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxSPSCQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return notEmpty.awaitFor([this, message] { return tryReceive(message); },
+                             maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxSPSCQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_LinuxSPSCQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notFull.await([this, message] { return trySend(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxSPSCQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return notFull.awaitFor([this, message] { return trySend(message); },
+                            maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxSPSCQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message);
+}
+
+bool OSInterface_LinuxSPSCQueue::sendToFront(const void* /*message*/, uint32_t /*maxTimeToWait_ms*/)
+{
+    return false;
+}
+
+bool OSInterface_LinuxSPSCQueue::sendToFrontFromISR(const void* /*message*/)
+{
+    return false;
+}
+
+void* OSInterface_LinuxSPSCQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    notFull.await(
+        [this, &slot]
+        {
+            slot = tryReserveSend();
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxSPSCQueue::commitSend(void* /*slot*/)
+{
+    const uint64_t position = tail.load(std::memory_order_relaxed) + 1;
+    tail.store(position, std::memory_order_release);
+#ifdef OSInterface_INSTRUMENTATION
+    stats.recordLength(static_cast<uint32_t>(position - head.load(std::memory_order_relaxed)));
+#endif
+    notEmpty.notifyOne();
+    notifyWaitSet();
+}
+
+const void* OSInterface_LinuxSPSCQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    notEmpty.await(
+        [this, &slot]
+        {
+            slot = tryReserveReceive();
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxSPSCQueue::releaseReceive(const void* /*slot*/)
+{
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    notFull.notifyOne();
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    if (cachedTail - position < count)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+    }
+    const auto received = static_cast<uint32_t>(std::min<uint64_t>(cachedTail - position, count));
+    for (uint32_t i = 0; i < received; i++)
+    {
+        memcpy(static_cast<uint8_t*>(messages) + static_cast<size_t>(i) * messageSize,
+               &storage[offsetOf(position + i)], messageSize);
+    }
+    if (received != 0)
+    {
+        head.store(position + received, std::memory_order_release);
+        notFull.notifyOne();
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::trySendN(const void* messages, const uint32_t count)
+{
+    const uint64_t position = tail.load(std::memory_order_relaxed);
+    if (maxMessages - (position - cachedHead) < count)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+    }
+    const uint32_t sent = std::min<uint32_t>(maxMessages - static_cast<uint32_t>(position - cachedHead), count);
+    for (uint32_t i = 0; i < sent; i++)
+    {
+        memcpy(&storage[offsetOf(position + i)],
+               static_cast<const uint8_t*>(messages) + static_cast<size_t>(i) * messageSize, messageSize);
+    }
+    if (sent != 0)
+    {
+        tail.store(position + sent, std::memory_order_release);
+#ifdef OSInterface_INSTRUMENTATION
+        stats.recordLength(static_cast<uint32_t>(position + sent - head.load(std::memory_order_relaxed)));
+#endif
+        notEmpty.notifyOne();
+        notifyWaitSet();
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                 const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        notFull.await(
+            [this, messages, count, &sent]
+            {
+                sent = trySendN(messages, count);
+                return sent != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                              const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        notEmpty.await(
+            [this, messages, maxMessages, &received]
+            {
+                received = tryReceiveN(messages, maxMessages);
+                return received != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    cachedTail              = tail.load(std::memory_order_acquire);
+    const auto drained      = static_cast<uint32_t>(cachedTail - position);
+    for (uint32_t i = 0; i < drained; i++)
+    {
+        callback(&storage[offsetOf(position + i)], arg);
+    }
+    if (drained != 0)
+    {
+        head.store(position + drained, std::memory_order_release);
+        notFull.notifyOne();
+    }
+    return drained;
+}
+
+uint32_t OSInterface_LinuxSPSCQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_LinuxSPSCQueue::pollReady()
+{
+    return !isEmpty();
+}
+
+OSInterface_LinuxMPMCQueue::OSInterface_LinuxMPMCQueue(const uint32_t maxMessages, const uint32_t messageSize) :
+    maxMessages(maxMessages), messageSize(messageSize), powerOfTwo(isPowerOfTwo(maxMessages)),
+    sequences(new(std::nothrow) std::atomic<uint64_t>[maxMessages]),
+    storage(new(std::nothrow) uint8_t[static_cast<size_t>(maxMessages) * messageSize])
+{
+#ifdef OSInterface_INSTRUMENTATION
+    notEmpty.instrument(&stats.wait);
+    notFull.instrument(&stats.sendWait);
+#endif
+    if (sequences != nullptr)
+    {
+        for (uint32_t i = 0; i < maxMessages; i++)
+        {
+            sequences[i].store(i, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool OSInterface_LinuxMPMCQueue::isValid() const
+{
+    return sequences != nullptr && storage != nullptr && maxMessages > 0 && messageSize > 0;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::slotOf(const uint64_t position) const
+{
+    return static_cast<uint32_t>(powerOfTwo ? position & (maxMessages - 1) : position % maxMessages);
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::length()
+{
+    const uint64_t dequeued = dequeuePosition.load(std::memory_order_acquire);
+    const uint64_t enqueued = enqueuePosition.load(std::memory_order_acquire);
+    // Positions are claimed before the slot is published, so the difference is only an estimate under contention
+    return enqueued > dequeued ? static_cast<uint32_t>(std::min<uint64_t>(enqueued - dequeued, maxMessages)) : 0;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::size()
+{
+    return maxMessages;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::available()
+{
+    return maxMessages - length();
+}
+
+bool OSInterface_LinuxMPMCQueue::isEmpty()
+{
+    return length() == 0;
+}
+
+bool OSInterface_LinuxMPMCQueue::isFull()
+{
+    return length() >= maxMessages;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::slotIndex(const void* address) const
+{
+    return static_cast<uint32_t>((static_cast<const uint8_t*>(address) - storage.get()) / messageSize);
+}
+
+void OSInterface_LinuxMPMCQueue::reset()
+{
+    const uint8_t* slot;
+    while ((slot = tryReserveReceive()) != nullptr)
+    {
+        releaseReceive(slot);
+    }
+}
+
+uint8_t* OSInterface_LinuxMPMCQueue::tryReserveReceive()
+{
+    uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const uint32_t slot       = slotOf(position);
+        const uint64_t ready      = sequences[slot].load(std::memory_order_acquire);
+        const auto     difference = static_cast<int64_t>(ready - (position + 1));
+        if (difference == 0)
+        {
+            if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                return &storage[static_cast<size_t>(slot) * messageSize];
+            }
+        }
+        else if (difference < 0)
+        {
+            return nullptr; // Empty
+        }
+        else
+        {
+            position = dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+uint8_t* OSInterface_LinuxMPMCQueue::tryReserveSend()
+{
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const uint32_t slot       = slotOf(position);
+        const uint64_t ready      = sequences[slot].load(std::memory_order_acquire);
+        const auto     difference = static_cast<int64_t>(ready - position);
+        if (difference == 0)
+        {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                return &storage[static_cast<size_t>(slot) * messageSize];
+            }
+        }
+        else if (difference < 0)
+        {
+            return nullptr; // Full
+        }
+        else
+        {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t OSInterface_LinuxMPMCQueue::tryReserveReceiveN(const uint32_t count, uint32_t& reserved)
+{
+    uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // A whole run of published slots is claimed with a single compare-and-swap on the position
+        reserved = 0;
+        while (reserved < count &&
+               sequences[slotOf(position + reserved)].load(std::memory_order_acquire) == position + reserved + 1)
+        {
+            reserved++;
+        }
+        if (reserved == 0)
+        {
+            const uint64_t ready = sequences[slotOf(position)].load(std::memory_order_acquire);
+            if (static_cast<int64_t>(ready - (position + 1)) < 0)
+            {
+                return position; // Empty
+            }
+            position = dequeuePosition.load(std::memory_order_relaxed);
+        }
+        else if (dequeuePosition.compare_exchange_weak(position, position + reserved, std::memory_order_relaxed))
+        {
+            return position;
+        }
+    }
+}
+
+uint64_t OSInterface_LinuxMPMCQueue::tryReserveSendN(const uint32_t count, uint32_t& reserved)
+{
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // A whole run of free slots is claimed with a single compare-and-swap on the position
+        reserved = 0;
+        while (reserved < count &&
+               sequences[slotOf(position + reserved)].load(std::memory_order_acquire) == position + reserved)
+        {
+            reserved++;
+        }
+        if (reserved == 0)
+        {
+            const uint64_t ready = sequences[slotOf(position)].load(std::memory_order_acquire);
+            if (static_cast<int64_t>(ready - position) < 0)
+            {
+                return position; // Full
+            }
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+        else if (enqueuePosition.compare_exchange_weak(position, position + reserved, std::memory_order_relaxed))
+        {
+            return position;
+        }
+    }
+}
+
+bool OSInterface_LinuxMPMCQueue::tryReceive(void* message)
+{
+    const uint8_t* slot = tryReserveReceive();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(message, slot, messageSize);
+    releaseReceive(slot);
+    return true;
+}
+
+bool OSInterface_LinuxMPMCQueue::trySend(const void* message)
+{
+    uint8_t* slot = tryReserveSend();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(slot, message, messageSize);
+    commitSend(slot);
+    return true;
+}
+
+bool OSInterface_LinuxMPMCQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notEmpty.await([this, message] { return tryReceive(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxMPMCQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return notEmpty.awaitFor([this, message] { return tryReceive(message); },
+                             maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxMPMCQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_LinuxMPMCQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notFull.await([this, message] { return trySend(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxMPMCQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return notFull.awaitFor([this, message] { return trySend(message); },
+                            maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxMPMCQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message);
+}
+
+bool OSInterface_LinuxMPMCQueue::sendToFront(const void* /*message*/, uint32_t /*maxTimeToWait_ms*/)
+{
+    return false;
+}
+
+bool OSInterface_LinuxMPMCQueue::sendToFrontFromISR(const void* /*message*/)
+{
+    return false;
+}
+
+void* OSInterface_LinuxMPMCQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    notFull.await(
+        [this, &slot]
+        {
+            slot = tryReserveSend();
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxMPMCQueue::commitSend(void* slot)
+{
+    // The sequence of a reserved slot still holds its position, only its owner can move it forward
+    std::atomic<uint64_t>& sequence = sequences[slotIndex(slot)];
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+#ifdef OSInterface_INSTRUMENTATION
+    recordLength();
+#endif
+    notEmpty.notifyOne();
+    notifyWaitSet();
+}
+
+const void* OSInterface_LinuxMPMCQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    notEmpty.await(
+        [this, &slot]
+        {
+            slot = tryReserveReceive();
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxMPMCQueue::releaseReceive(const void* slot)
+{
+    // Sequence is position + 1 while taken; make the slot writable for the producers of the next lap
+    std::atomic<uint64_t>& sequence = sequences[slotIndex(slot)];
+    sequence.store(sequence.load(std::memory_order_relaxed) - 1 + maxMessages, std::memory_order_release);
+    notFull.notifyOne();
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    uint32_t       received;
+    const uint64_t position = tryReserveReceiveN(count, received);
+    for (uint32_t i = 0; i < received; i++)
+    {
+        const uint32_t slot = slotOf(position + i);
+        memcpy(static_cast<uint8_t*>(messages) + static_cast<size_t>(i) * messageSize,
+               &storage[static_cast<size_t>(slot) * messageSize], messageSize);
+        sequences[slot].store(position + i + maxMessages, std::memory_order_release);
+    }
+    notFull.notifyBatch(received);
+    return received;
+}
+
+#ifdef OSInterface_INSTRUMENTATION
+void OSInterface_LinuxMPMCQueue::recordLength()
+{
+    // Both positions move concurrently, the difference is only an estimate
+    const uint64_t enqueued = enqueuePosition.load(std::memory_order_relaxed);
+    const uint64_t dequeued = dequeuePosition.load(std::memory_order_relaxed);
+    if (enqueued > dequeued)
+    {
+        stats.recordLength(static_cast<uint32_t>(std::min<uint64_t>(enqueued - dequeued, maxMessages)));
+    }
+}
+#endif
+
+uint32_t OSInterface_LinuxMPMCQueue::trySendN(const void* messages, const uint32_t count)
+{
+    uint32_t       sent;
+    const uint64_t position = tryReserveSendN(count, sent);
+    for (uint32_t i = 0; i < sent; i++)
+    {
+        const uint32_t slot = slotOf(position + i);
+        memcpy(&storage[static_cast<size_t>(slot) * messageSize],
+               static_cast<const uint8_t*>(messages) + static_cast<size_t>(i) * messageSize, messageSize);
+        sequences[slot].store(position + i + 1, std::memory_order_release);
+    }
+    if (sent != 0)
+    {
+#ifdef OSInterface_INSTRUMENTATION
+        recordLength();
+#endif
+        notEmpty.notifyBatch(sent);
+        notifyWaitSet();
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                 const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        notFull.await(
+            [this, messages, count, &sent]
+            {
+                sent = trySendN(messages, count);
+                return sent != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                              const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        notEmpty.await(
+            [this, messages, maxMessages, &received]
+            {
+                received = tryReceiveN(messages, maxMessages);
+                return received != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    const uint32_t limit   = length(); // Only drain what is queued now, even if the senders keep up
+    uint32_t       drained = 0;
+    while (drained < limit)
+    {
+        uint32_t       taken;
+        const uint64_t position = tryReserveReceiveN(limit - drained, taken);
+        if (taken == 0)
+        {
+            break;
+        }
+        for (uint32_t i = 0; i < taken; i++)
+        {
+            const uint32_t slot = slotOf(position + i);
+            callback(&storage[static_cast<size_t>(slot) * messageSize], arg);
+            sequences[slot].store(position + i + maxMessages, std::memory_order_release);
+        }
+        notFull.notifyBatch(taken);
+        drained += taken;
+    }
+    return drained;
+}
+
+uint32_t OSInterface_LinuxMPMCQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_LinuxMPMCQueue::pollReady()
+{
+    // Unlike length(), only count a message once it is published, not when its position is claimed
+    const uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+    return sequences[slotOf(position)].load(std::memory_order_acquire) == position + 1;
+}
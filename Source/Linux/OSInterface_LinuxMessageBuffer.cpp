@@ -0,0 +1,193 @@
+#include <cstring>
+#include <mutex>
+#include "OSInterface_LinuxMessageBuffer.h"
+
+uint32_t OSInterface_LinuxMessageBuffer::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::available()
+{
+    std::lock_guard guard(lock);
+    return ring.available();
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::maxMessageLength()
+{
+    return ring.maxMessageLength();
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::nextLength()
+{
+    std::lock_guard guard(lock);
+    uint32_t        length = 0;
+    ring.front(length);
+    return length;
+}
+
+bool OSInterface_LinuxMessageBuffer::isEmpty()
+{
+    std::lock_guard guard(lock);
+    return ring.isEmpty();
+}
+
+void OSInterface_LinuxMessageBuffer::reset()
+{
+    {
+        std::lock_guard guard(lock);
+        ring.reset();
+    }
+    notFull.notifyAll();
+}
+
+bool OSInterface_LinuxMessageBuffer::trySend(const void* message, const uint32_t length)
+{
+    {
+        std::lock_guard guard(lock);
+        uint8_t*        destination = ring.reserve(length, true);
+        if (destination == nullptr)
+        {
+            return false;
+        }
+        memcpy(destination, message, length);
+    }
+    notEmpty.notifyOne();
+    return true;
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::tryReceive(void* buffer, const uint32_t bufferSize)
+{
+    uint32_t length;
+    {
+        std::lock_guard guard(lock);
+        const uint8_t*  message = ring.front(length);
+        if (message == nullptr)
+        {
+            return 0;
+        }
+        if (length > bufferSize)
+        {
+            return TOO_LONG;
+        }
+        memcpy(buffer, message, length);
+        ring.release(message);
+    }
+    // The room freed may fit several short messages, or only the long message of another sender
+    notFull.notifyAll();
+    return length;
+}
+
+bool OSInterface_LinuxMessageBuffer::send(const void* message, const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    if (length == 0 || length > ring.maxMessageLength())
+    {
+        return false;
+    }
+    return notFull.await([this, message, length] { return trySend(message, length); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxMessageBuffer::sendFromISR(const void* message, const uint32_t length)
+{
+    return trySend(message, length);
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::receive(void* buffer, const uint32_t bufferSize,
+                                                 const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    notEmpty.await(
+        [this, buffer, bufferSize, &received]
+        {
+            received = tryReceive(buffer, bufferSize);
+            return received != 0;
+        },
+        maxTimeToWait_ms);
+    if (received == TOO_LONG)
+    {
+        // The message stays for another receiver, which may have been waiting for it
+        notEmpty.notifyOne();
+        return 0;
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxMessageBuffer::receiveFromISR(void* buffer, const uint32_t bufferSize)
+{
+    const uint32_t received = tryReceive(buffer, bufferSize);
+    return received == TOO_LONG ? 0 : received;
+}
+
+void* OSInterface_LinuxMessageBuffer::tryAcquireSend(const uint32_t length)
+{
+    std::lock_guard guard(lock);
+    return ring.reserve(length, false);
+}
+
+void* OSInterface_LinuxMessageBuffer::acquireSend(const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    void* message = nullptr;
+    if (length != 0 && length <= ring.maxMessageLength())
+    {
+        notFull.await(
+            [this, length, &message]
+            {
+                message = tryAcquireSend(length);
+                return message != nullptr;
+            },
+            maxTimeToWait_ms);
+    }
+    return message;
+}
+
+void* OSInterface_LinuxMessageBuffer::acquireSendFromISR(const uint32_t length)
+{
+    return tryAcquireSend(length);
+}
+
+void OSInterface_LinuxMessageBuffer::commitSend(void* message)
+{
+    {
+        std::lock_guard guard(lock);
+        ring.commit(message);
+    }
+    notEmpty.notifyOne();
+}
+
+const void* OSInterface_LinuxMessageBuffer::tryPeekReceive(uint32_t& length)
+{
+    std::lock_guard guard(lock);
+    const uint8_t*  message = ring.front(length);
+    if (message != nullptr)
+    {
+        ring.take(message);
+    }
+    return message;
+}
+
+const void* OSInterface_LinuxMessageBuffer::peekReceive(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    const void* message = nullptr;
+    notEmpty.await(
+        [this, &length, &message]
+        {
+            message = tryPeekReceive(length);
+            return message != nullptr;
+        },
+        maxTimeToWait_ms);
+    return message;
+}
+
+const void* OSInterface_LinuxMessageBuffer::peekReceiveFromISR(uint32_t& length)
+{
+    return tryPeekReceive(length);
+}
+
+void OSInterface_LinuxMessageBuffer::releaseReceive(const void* message)
+{
+    {
+        std::lock_guard guard(lock);
+        ring.release(message);
+    }
+    notFull.notifyAll();
+}
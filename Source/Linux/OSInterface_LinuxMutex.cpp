@@ -0,0 +1,98 @@
+#include <algorithm>
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_LinuxFutex.h"
+
+bool OSInterface_LinuxMutex::spin()
+{
+    if (!adaptive || !OSInterface_LinuxSpin::isUseful())
+    {
+        return false;
+    }
+
+    const uint32_t estimate = spinEstimate.load(std::memory_order_relaxed);
+    const uint32_t limit    = std::min(MAX_SPINS, 2 * estimate + MIN_SPINS);
+    uint32_t       spins    = 0;
+    bool           acquired = false;
+    while (!acquired && spins < limit)
+    {
+        spins++;
+        OSInterface_LinuxSpin::pause();
+        uint32_t current = state.load(std::memory_order_relaxed);
+        if (current == UNLOCKED)
+        {
+            acquired =
+                state.compare_exchange_weak(current, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+    }
+    // Moving average over about 8 contended locks
+    spinEstimate.store(static_cast<uint32_t>(static_cast<int32_t>(estimate) +
+                                             (static_cast<int32_t>(spins) - static_cast<int32_t>(estimate)) / 8),
+                       std::memory_order_relaxed);
+    return acquired;
+}
+
+bool OSInterface_LinuxMutex::waitContended(const uint32_t current, const uint64_t timeout_ns)
+{
+#ifdef OSInterface_INSTRUMENTATION
+    const uint64_t start  = OSInterface_LinuxClock::nowNanos();
+    const bool     result = sleepContended(current, timeout_ns);
+    stats.wait.record(timeout_ns, OSInterface_LinuxClock::nowNanos() - start, result);
+    return result;
+#else
+    return sleepContended(current, timeout_ns);
+#endif
+}
+
+bool OSInterface_LinuxMutex::sleepContended(uint32_t current, const uint64_t timeout_ns)
+{
+    if (timeout_ns == 0)
+    {
+        return false;
+    }
+    if (spin())
+    {
+        return true;
+    }
+
+    const OSInterface_LinuxDeadline deadline = OSInterface_LinuxDeadline::after(timeout_ns);
+    if (current != CONTENDED)
+    {
+        current = state.exchange(CONTENDED, std::memory_order_acquire);
+    }
+    while (current != UNLOCKED)
+    {
+        if (!OSInterface_LinuxFutex::wait(state, CONTENDED, &deadline))
+        {
+            return false;
+        }
+        current = state.exchange(CONTENDED, std::memory_order_acquire);
+    }
+    return true;
+}
+
+void OSInterface_LinuxMutex::lockContended(uint32_t current)
+{
+#ifdef OSInterface_INSTRUMENTATION
+    const uint64_t start = OSInterface_LinuxClock::nowNanos();
+#endif
+    if (!spin())
+    {
+        if (current != CONTENDED)
+        {
+            current = state.exchange(CONTENDED, std::memory_order_acquire);
+        }
+        while (current != UNLOCKED)
+        {
+            OSInterface_LinuxFutex::wait(state, CONTENDED, nullptr);
+            current = state.exchange(CONTENDED, std::memory_order_acquire);
+        }
+    }
+#ifdef OSInterface_INSTRUMENTATION
+    stats.wait.record(UINT64_MAX, OSInterface_LinuxClock::nowNanos() - start, true);
+#endif
+}
+
+void OSInterface_LinuxMutex::wakeOne()
+{
+    OSInterface_LinuxFutex::wake(state, 1);
+}
@@ -0,0 +1,349 @@
+#include <cstring>
+#include <mutex>
+#include "OSInterface_LinuxPriorityQueue.h"
+
+uint32_t OSInterface_LinuxPriorityQueue::priorityLevels()
+{
+    return ring.levelCount();
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::length(const uint32_t priority)
+{
+    std::lock_guard guard(lock);
+    return ring.length(priority);
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::length()
+{
+    std::lock_guard guard(lock);
+    return ring.length();
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::available()
+{
+    std::lock_guard guard(lock);
+    return ring.available();
+}
+
+bool OSInterface_LinuxPriorityQueue::isEmpty()
+{
+    return length() == 0;
+}
+
+bool OSInterface_LinuxPriorityQueue::isFull()
+{
+    return available() == 0;
+}
+
+void OSInterface_LinuxPriorityQueue::reset()
+{
+    {
+        std::lock_guard guard(lock);
+        ring.reset();
+    }
+    for (uint32_t level = 0; level < ring.levelCount(); level++)
+    {
+        notFull[level].notifyAll();
+    }
+}
+
+void OSInterface_LinuxPriorityQueue::slotFreed(const void* slot)
+{
+    // The level is fixed by the address of the slot, no need for the lock
+    notFull[ring.levelOf(slot)].notifyOne();
+}
+
+bool OSInterface_LinuxPriorityQueue::tryReceive(void* message)
+{
+    const uint8_t* slot;
+    {
+        std::lock_guard guard(lock);
+        slot = ring.take();
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        memcpy(message, slot, ring.messageLength());
+        ring.release(slot);
+    }
+    slotFreed(slot);
+    return true;
+}
+
+bool OSInterface_LinuxPriorityQueue::trySend(const void* message, const uint32_t priority, const bool toFront)
+{
+    {
+        std::lock_guard guard(lock);
+        uint8_t*        slot = ring.reserve(priority);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        memcpy(slot, message, ring.messageLength());
+        ring.queue(slot, toFront);
+#ifdef OSInterface_INSTRUMENTATION
+        stats.recordLength(ring.length());
+#endif
+    }
+    notEmpty.notifyOne();
+    notifyWaitSet();
+    return true;
+}
+
+bool OSInterface_LinuxPriorityQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notEmpty.await([this, message] { return tryReceive(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxPriorityQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return notEmpty.awaitFor([this, message] { return tryReceive(message); },
+                             maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxPriorityQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendFor(const void* message, const uint32_t priority, const uint64_t timeout_ns,
+                                             const bool toFront)
+{
+    if (priority >= ring.levelCount())
+    {
+        return false;
+    }
+    return notFull[priority].awaitFor(
+        [this, message, priority, toFront] { return trySend(message, priority, toFront); }, timeout_ns);
+}
+
+bool OSInterface_LinuxPriorityQueue::send(const void* message, const uint32_t priority,
+                                          const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, priority, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendMicros(const void* message, const uint32_t priority,
+                                                const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, priority, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendFromISR(const void* message, const uint32_t priority)
+{
+    return trySend(message, priority, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, 0, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, 0, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message, 0, false);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToFront(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, ring.levelCount() - 1, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI, true);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToFrontMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, ring.levelCount() - 1, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO, true);
+}
+
+bool OSInterface_LinuxPriorityQueue::sendToFrontFromISR(const void* message)
+{
+    return trySend(message, ring.levelCount() - 1, true);
+}
+
+void* OSInterface_LinuxPriorityQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    notFull[0].await(
+        [this, &slot]
+        {
+            std::lock_guard guard(lock);
+            slot = ring.reserve(0);
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxPriorityQueue::commitSend(void* slot)
+{
+    {
+        std::lock_guard guard(lock);
+        ring.queue(slot, false);
+#ifdef OSInterface_INSTRUMENTATION
+        stats.recordLength(ring.length());
+#endif
+    }
+    notEmpty.notifyOne();
+    notifyWaitSet();
+}
+
+const void* OSInterface_LinuxPriorityQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    notEmpty.await(
+        [this, &slot]
+        {
+            std::lock_guard guard(lock);
+            slot = ring.take();
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxPriorityQueue::releaseReceive(const void* slot)
+{
+    {
+        std::lock_guard guard(lock);
+        ring.release(slot);
+    }
+    slotFreed(slot);
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    uint32_t received = 0;
+    uint32_t freed[MAX_PRIORITY_LEVELS]{}; // Slots freed per level
+    {
+        std::lock_guard guard(lock);
+        const uint8_t*  slot;
+        while (received < count && (slot = ring.take()) != nullptr)
+        {
+            memcpy(static_cast<uint8_t*>(messages) + static_cast<size_t>(received) * ring.messageLength(), slot,
+                   ring.messageLength());
+            ring.release(slot);
+            freed[ring.levelOf(slot)]++;
+            received++;
+        }
+    }
+    for (uint32_t level = 0; level < ring.levelCount(); level++)
+    {
+        notFull[level].notifyBatch(freed[level]);
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::trySendN(const void* messages, const uint32_t count)
+{
+    uint32_t sent = 0;
+    {
+        std::lock_guard guard(lock);
+        uint8_t*        slot;
+        while (sent < count && (slot = ring.reserve(0)) != nullptr)
+        {
+            memcpy(slot, static_cast<const uint8_t*>(messages) + static_cast<size_t>(sent) * ring.messageLength(),
+                   ring.messageLength());
+            ring.queue(slot, false);
+            sent++;
+        }
+#ifdef OSInterface_INSTRUMENTATION
+        stats.recordLength(ring.length());
+#endif
+    }
+    if (sent != 0)
+    {
+        notEmpty.notifyBatch(sent);
+        notifyWaitSet();
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                     const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        notFull[0].await(
+            [this, messages, count, &sent]
+            {
+                sent = trySendN(messages, count);
+                return sent != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                                  const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        notEmpty.await(
+            [this, messages, maxMessages, &received]
+            {
+                received = tryReceiveN(messages, maxMessages);
+                return received != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    uint32_t limit;
+    {
+        std::lock_guard guard(lock);
+        limit = ring.length(); // Only drain what is queued now, even if the senders keep up
+    }
+    uint32_t drained = 0;
+    while (drained < limit)
+    {
+        // Each message is taken and visited on its own, a more urgent one sent meanwhile is visited next
+        const uint8_t* slot;
+        {
+            std::lock_guard guard(lock);
+            slot = ring.take();
+        }
+        if (slot == nullptr)
+        {
+            break;
+        }
+        callback(slot, arg);
+        releaseReceive(slot);
+        drained++;
+    }
+    return drained;
+}
+
+uint32_t OSInterface_LinuxPriorityQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_LinuxPriorityQueue::pollReady()
+{
+    return !isEmpty();
+}
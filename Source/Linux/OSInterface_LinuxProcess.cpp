@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxProcess.h"
+
+static const char* TAG = "OSInterface_Linux";
+
+OSInterface_LinuxProcess::OSInterface_LinuxProcess(const OSInterfaceProcess process, void* arg) :
+    process(process), arg(arg)
+{
+}
+
+OSInterface_LinuxProcess::~OSInterface_LinuxProcess()
+{
+    if (started)
+    {
+        pthread_join(thread, nullptr);
+    }
+    if (stackMapping != nullptr)
+    {
+        munmap(stackMapping, stackMappingSize);
+    }
+}
+
+bool OSInterface_LinuxProcess::start(const OSInterface_ProcessAttributes& attributes)
+{
+    if (attributes.name != nullptr)
+    {
+        strncpy(name, attributes.name, sizeof(name) - 1);
+    }
+    pthread_attr_t threadAttributes;
+    if (pthread_attr_init(&threadAttributes) != 0)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': no memory for its attributes", name);
+        return false;
+    }
+    if (setAttributes(threadAttributes, attributes))
+    {
+        const int error = pthread_create(&thread, &threadAttributes, run, this);
+        if (error == 0)
+        {
+            started = true;
+        }
+        else if (error == EPERM)
+        {
+            OSInterfaceLogError(TAG, "Could not start process '%s': not allowed to use its scheduling policy", name);
+        }
+        else
+        {
+            OSInterfaceLogError(TAG, "Could not start process '%s': %s", name, strerror(error));
+        }
+    }
+    pthread_attr_destroy(&threadAttributes);
+    return started;
+}
+
+void OSInterface_LinuxProcess::join()
+{
+    joinUntil(nullptr);
+}
+
+bool OSInterface_LinuxProcess::join(const uint32_t maxTimeToWait_ms)
+{
+    if (maxTimeToWait_ms == 0)
+    {
+        return isDone();
+    }
+    const OSInterface_LinuxDeadline deadline(maxTimeToWait_ms);
+    return joinUntil(&deadline);
+}
+
+bool OSInterface_LinuxProcess::isDone()
+{
+    return state.load(std::memory_order_acquire) == DONE;
+}
+
+void* OSInterface_LinuxProcess::run(void* self)
+{
+    auto* handle = static_cast<OSInterface_LinuxProcess*>(self);
+    if (handle->name[0] != '\0')
+    {
+        pthread_setname_np(pthread_self(), handle->name);
+    }
+    handle->process(handle->arg);
+    // The destructor joins the thread, so the handle outlives this call
+    if (handle->state.exchange(DONE, std::memory_order_acq_rel) == WAITED)
+    {
+        OSInterface_LinuxFutex::wakeAll(handle->state);
+    }
+    return nullptr;
+}
+
+bool OSInterface_LinuxProcess::setAttributes(pthread_attr_t& threadAttributes,
+                                             const OSInterface_ProcessAttributes& attributes)
+{
+    if (attributes.affinityMask != 0)
+    {
+        // CPUs that do not exist make pthread_create() fail with EINVAL
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (uint32_t cpu = 0; cpu < 64; cpu++)
+        {
+            if ((attributes.affinityMask >> cpu & 1) != 0)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        if (pthread_attr_setaffinity_np(&threadAttributes, sizeof(cpus), &cpus) != 0)
+        {
+            OSInterfaceLogError(TAG, "Could not start process '%s': invalid CPU affinity", name);
+            return false;
+        }
+    }
+
+    if (attributes.policy != OSInterface_ProcessAttributes::INHERIT)
+    {
+        const bool  realTime = attributes.policy == OSInterface_ProcessAttributes::REAL_TIME;
+        sched_param parameters{};
+        parameters.sched_priority = realTime ? attributes.priority : 0;
+        if (pthread_attr_setinheritsched(&threadAttributes, PTHREAD_EXPLICIT_SCHED) != 0 ||
+            pthread_attr_setschedpolicy(&threadAttributes, realTime ? SCHED_FIFO : SCHED_OTHER) != 0 ||
+            pthread_attr_setschedparam(&threadAttributes, &parameters) != 0)
+        {
+            OSInterfaceLogError(TAG, "Could not start process '%s': invalid priority %d", name,
+                                static_cast<int>(attributes.priority));
+            return false;
+        }
+    }
+
+    size_t stackSize = attributes.stackSize;
+    if (stackSize == 0 && !attributes.lockedStack)
+    {
+        return true;
+    }
+    if (stackSize == 0)
+    {
+        pthread_attr_getstacksize(&threadAttributes, &stackSize);
+    }
+    const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    stackSize       = (std::max<size_t>(stackSize, PTHREAD_STACK_MIN) + page - 1) / page * page;
+    if (attributes.lockedStack)
+    {
+        return mapLockedStack(threadAttributes, stackSize);
+    }
+    if (pthread_attr_setstacksize(&threadAttributes, stackSize) != 0)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': invalid stack size %zu", name, stackSize);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Map a stack with a guard page below it, and lock it in memory
+ *
+ * @param size Size of the stack in bytes, a multiple of the page size
+ */
+bool OSInterface_LinuxProcess::mapLockedStack(pthread_attr_t& threadAttributes, const size_t size)
+{
+    const auto page  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void*      pages = mmap(nullptr, page + size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1,
+                            0);
+    if (pages == MAP_FAILED)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': no memory for a stack of %zu bytes", name, size);
+        return false;
+    }
+    // Unmapped by the destructor, including on failure
+    stackMapping     = pages;
+    stackMappingSize = page + size;
+    void* stack      = static_cast<uint8_t*>(pages) + page;
+    if (mprotect(pages, page, PROT_NONE) != 0)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': could not protect its stack guard page", name);
+        return false;
+    }
+    // mlock() faults every page in before returning
+    if (mlock(stack, size) != 0)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': could not lock a stack of %zu bytes (RLIMIT_MEMLOCK)",
+                            name, size);
+        return false;
+    }
+    if (pthread_attr_setstack(&threadAttributes, stack, size) != 0)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': invalid stack size %zu", name, size);
+        return false;
+    }
+    return true;
+}
+
+bool OSInterface_LinuxProcess::joinUntil(const OSInterface_LinuxDeadline* deadline)
+{
+    uint32_t current = state.load(std::memory_order_acquire);
+    while (current != DONE)
+    {
+        if (current == RUNNING &&
+            !state.compare_exchange_weak(current, WAITED, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            continue;
+        }
+        if (!OSInterface_LinuxFutex::wait(state, WAITED, deadline))
+        {
+            return isDone();
+        }
+        current = state.load(std::memory_order_acquire);
+    }
+    return true;
+}
@@ -0,0 +1,57 @@
+#include "OSInterface_LinuxRWLock.h"
+
+uint32_t OSInterface_LinuxRWLock::threadSlot()
+{
+    static std::atomic<uint32_t> nextSlot{0};
+    static thread_local uint32_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed) % READER_SLOTS;
+    return slot;
+}
+
+bool OSInterface_LinuxRWLock::readContended(ReaderSlot& slot, const uint64_t timeout_ns)
+{
+    return writerGone.awaitFor([this, &slot] { return writer.load(std::memory_order_acquire) == 0 && tryRead(slot); },
+                               timeout_ns);
+}
+
+bool OSInterface_LinuxRWLock::hasReaders() const
+{
+    for (const ReaderSlot& slot : slots)
+    {
+        if (slot.readers.load(std::memory_order_seq_cst) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OSInterface_LinuxRWLock::writeFor(const uint64_t timeout_ns)
+{
+    uint64_t remaining_ns = timeout_ns;
+    if (!writerLock.waitFor(0))
+    {
+        // The timeout covers waiting for the other writers and then for the readers
+        const uint64_t start = OSInterface_LinuxClock::nowNanos();
+        if (!writerLock.waitFor(timeout_ns))
+        {
+            return false;
+        }
+        const uint64_t elapsed = OSInterface_LinuxClock::nowNanos() - start;
+        remaining_ns           = elapsed < timeout_ns ? timeout_ns - elapsed : 0;
+    }
+
+    writer.store(1, std::memory_order_seq_cst);
+    if (!readersGone.awaitFor([this] { return !hasReaders(); }, remaining_ns))
+    {
+        signalWrite();
+        return false;
+    }
+    return true;
+}
+
+void OSInterface_LinuxRWLock::signalWrite()
+{
+    writer.store(0, std::memory_order_seq_cst);
+    writerGone.notifyAll();
+    writerLock.unlock();
+}
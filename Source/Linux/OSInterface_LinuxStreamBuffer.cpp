@@ -0,0 +1,202 @@
+#include <mutex>
+#include "OSInterface_LinuxStreamBuffer.h"
+
+uint32_t OSInterface_LinuxStreamBuffer::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::length()
+{
+    std::lock_guard guard(lock);
+    return ring.length();
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::available()
+{
+    std::lock_guard guard(lock);
+    return ring.available();
+}
+
+bool OSInterface_LinuxStreamBuffer::setTriggerLevel(const uint32_t triggerLevel)
+{
+    if (triggerLevel > ring.size())
+    {
+        return false;
+    }
+    bool triggered;
+    {
+        std::lock_guard guard(lock);
+        this->triggerLevel = triggerLevel == 0 ? 1 : triggerLevel;
+        triggered          = ring.length() >= this->triggerLevel;
+    }
+    // A lower level may release a waiting reader
+    sent(triggered);
+    return true;
+}
+
+void OSInterface_LinuxStreamBuffer::reset()
+{
+    {
+        std::lock_guard guard(lock);
+        ring.reset();
+    }
+    notFull.notifyAll();
+}
+
+void OSInterface_LinuxStreamBuffer::sent(const bool triggered)
+{
+    if (triggered)
+    {
+        notEmpty.notifyOne();
+    }
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::trySend(const void* data, const uint32_t length)
+{
+    uint32_t written;
+    bool     triggered;
+    {
+        std::lock_guard guard(lock);
+        written   = ring.write(data, length);
+        triggered = written != 0 && ring.length() >= triggerLevel;
+    }
+    sent(triggered);
+    return written;
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::tryReceive(void* buffer, const uint32_t maxLength, const bool triggeredOnly)
+{
+    uint32_t received;
+    {
+        std::lock_guard guard(lock);
+        if (triggeredOnly && ring.length() < triggerLevel)
+        {
+            return 0;
+        }
+        received = ring.read(buffer, maxLength);
+    }
+    if (received != 0)
+    {
+        notFull.notifyOne();
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::send(const void* data, const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint32_t    total = 0;
+    notFull.await(
+        [this, bytes, length, &total]
+        {
+            total += trySend(bytes + total, length - total);
+            return total == length;
+        },
+        maxTimeToWait_ms);
+    return total;
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::sendFromISR(const void* data, const uint32_t length)
+{
+    return trySend(data, length);
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::receive(void* buffer, const uint32_t maxLength, const uint32_t maxTimeToWait_ms)
+{
+    if (maxLength == 0)
+    {
+        return 0;
+    }
+    uint32_t   received  = 0;
+    const bool triggered = notEmpty.await(
+        [this, buffer, maxLength, &received]
+        {
+            received = tryReceive(buffer, maxLength, true);
+            return received != 0;
+        },
+        maxTimeToWait_ms);
+    return triggered ? received : tryReceive(buffer, maxLength, false);
+}
+
+uint32_t OSInterface_LinuxStreamBuffer::receiveFromISR(void* buffer, const uint32_t maxLength)
+{
+    return tryReceive(buffer, maxLength, false);
+}
+
+void* OSInterface_LinuxStreamBuffer::tryAcquireSend(uint32_t& length)
+{
+    std::lock_guard guard(lock);
+    uint8_t*        view = ring.writeView(length);
+    return length != 0 ? view : nullptr;
+}
+
+void* OSInterface_LinuxStreamBuffer::acquireSend(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    void* view = nullptr;
+    notFull.await(
+        [this, &length, &view]
+        {
+            view = tryAcquireSend(length);
+            return view != nullptr;
+        },
+        maxTimeToWait_ms);
+    return view;
+}
+
+void* OSInterface_LinuxStreamBuffer::acquireSendFromISR(uint32_t& length)
+{
+    return tryAcquireSend(length);
+}
+
+void OSInterface_LinuxStreamBuffer::commitSend(const uint32_t written)
+{
+    bool triggered;
+    {
+        std::lock_guard guard(lock);
+        ring.commitWrite(written);
+        triggered = written != 0 && ring.length() >= triggerLevel;
+    }
+    sent(triggered);
+}
+
+const void* OSInterface_LinuxStreamBuffer::tryPeekReceive(uint32_t& length, const bool triggeredOnly)
+{
+    std::lock_guard guard(lock);
+    if (ring.length() == 0 || (triggeredOnly && ring.length() < triggerLevel))
+    {
+        length = 0;
+        return nullptr;
+    }
+    return ring.readView(length);
+}
+
+const void* OSInterface_LinuxStreamBuffer::peekReceive(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    const void* view      = nullptr;
+    const bool  triggered = notEmpty.await(
+        [this, &length, &view]
+        {
+            view = tryPeekReceive(length, true);
+            return view != nullptr;
+        },
+        maxTimeToWait_ms);
+    return triggered ? view : tryPeekReceive(length, false);
+}
+
+const void* OSInterface_LinuxStreamBuffer::peekReceiveFromISR(uint32_t& length)
+{
+    return tryPeekReceive(length, false);
+}
+
+void OSInterface_LinuxStreamBuffer::releaseReceive(const uint32_t consumed)
+{
+    {
+        std::lock_guard guard(lock);
+        ring.consume(consumed);
+    }
+    if (consumed != 0)
+    {
+        notFull.notifyOne();
+    }
+}
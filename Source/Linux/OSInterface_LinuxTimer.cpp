@@ -0,0 +1,385 @@
+#include <bit>
+#include <mutex>
+#include <pthread.h>
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxTimer.h"
+
+OSInterface_LinuxTimer::OSInterface_LinuxTimer(OSInterface_LinuxTimerService& service, const uint32_t period,
+                                               const Mode mode, const OSInterfaceProcess callback, void* callbackArg,
+                                               const char* timerName) :
+    service(service), mode(mode), callback(callback), callbackArg(callbackArg), name(timerName), period_ms(period)
+{
+}
+
+OSInterface_LinuxTimer::~OSInterface_LinuxTimer()
+{
+    service.remove(*this);
+}
+
+bool OSInterface_LinuxTimer::start()
+{
+    service.arm(*this);
+    return true;
+}
+
+bool OSInterface_LinuxTimer::startFromISR()
+{
+    return start();
+}
+
+bool OSInterface_LinuxTimer::stop()
+{
+    service.disarm(*this);
+    return true;
+}
+
+bool OSInterface_LinuxTimer::stopFromISR()
+{
+    return stop();
+}
+
+bool OSInterface_LinuxTimer::isRunning() const
+{
+    return running.load(std::memory_order_acquire);
+}
+
+bool OSInterface_LinuxTimer::setPeriod(const uint32_t newPeriod_ms)
+{
+    if (newPeriod_ms == 0)
+    {
+        return false;
+    }
+    period_ms.store(newPeriod_ms, std::memory_order_relaxed);
+    service.arm(*this);
+    return true;
+}
+
+bool OSInterface_LinuxTimer::setPeriodFromISR(const uint32_t newPeriod_ms)
+{
+    return setPeriod(newPeriod_ms);
+}
+
+uint32_t OSInterface_LinuxTimer::getPeriod() const
+{
+    return period_ms.load(std::memory_order_relaxed);
+}
+
+OSInterface_Timer::Mode OSInterface_LinuxTimer::getMode() const
+{
+    return mode;
+}
+
+uint32_t OSInterface_LinuxTimer::getTimeout() const
+{
+    const uint64_t expiry = expiry_ns.load(std::memory_order_relaxed);
+    const uint64_t now    = OSInterface_LinuxClock::nowNanos();
+    return expiry > now ? static_cast<uint32_t>((expiry - now) / OSInterface_LinuxClock::NANOS_PER_MILLI) : 0;
+}
+
+uint32_t OSInterface_LinuxTimer::getTimeoutTime() const
+{
+    return static_cast<uint32_t>(getTimeoutTime64());
+}
+
+uint64_t OSInterface_LinuxTimer::getTimeoutTime64() const
+{
+    return expiry_ns.load(std::memory_order_relaxed) / OSInterface_LinuxClock::NANOS_PER_MILLI;
+}
+
+const char* OSInterface_LinuxTimer::getName() const
+{
+    return name;
+}
+
+void OSInterface_LinuxTimer::setSlack(const uint32_t newSlack_ms)
+{
+    slack_ms.store(newSlack_ms, std::memory_order_relaxed);
+}
+
+uint32_t OSInterface_LinuxTimer::getSlack() const
+{
+    return slack_ms.load(std::memory_order_relaxed);
+}
+
+bool OSInterface_LinuxTimer::pollReady()
+{
+    return expired.exchange(false, std::memory_order_acq_rel);
+}
+
+void OSInterface_LinuxTimer::expire()
+{
+    if (isInWaitSet())
+    {
+        expired.store(true, std::memory_order_seq_cst);
+        notifyWaitSet();
+    }
+    callback(callbackArg);
+}
+
+OSInterface_LinuxTimerService::OSInterface_LinuxTimerService() :
+    wheelTick(currentTick()), dispatcher(&OSInterface_LinuxTimerService::run, this)
+{
+    pthread_setname_np(dispatcher.native_handle(), "OSInterfaceTmr");
+}
+
+OSInterface_LinuxTimerService::~OSInterface_LinuxTimerService()
+{
+    {
+        std::lock_guard guard(lock);
+        stopping = true;
+        wakeSequence.fetch_add(1, std::memory_order_release);
+    }
+    OSInterface_LinuxFutex::wakeAll(wakeSequence);
+    dispatcher.join();
+}
+
+uint64_t OSInterface_LinuxTimerService::currentTick()
+{
+    return OSInterface_LinuxClock::nowMillis();
+}
+
+uint64_t OSInterface_LinuxTimerService::tickOf(const uint64_t time_ns)
+{
+    // Round up, a timer must never expire early
+    return (time_ns + OSInterface_LinuxClock::NANOS_PER_MILLI - 1) / OSInterface_LinuxClock::NANOS_PER_MILLI;
+}
+
+uint64_t OSInterface_LinuxTimerService::applySlack(const uint64_t tick, const uint32_t slack_ms)
+{
+    if (slack_ms == 0)
+    {
+        return tick;
+    }
+    // Pick the tick in [tick, tick + slack] with the most trailing zeros, timers with overlapping windows agree on it
+    const uint64_t limit = tick + slack_ms;
+    const int      bit   = std::bit_width(tick ^ limit) - 1;
+    return limit & ~((UINT64_C(1) << bit) - 1);
+}
+
+void OSInterface_LinuxTimerService::armLocked(OSInterface_LinuxTimer& timer, const uint64_t expiry_ns)
+{
+    unlink(timer);
+    timer.expiry_ns.store(expiry_ns, std::memory_order_relaxed);
+    timer.running.store(true, std::memory_order_release);
+    link(timer, applySlack(tickOf(expiry_ns), timer.slack_ms.load(std::memory_order_relaxed)));
+}
+
+void OSInterface_LinuxTimerService::disarmLocked(OSInterface_LinuxTimer& timer)
+{
+    unlink(timer);
+    timer.running.store(false, std::memory_order_release);
+}
+
+void OSInterface_LinuxTimerService::link(OSInterface_LinuxTimer& timer, const uint64_t tick)
+{
+    const uint64_t expiry = tick > wheelTick ? tick : wheelTick;
+    // The highest bit that differs from the current tick selects the level, the expiry's digit at that level the slot
+    const auto     differingBits = static_cast<uint32_t>(std::bit_width(expiry ^ wheelTick));
+    const uint32_t level = differingBits == 0 ? 0 : std::min((differingBits - 1) / WHEEL_LEVEL_BITS, WHEEL_LEVELS - 1);
+    const auto     slot  = static_cast<uint32_t>(expiry >> (level * WHEEL_LEVEL_BITS)) & (WHEEL_SLOTS - 1);
+    const uint32_t index = level * WHEEL_SLOTS + slot;
+
+    timer.wheelExpiry   = expiry;
+    timer.wheelSlot     = index;
+    timer.wheelPrevious = nullptr;
+    timer.wheelNext     = slots[index];
+    if (slots[index] != nullptr)
+    {
+        slots[index]->wheelPrevious = &timer;
+    }
+    slots[index] = &timer;
+    occupied[level] |= UINT64_C(1) << slot;
+}
+
+void OSInterface_LinuxTimerService::unlink(OSInterface_LinuxTimer& timer)
+{
+    const uint32_t index = timer.wheelSlot;
+    if (index == OSInterface_LinuxTimer::NOT_IN_WHEEL)
+    {
+        return;
+    }
+    if (timer.wheelPrevious != nullptr)
+    {
+        timer.wheelPrevious->wheelNext = timer.wheelNext;
+    }
+    else
+    {
+        slots[index] = timer.wheelNext;
+    }
+    if (timer.wheelNext != nullptr)
+    {
+        timer.wheelNext->wheelPrevious = timer.wheelPrevious;
+    }
+    if (slots[index] == nullptr)
+    {
+        occupied[index / WHEEL_SLOTS] &= ~(UINT64_C(1) << (index % WHEEL_SLOTS));
+    }
+    timer.wheelPrevious = nullptr;
+    timer.wheelNext     = nullptr;
+    timer.wheelSlot     = OSInterface_LinuxTimer::NOT_IN_WHEEL;
+}
+
+void OSInterface_LinuxTimerService::advanceTo(const uint64_t tick)
+{
+    wheelTick = tick;
+    // Every slot starting at this tick is spread over the lower levels, highest level first
+    for (uint32_t level = WHEEL_LEVELS - 1; level > 0; level--)
+    {
+        const uint32_t shift = level * WHEEL_LEVEL_BITS;
+        if ((tick & ((UINT64_C(1) << shift) - 1)) != 0)
+        {
+            continue;
+        }
+        const auto              slot  = static_cast<uint32_t>(tick >> shift) & (WHEEL_SLOTS - 1);
+        OSInterface_LinuxTimer* timer = slots[level * WHEEL_SLOTS + slot];
+
+        slots[level * WHEEL_SLOTS + slot] = nullptr;
+        occupied[level] &= ~(UINT64_C(1) << slot);
+        while (timer != nullptr)
+        {
+            OSInterface_LinuxTimer* next = timer->wheelNext;
+            link(*timer, timer->wheelExpiry);
+            timer = next;
+        }
+    }
+}
+
+uint64_t OSInterface_LinuxTimerService::nextEventTick() const
+{
+    uint64_t next = NO_TICK;
+    for (uint32_t level = 0; level < WHEEL_LEVELS; level++)
+    {
+        const uint32_t shift      = level * WHEEL_LEVEL_BITS;
+        const uint32_t digit      = static_cast<uint32_t>(wheelTick >> shift) & (WHEEL_SLOTS - 1);
+        const uint64_t revolution = wheelTick & ~((UINT64_C(1) << (shift + WHEEL_LEVEL_BITS)) - 1);
+        // The current slot of a higher level was already spread over the lower ones when the wheel reached it
+        const uint32_t first   = level == 0 ? digit : digit + 1;
+        const uint64_t pending = first < WHEEL_SLOTS ? occupied[level] & ~((UINT64_C(1) << first) - 1) : 0;
+
+        uint64_t candidate;
+        if (pending != 0)
+        {
+            candidate = revolution | (static_cast<uint64_t>(std::countr_zero(pending)) << shift);
+        }
+        else if (level == WHEEL_LEVELS - 1 && occupied[level] != 0)
+        {
+            // Slots behind the current one at the top level belong to its next revolution
+            candidate = (revolution + (UINT64_C(1) << (shift + WHEEL_LEVEL_BITS))) |
+                        (static_cast<uint64_t>(std::countr_zero(occupied[level])) << shift);
+        }
+        else
+        {
+            continue;
+        }
+        next = std::min(next, candidate);
+    }
+    return next;
+}
+
+void OSInterface_LinuxTimerService::arm(OSInterface_LinuxTimer& timer)
+{
+    const uint64_t expiry = OSInterface_LinuxClock::nowNanos() +
+                            timer.period_ms.load(std::memory_order_relaxed) * OSInterface_LinuxClock::NANOS_PER_MILLI;
+    bool wakeDispatcher;
+    {
+        std::lock_guard guard(lock);
+        armLocked(timer, expiry);
+        // Only a timer expiring before the dispatcher's planned wake-up changes how long it has to sleep
+        wakeDispatcher = timer.wheelExpiry < plannedWakeTick;
+        if (wakeDispatcher)
+        {
+            wakeSequence.fetch_add(1, std::memory_order_release);
+        }
+    }
+    if (wakeDispatcher)
+    {
+        OSInterface_LinuxFutex::wake(wakeSequence, 1);
+    }
+}
+
+void OSInterface_LinuxTimerService::disarm(OSInterface_LinuxTimer& timer)
+{
+    std::lock_guard guard(lock);
+    disarmLocked(timer);
+}
+
+void OSInterface_LinuxTimerService::remove(OSInterface_LinuxTimer& timer)
+{
+    std::unique_lock guard(lock);
+    disarmLocked(timer);
+
+    if (std::this_thread::get_id() == dispatcher.get_id())
+    {
+        return; // Deleted from its own callback (or another callback): nothing to wait for
+    }
+    while (runningTimer == &timer)
+    {
+        callbackWaiters.fetch_add(1, std::memory_order_relaxed);
+        const uint32_t key = callbackSequence.load(std::memory_order_acquire);
+        guard.unlock();
+        OSInterface_LinuxFutex::wait(callbackSequence, key, nullptr);
+        guard.lock();
+        callbackWaiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void OSInterface_LinuxTimerService::run()
+{
+    std::unique_lock guard(lock);
+    while (!stopping)
+    {
+        const uint64_t next = nextEventTick();
+        if (next == NO_TICK || next > currentTick())
+        {
+            plannedWakeTick    = next;
+            const uint32_t key = wakeSequence.load(std::memory_order_acquire);
+            guard.unlock();
+            if (next == NO_TICK)
+            {
+                OSInterface_LinuxFutex::wait(wakeSequence, key, nullptr);
+            }
+            else
+            {
+                const OSInterface_LinuxDeadline deadline =
+                    OSInterface_LinuxDeadline::at(next * OSInterface_LinuxClock::NANOS_PER_MILLI);
+                OSInterface_LinuxFutex::wait(wakeSequence, key, &deadline);
+            }
+            guard.lock();
+            plannedWakeTick = 0;
+            continue;
+        }
+        if (next != wheelTick)
+        {
+            advanceTo(next); // Nothing is due in between
+            continue;
+        }
+
+        // Only a level 0 slot can be due at the current tick, and it only holds timers expiring at this exact tick
+        OSInterface_LinuxTimer& timer = *slots[wheelTick & (WHEEL_SLOTS - 1)];
+        unlink(timer);
+        if (timer.mode == OSInterface_Timer::PERIODIC)
+        {
+            // Keep the period phase-locked to the original start time unless the dispatcher fell behind
+            const uint64_t now = OSInterface_LinuxClock::nowNanos();
+            const uint64_t period =
+                timer.period_ms.load(std::memory_order_relaxed) * OSInterface_LinuxClock::NANOS_PER_MILLI;
+            const uint64_t expiry = timer.expiry_ns.load(std::memory_order_relaxed) + period;
+            armLocked(timer, expiry > now ? expiry : now + period);
+        }
+        else
+        {
+            timer.running.store(false, std::memory_order_release);
+        }
+
+        runningTimer = &timer;
+        guard.unlock();
+        timer.expire();
+        guard.lock();
+        runningTimer = nullptr;
+        if (callbackWaiters.load(std::memory_order_relaxed) != 0)
+        {
+            callbackSequence.fetch_add(1, std::memory_order_release);
+            OSInterface_LinuxFutex::wakeAll(callbackSequence);
+        }
+    }
+}
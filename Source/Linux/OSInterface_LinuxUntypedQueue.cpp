@@ -0,0 +1,426 @@
+#include <cstring>
+#include <mutex>
+#include <new>
+#include "OSInterface_LinuxUntypedQueue.h"
+
+OSInterface_LinuxUntypedQueue::OSInterface_LinuxUntypedQueue(const uint32_t maxMessages, const uint32_t messageSize) :
+    maxMessages(maxMessages), messageSize(messageSize),
+    storage(new(std::nothrow) uint8_t[static_cast<size_t>(maxMessages) * messageSize]),
+    states(new(std::nothrow) uint8_t[maxMessages]())
+{
+#ifdef OSInterface_INSTRUMENTATION
+    notEmpty.instrument(&stats.wait);
+    notFull.instrument(&stats.sendWait);
+#endif
+}
+
+bool OSInterface_LinuxUntypedQueue::isValid() const
+{
+    return storage != nullptr && states != nullptr && maxMessages > 0 && messageSize > 0;
+}
+
+uint8_t* OSInterface_LinuxUntypedQueue::slotAddress(const uint32_t slot) const
+{
+    return &storage[static_cast<size_t>(slot) * messageSize];
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::slotIndex(const void* address) const
+{
+    return static_cast<uint32_t>((static_cast<const uint8_t*>(address) - storage.get()) / messageSize);
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::next(const uint32_t slot) const
+{
+    return slot + 1 == maxMessages ? 0 : slot + 1;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::length()
+{
+    std::lock_guard guard(lock);
+    return ready;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::size()
+{
+    return maxMessages;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::available()
+{
+    std::lock_guard guard(lock);
+    return maxMessages - used;
+}
+
+bool OSInterface_LinuxUntypedQueue::isEmpty()
+{
+    return length() == 0;
+}
+
+bool OSInterface_LinuxUntypedQueue::isFull()
+{
+    return available() == 0;
+}
+
+void OSInterface_LinuxUntypedQueue::reset()
+{
+    {
+        std::lock_guard guard(lock);
+        // Slots that are being written keep their place in the ring, so the messages queued behind them are only
+        // marked as discarded and skipped once the receivers get there
+        uint32_t slot = head;
+        for (uint32_t i = 0; i < pending; i++)
+        {
+            if (states[slot] == READY)
+            {
+                states[slot] = DISCARDED;
+            }
+            slot = next(slot);
+        }
+        ready = 0;
+        skipDiscarded();
+    }
+    notFull.notifyAll();
+}
+
+uint8_t* OSInterface_LinuxUntypedQueue::tryPut(const SlotState newState, const bool toFront)
+{
+    uint32_t slot;
+    if (toFront)
+    {
+        slot = head == 0 ? maxMessages - 1 : head - 1;
+        if (states[slot] != FREE)
+        {
+            return nullptr;
+        }
+        head = slot;
+    }
+    else
+    {
+        slot = tail;
+        if (states[slot] != FREE)
+        {
+            return nullptr;
+        }
+        tail = next(tail);
+    }
+    states[slot] = newState;
+    pending++;
+    used++;
+#ifdef OSInterface_INSTRUMENTATION
+    stats.recordLength(used);
+#endif
+    if (newState == READY)
+    {
+        ready++;
+    }
+    return slotAddress(slot);
+}
+
+void OSInterface_LinuxUntypedQueue::skipDiscarded()
+{
+    while (pending != 0 && states[head] == DISCARDED)
+    {
+        states[head] = FREE;
+        head         = next(head);
+        pending--;
+        used--;
+    }
+}
+
+uint8_t* OSInterface_LinuxUntypedQueue::tryTake(const SlotState newState)
+{
+    skipDiscarded();
+    if (pending == 0 || states[head] != READY)
+    {
+        return nullptr;
+    }
+    const uint32_t slot = head;
+    head                = next(head);
+    pending--;
+    ready--;
+    states[slot] = newState;
+    if (newState == FREE)
+    {
+        used--;
+    }
+    return slotAddress(slot);
+}
+
+void OSInterface_LinuxUntypedQueue::setState(const void* address, const SlotState newState)
+{
+    std::lock_guard guard(lock);
+    const uint32_t  slot = slotIndex(address);
+    states[slot]         = newState;
+    if (newState == READY)
+    {
+        ready++;
+    }
+    else if (newState == FREE)
+    {
+        used--;
+    }
+}
+
+bool OSInterface_LinuxUntypedQueue::tryReceive(void* message)
+{
+    {
+        std::lock_guard guard(lock);
+        const uint8_t*  slot = tryTake(FREE);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        memcpy(message, slot, messageSize);
+    }
+    notFull.notifyOne();
+    return true;
+}
+
+bool OSInterface_LinuxUntypedQueue::trySend(const void* message, const bool toFront)
+{
+    {
+        std::lock_guard guard(lock);
+        uint8_t*        slot = tryPut(READY, toFront);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        memcpy(slot, message, messageSize);
+    }
+    notEmpty.notifyOne();
+    notifyWaitSet();
+    return true;
+}
+
+bool OSInterface_LinuxUntypedQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return notEmpty.await([this, message] { return tryReceive(message); }, maxTimeToWait_ms);
+}
+
+bool OSInterface_LinuxUntypedQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return notEmpty.awaitFor([this, message] { return tryReceive(message); },
+                             maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+}
+
+bool OSInterface_LinuxUntypedQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_LinuxUntypedQueue::send(const void* message, const uint64_t timeout_ns, const bool toFront)
+{
+    return notFull.awaitFor([this, message, toFront] { return trySend(message, toFront); }, timeout_ns);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return send(message, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI, false);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return send(message, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message, false);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToFront(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return send(message, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI, true);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToFrontMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return send(message, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO, true);
+}
+
+bool OSInterface_LinuxUntypedQueue::sendToFrontFromISR(const void* message)
+{
+    return trySend(message, true);
+}
+
+void* OSInterface_LinuxUntypedQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    notFull.await(
+        [this, &slot]
+        {
+            std::lock_guard guard(lock);
+            slot = tryPut(WRITING, false);
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxUntypedQueue::commitSend(void* slot)
+{
+    setState(slot, READY);
+    notEmpty.notifyOne();
+    notifyWaitSet();
+}
+
+const void* OSInterface_LinuxUntypedQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    notEmpty.await(
+        [this, &slot]
+        {
+            std::lock_guard guard(lock);
+            slot = tryTake(READING);
+            return slot != nullptr;
+        },
+        maxTimeToWait_ms);
+    return slot;
+}
+
+void OSInterface_LinuxUntypedQueue::releaseReceive(const void* slot)
+{
+    setState(slot, FREE);
+    notFull.notifyOne();
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    uint32_t received = 0;
+    {
+        std::lock_guard guard(lock);
+        const uint8_t*  slot;
+        while (received < count && (slot = tryTake(FREE)) != nullptr)
+        {
+            memcpy(static_cast<uint8_t*>(messages) + static_cast<size_t>(received) * messageSize, slot, messageSize);
+            received++;
+        }
+    }
+    notFull.notifyBatch(received);
+    return received;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::trySendN(const void* messages, const uint32_t count)
+{
+    uint32_t sent = 0;
+    {
+        std::lock_guard guard(lock);
+        uint8_t*        slot;
+        while (sent < count && (slot = tryPut(READY, false)) != nullptr)
+        {
+            memcpy(slot, static_cast<const uint8_t*>(messages) + static_cast<size_t>(sent) * messageSize, messageSize);
+            sent++;
+        }
+    }
+    if (sent != 0)
+    {
+        notEmpty.notifyBatch(sent);
+        notifyWaitSet();
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                    const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        notFull.await(
+            [this, messages, count, &sent]
+            {
+                sent = trySendN(messages, count);
+                return sent != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                                 const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        notEmpty.await(
+            [this, messages, maxMessages, &received]
+            {
+                received = tryReceiveN(messages, maxMessages);
+                return received != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return received;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    uint32_t drained = 0;
+    uint32_t limit   = UINT32_MAX;
+    while (drained < limit)
+    {
+        // Take a run of consecutive ready slots under the lock, visit them without it and free them all at once
+        uint32_t first;
+        uint32_t taken = 0;
+        {
+            std::lock_guard guard(lock);
+            if (limit == UINT32_MAX)
+            {
+                limit = ready; // Only drain what is queued now, even if the senders keep up
+            }
+            skipDiscarded();
+            first = head;
+            while (drained + taken < limit && pending != 0 && states[head] == READY)
+            {
+                tryTake(READING);
+                taken++;
+            }
+        }
+        if (taken == 0)
+        {
+            break;
+        }
+
+        uint32_t slot = first;
+        for (uint32_t i = 0; i < taken; i++)
+        {
+            callback(slotAddress(slot), arg);
+            slot = next(slot);
+        }
+
+        {
+            std::lock_guard guard(lock);
+            slot = first;
+            for (uint32_t i = 0; i < taken; i++)
+            {
+                states[slot] = FREE;
+                slot         = next(slot);
+            }
+            used -= taken;
+        }
+        notFull.notifyBatch(taken);
+        drained += taken;
+    }
+    return drained;
+}
+
+uint32_t OSInterface_LinuxUntypedQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_LinuxUntypedQueue::pollReady()
+{
+    return !isEmpty();
+}
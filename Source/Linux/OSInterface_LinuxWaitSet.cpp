@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include "OSInterface_LinuxWaitSet.h"
+
+bool OSInterface_LinuxWaitable::attach(OSInterface_LinuxWaitSet& set)
+{
+    std::lock_guard guard(attachLock);
+    if (waitSet.load(std::memory_order_relaxed) != nullptr)
+    {
+        return false;
+    }
+    waitSet.store(&set, std::memory_order_seq_cst);
+    return true;
+}
+
+void OSInterface_LinuxWaitable::detach()
+{
+    std::lock_guard guard(attachLock);
+    waitSet.store(nullptr, std::memory_order_relaxed);
+}
+
+void OSInterface_LinuxWaitable::notifyWaitSetSlow()
+{
+    // The lock keeps the wait set from being detached (and deleted) while it is being notified
+    std::lock_guard guard(attachLock);
+    OSInterface_LinuxWaitSet* set = waitSet.load(std::memory_order_relaxed);
+    if (set != nullptr)
+    {
+        set->notify();
+    }
+}
+
+OSInterface_LinuxWaitSet::~OSInterface_LinuxWaitSet()
+{
+    for (const Member& member : members)
+    {
+        member.waitable->detach();
+    }
+}
+
+bool OSInterface_LinuxWaitSet::add(OSInterface_UntypedQueue* queue)
+{
+    return addMember(queue, dynamic_cast<OSInterface_LinuxWaitable*>(queue));
+}
+
+bool OSInterface_LinuxWaitSet::add(OSInterface_BinarySemaphore* semaphore)
+{
+    return addMember(semaphore, dynamic_cast<OSInterface_LinuxWaitable*>(semaphore));
+}
+
+bool OSInterface_LinuxWaitSet::add(OSInterface_Timer* timer)
+{
+    return addMember(timer, dynamic_cast<OSInterface_LinuxWaitable*>(timer));
+}
+
+bool OSInterface_LinuxWaitSet::remove(OSInterface_UntypedQueue* queue)
+{
+    return removeMember(queue);
+}
+
+bool OSInterface_LinuxWaitSet::remove(OSInterface_BinarySemaphore* semaphore)
+{
+    return removeMember(semaphore);
+}
+
+bool OSInterface_LinuxWaitSet::remove(OSInterface_Timer* timer)
+{
+    return removeMember(timer);
+}
+
+uint32_t OSInterface_LinuxWaitSet::wait(const void** readyMembers, const uint32_t maxMembers,
+                                        const uint32_t maxTimeToWait_ms)
+{
+    uint32_t count = 0;
+    if (readyMembers != nullptr && maxMembers != 0)
+    {
+        event.await(
+            [this, readyMembers, maxMembers, &count]
+            {
+                std::lock_guard guard(lock);
+                count = poll(readyMembers, maxMembers);
+                return count != 0;
+            },
+            maxTimeToWait_ms);
+    }
+    return count;
+}
+
+bool OSInterface_LinuxWaitSet::addMember(const void* handle, OSInterface_LinuxWaitable* waitable)
+{
+    if (waitable == nullptr)
+    {
+        return false; // Not created by the Linux backend
+    }
+    {
+        std::lock_guard guard(lock);
+        try
+        {
+            members.reserve(members.size() + 1);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+        if (!waitable->attach(*this))
+        {
+            return false;
+        }
+        members.push_back({handle, waitable});
+    }
+    // The member may already be ready and a thread may already be sleeping in wait()
+    notify();
+    return true;
+}
+
+bool OSInterface_LinuxWaitSet::removeMember(const void* handle)
+{
+    std::lock_guard guard(lock);
+
+    const auto member = std::find_if(members.begin(), members.end(),
+                                     [handle](const Member& entry) { return entry.handle == handle; });
+    if (member == members.end())
+    {
+        return false;
+    }
+    member->waitable->detach();
+    members.erase(member);
+    if (nextMember >= members.size())
+    {
+        nextMember = 0;
+    }
+    return true;
+}
+
+uint32_t OSInterface_LinuxWaitSet::poll(const void** readyMembers, const uint32_t maxMembers)
+{
+    uint32_t     count = 0;
+    const size_t total = members.size();
+    const size_t first = nextMember;
+    for (size_t i = 0; i < total && count < maxMembers; i++)
+    {
+        const size_t index = (first + i) % total;
+        if (members[index].waitable->pollReady())
+        {
+            readyMembers[count++] = members[index].handle;
+            nextMember            = (index + 1) % total;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,135 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUX_H
+#define OSINTERFACE_OSINTERFACE_LINUX_H
+
+#include <concepts>
+#include <cstdint>
+#include "OSInterface.h"
+#include "OSInterface_EventCount.h"
+#include "OSInterface_LinuxBinarySemaphore.h"
+#include "OSInterface_LinuxCountingSemaphore.h"
+#include "OSInterface_LinuxEventGroup.h"
+#include "OSInterface_LinuxExecutor.h"
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxLockFreeQueue.h"
+#include "OSInterface_LinuxMessageBuffer.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_LinuxPriorityQueue.h"
+#include "OSInterface_LinuxProcess.h"
+#include "OSInterface_LinuxRWLock.h"
+#include "OSInterface_LinuxStreamBuffer.h"
+#include "OSInterface_LinuxTimer.h"
+#include "OSInterface_LinuxUntypedQueue.h"
+#include "OSInterface_LinuxWaitSet.h"
+
+/**
+ * @brief Linux implementation of OSInterface
+ *
+ * Mutexes, reader-writer locks, semaphores, event groups and queues are built directly on futexes and do not enter the
+ * kernel when uncontended. Queues created with an access pattern are lock-free rings (SPSC or MPMC) that only sleep
+ * when full or empty. Wait sets sleep on a single futex that every member wakes up when it becomes ready. Time is read
+ * from CLOCK_MONOTONIC through the vDSO, osTicks() counts its nanoseconds. Processes are detached std::threads, or
+ * joinable pthreads with their affinity, scheduling and stack set when started with attributes. All timers are served
+ * by a single dispatcher thread owned by this object. Submitted jobs run on a work-stealing pool of worker threads,
+ * also owned by this object. Memory comes from the process-wide size-class pools of OSInterface_LinuxAllocator.
+ *
+ * The factories return the concrete final classes, so code holding an OSInterface_Linux (directly or as the backend of
+ * OSInterface_Static.h) calls the primitives without virtual dispatch and inlines their fast paths.
+ *
+ * @note Every timer and job handle created by this object must be deleted before it.
+ */
+class OSInterface_Linux final : public OSInterface
+{
+public:
+    OSInterface_Linux() = default;
+
+    OSInterface_Linux(const OSInterface_Linux&)            = delete;
+    OSInterface_Linux& operator=(const OSInterface_Linux&) = delete;
+    OSInterface_Linux(OSInterface_Linux&&)                 = delete;
+    OSInterface_Linux& operator=(OSInterface_Linux&&)      = delete;
+
+    ~OSInterface_Linux() override = default;
+
+    /**
+     * @brief Create a queue of one of the lock-free classes of the access patterns, to call it without virtual
+     * dispatch (see OSInterface::OSInterface_Queue)
+     *
+     * @tparam Queue OSInterface_LinuxSPSCQueue or OSInterface_LinuxMPMCQueue
+     * @param maxMessages Maximum number of messages in the queue
+     * @param messageSize Size of each message in bytes
+     * @return Queue* The queue, nullptr if it could not be created
+     */
+    template <typename Queue>
+        requires std::same_as<Queue, OSInterface_LinuxSPSCQueue> || std::same_as<Queue, OSInterface_LinuxMPMCQueue>
+    Queue* osCreateUntypedQueue(uint32_t maxMessages, uint32_t messageSize);
+
+    void                                osSleep(uint32_t ms) override;
+    uint32_t                            osMillis() override;
+    void                                osSleepMicros(uint32_t us) override;
+    uint64_t                            osMillis64() override;
+    uint64_t                            osMicros64() override;
+    uint64_t                            osTicks() override;
+    uint64_t                            osTicksPerSecond() override;
+    OSInterface_LinuxMutex*             osCreateMutex() override;
+    OSInterface_LinuxMutex*             osCreateMutex(OSInterface_Mutex::Mode mode) override;
+    OSInterface_LinuxRWLock*            osCreateRWLock() override;
+    OSInterface_LinuxBinarySemaphore*   osCreateBinarySemaphore() override;
+    OSInterface_LinuxCountingSemaphore* osCreateCountingSemaphore(uint32_t maxCount, uint32_t initialCount) override;
+    OSInterface_LinuxEventGroup*        osCreateEventGroup() override;
+    OSInterface_LinuxTimer*             osCreateTimer(uint32_t period, OSInterface_Timer::Mode mode,
+                                                      OSInterfaceProcess callback, void* callbackArg,
+                                                      const char* timerName) override;
+    OSInterface_LinuxUntypedQueue*      osCreateUntypedQueue(uint32_t maxMessages, uint32_t messageSize) override;
+    OSInterface_UntypedQueue*           osCreateUntypedQueue(
+        uint32_t maxMessages, uint32_t messageSize, OSInterface_UntypedQueue::AccessPattern accessPattern) override;
+    OSInterface_LinuxPriorityQueue*     osCreatePriorityQueue(uint32_t maxMessages, uint32_t messageSize,
+                                                              uint32_t priorityLevels) override;
+    OSInterface_LinuxMessageBuffer*     osCreateMessageBuffer(uint32_t capacity) override;
+    OSInterface_LinuxStreamBuffer*      osCreateStreamBuffer(uint32_t capacity, uint32_t triggerLevel) override;
+    OSInterface_LinuxWaitSet*           osCreateWaitSet() override;
+    void*                               osMalloc(uint32_t size) override;
+    void                                osFree(void* ptr) override;
+    void                                osGetMemoryStats(OSInterface_MemoryStats& stats) override;
+    void                                osRunProcess(OSInterfaceProcess process, void* arg) override;
+    void                                osRunProcess(OSInterfaceProcess process, const char* processName,
+                                                     void* arg) override;
+    OSInterface_LinuxProcess*           osRunProcess(OSInterfaceProcess process, void* arg,
+                                                     const OSInterface_ProcessAttributes& attributes) override;
+    OSInterface_LinuxJob*               osSubmit(OSInterfaceProcess job, void* arg) override;
+
+private:
+    OSInterface_LinuxTimerService timerService;
+    OSInterface_LinuxExecutor     executor;
+};
+
+/**
+ * @brief Event count sleeping on a futex, that only enters the kernel to notify when a thread is waiting
+ */
+template <> class OSInterface_EventCount<OSInterface_Linux>
+{
+public:
+    constexpr explicit OSInterface_EventCount(OSInterface_Linux& /*osInterface*/)
+    {
+    }
+
+    OSInterface_EventCount(const OSInterface_EventCount&)            = delete;
+    OSInterface_EventCount& operator=(const OSInterface_EventCount&) = delete;
+    OSInterface_EventCount(OSInterface_EventCount&&)                 = delete;
+    OSInterface_EventCount& operator=(OSInterface_EventCount&&)      = delete;
+
+    ~OSInterface_EventCount() = default;
+
+    template <typename Operation> bool await(Operation&& tryOperation, const uint32_t maxTimeToWait_ms)
+    {
+        return eventCount.await(tryOperation, maxTimeToWait_ms);
+    }
+
+    void notifyOne()
+    {
+        eventCount.notifyOne();
+    }
+
+private:
+    OSInterface_LinuxEventCount eventCount;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUX_H
@@ -0,0 +1,55 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXALLOCATOR_H
+#define OSINTERFACE_OSINTERFACE_LINUXALLOCATOR_H
+
+#include <cstdint>
+#include "OSInterface_MemoryStats.h"
+
+/**
+ * @brief Process-wide size-class allocator behind OSInterface_Linux::osMalloc()
+ *
+ * Blocks up to MAX_BLOCK_SIZE bytes (header included) are rounded up to a power of two and served from per-class pools
+ * that carve CHUNK_SIZE chunks taken from the system heap and never give them back, so that long-running processes do
+ * not fragment the heap. Every thread caches free blocks of each class and only locks a pool to move a batch of
+ * blocks in or out of its cache, so allocating and freeing is usually lock-free and constant time. Larger blocks are
+ * allocated from the system heap directly.
+ *
+ * Every block starts with a HEADER_SIZE bytes header recording its class, which keeps the memory 16-byte aligned.
+ */
+class OSInterface_LinuxAllocator
+{
+public:
+    static constexpr uint32_t HEADER_SIZE      = 16;
+    static constexpr uint32_t MIN_BLOCK_SIZE   = 32;
+    static constexpr uint32_t SIZE_CLASS_COUNT = 8;
+    static constexpr uint32_t MAX_BLOCK_SIZE   = MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1);
+    static constexpr uint32_t CHUNK_SIZE       = 64 * 1024;
+    static constexpr uint32_t CACHE_SIZE       = 32 * 1024; // Bytes of free blocks a thread caches per class
+
+    static_assert(SIZE_CLASS_COUNT <= OSInterface_MemoryStats::MAX_SIZE_CLASSES, "Too many size classes to report");
+    static_assert(CHUNK_SIZE % MAX_BLOCK_SIZE == 0, "Chunks must be carved into whole blocks of every class");
+
+    /**
+     * @brief Allocate memory
+     *
+     * @param size Size of the memory to allocate
+     * @return void* Pointer to the allocated memory, nullptr if size is 0 or memory is exhausted
+     */
+    static void* allocate(uint32_t size);
+
+    /**
+     * @brief Free memory returned by allocate()
+     *
+     * @param ptr Pointer to the memory to free
+     * @note If ptr is null, the function will do nothing. Memory can be freed by any thread.
+     */
+    static void free(void* ptr);
+
+    /**
+     * @brief Get the statistics of the allocator
+     *
+     * @param stats Filled with the current statistics
+     */
+    static void getStats(OSInterface_MemoryStats& stats);
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXALLOCATOR_H
@@ -0,0 +1,100 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXBINARYSEMAPHORE_H
+#define OSINTERFACE_OSINTERFACE_LINUXBINARYSEMAPHORE_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_Instrumentation.h"
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_LinuxWaitSet.h"
+
+/**
+ * @brief Futex-based binary semaphore
+ *
+ * signal() only enters the kernel if a thread is sleeping in wait(), and wait() on a signaled semaphore is a single
+ * compare-and-swap.
+ */
+class OSInterface_LinuxBinarySemaphore final : public OSInterface_BinarySemaphore, public OSInterface_LinuxWaitable
+{
+public:
+    OSInterface_LinuxBinarySemaphore() = default;
+
+    OSInterface_LinuxBinarySemaphore(const OSInterface_LinuxBinarySemaphore&)            = delete;
+    OSInterface_LinuxBinarySemaphore& operator=(const OSInterface_LinuxBinarySemaphore&) = delete;
+    OSInterface_LinuxBinarySemaphore(OSInterface_LinuxBinarySemaphore&&)                 = delete;
+    OSInterface_LinuxBinarySemaphore& operator=(OSInterface_LinuxBinarySemaphore&&)      = delete;
+
+    ~OSInterface_LinuxBinarySemaphore() override = default;
+
+    void signal() override
+    {
+        if (state.exchange(SIGNALED, std::memory_order_seq_cst) == EMPTY &&
+            waiters.load(std::memory_order_seq_cst) != 0)
+        {
+            wakeOne();
+        }
+        notifyWaitSet();
+    }
+
+    bool wait(const uint32_t maxTimeToWait_ms) override
+    {
+        return waitFor(maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitMicros(const uint32_t maxTimeToWait_us) override
+    {
+        return waitFor(maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+    bool pollReady() override
+    {
+        return state.load(std::memory_order_acquire) == SIGNALED;
+    }
+
+#ifdef OSInterface_INSTRUMENTATION
+    void setName(const char* name) override
+    {
+        stats.setName(name);
+    }
+
+    OSInterface_InstrumentationStats& getStats()
+    {
+        return stats;
+    }
+#endif
+
+private:
+    static constexpr uint32_t EMPTY    = 0;
+    static constexpr uint32_t SIGNALED = 1;
+
+    bool tryTake()
+    {
+        uint32_t expected = SIGNALED;
+        return state.compare_exchange_strong(expected, EMPTY, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    bool waitFor(const uint64_t timeout_ns)
+    {
+        const bool acquired = tryTake() || waitContended(timeout_ns);
+#ifdef OSInterface_INSTRUMENTATION
+        if (acquired)
+        {
+            stats.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+        return acquired;
+    }
+
+    bool waitContended(uint64_t timeout_ns);
+    bool sleepContended(uint64_t timeout_ns);
+    void wakeOne();
+
+    std::atomic<uint32_t> state{EMPTY};
+    std::atomic<uint32_t> waiters{0};
+
+#ifdef OSInterface_INSTRUMENTATION
+    OSInterface_InstrumentationStats stats{OSInterface_InstrumentationStats::BINARY_SEMAPHORE};
+#endif
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXBINARYSEMAPHORE_H
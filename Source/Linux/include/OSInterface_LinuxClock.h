@@ -0,0 +1,125 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXCLOCK_H
+#define OSINTERFACE_OSINTERFACE_LINUXCLOCK_H
+
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @brief CLOCK_MONOTONIC helpers shared by the Linux backend
+ */
+class OSInterface_LinuxClock
+{
+public:
+    static constexpr uint64_t NANOS_PER_MICRO  = 1000;
+    static constexpr uint64_t NANOS_PER_MILLI  = 1000000;
+    static constexpr uint64_t NANOS_PER_SECOND = 1000000000;
+
+    /**
+     * @brief Get the current monotonic time in nanoseconds
+     *
+     * @return uint64_t Nanoseconds since an arbitrary, fixed point in the past
+     * @note clock_gettime(CLOCK_MONOTONIC) is served by the vDSO, so this never enters the kernel.
+     */
+    static uint64_t nowNanos()
+    {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * NANOS_PER_SECOND + static_cast<uint64_t>(now.tv_nsec);
+    }
+
+    /**
+     * @brief Get the current monotonic time in milliseconds
+     *
+     * @return uint64_t Milliseconds since an arbitrary, fixed point in the past
+     */
+    static uint64_t nowMillis()
+    {
+        return nowNanos() / NANOS_PER_MILLI;
+    }
+
+    /**
+     * @brief Get the current monotonic time in microseconds
+     *
+     * @return uint64_t Microseconds since an arbitrary, fixed point in the past
+     */
+    static uint64_t nowMicros()
+    {
+        return nowNanos() / NANOS_PER_MICRO;
+    }
+};
+
+/**
+ * @brief Absolute CLOCK_MONOTONIC deadline, as consumed by FUTEX_WAIT_BITSET
+ */
+class OSInterface_LinuxDeadline
+{
+public:
+    /**
+     * @brief Create a deadline that expires the given number of milliseconds from now
+     *
+     * @param timeout_ms Relative timeout in milliseconds
+     */
+    explicit OSInterface_LinuxDeadline(const uint32_t timeout_ms) :
+        OSInterface_LinuxDeadline(OSInterface_LinuxClock::nowNanos() +
+                                  static_cast<uint64_t>(timeout_ms) * OSInterface_LinuxClock::NANOS_PER_MILLI, true)
+    {
+    }
+
+    /**
+     * @brief Create a deadline at an absolute monotonic time
+     *
+     * @param absolute_ns Absolute CLOCK_MONOTONIC time in nanoseconds
+     * @return OSInterface_LinuxDeadline The deadline
+     */
+    static OSInterface_LinuxDeadline at(const uint64_t absolute_ns)
+    {
+        return {absolute_ns, true};
+    }
+
+    /**
+     * @brief Create a deadline that expires the given number of nanoseconds from now
+     *
+     * @param timeout_ns Relative timeout in nanoseconds
+     * @return OSInterface_LinuxDeadline The deadline
+     */
+    static OSInterface_LinuxDeadline after(const uint64_t timeout_ns)
+    {
+        return {OSInterface_LinuxClock::nowNanos() + timeout_ns, true};
+    }
+
+    /**
+     * @return const timespec* The absolute deadline, suitable for FUTEX_WAIT_BITSET
+     */
+    [[nodiscard]] const timespec* get() const
+    {
+        return &deadline;
+    }
+
+    /**
+     * @return uint64_t The absolute deadline in nanoseconds
+     */
+    [[nodiscard]] uint64_t nanos() const
+    {
+        return static_cast<uint64_t>(deadline.tv_sec) * OSInterface_LinuxClock::NANOS_PER_SECOND +
+               static_cast<uint64_t>(deadline.tv_nsec);
+    }
+
+    /**
+     * @return true if the deadline is in the past, false otherwise
+     */
+    [[nodiscard]] bool expired() const
+    {
+        return OSInterface_LinuxClock::nowNanos() >= nanos();
+    }
+
+private:
+    OSInterface_LinuxDeadline(const uint64_t absolute_ns, bool /*absolute*/) :
+        deadline{static_cast<time_t>(absolute_ns / OSInterface_LinuxClock::NANOS_PER_SECOND),
+                 static_cast<long>(absolute_ns % OSInterface_LinuxClock::NANOS_PER_SECOND)}
+    {
+    }
+
+    timespec deadline;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXCLOCK_H
@@ -0,0 +1,108 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXCOUNTINGSEMAPHORE_H
+#define OSINTERFACE_OSINTERFACE_LINUXCOUNTINGSEMAPHORE_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_CountingSemaphore.h"
+#include "OSInterface_LinuxFutex.h"
+
+/**
+ * @brief Futex-based counting semaphore
+ *
+ * Signaling and taking available counts are a compare-and-swap on the count, and only enter the kernel when a thread
+ * is sleeping in a wait.
+ */
+class OSInterface_LinuxCountingSemaphore final : public OSInterface_CountingSemaphore
+{
+public:
+    /**
+     * @param maxCount Maximum count, at least 1
+     * @param initialCount Count at creation, at most maxCount
+     */
+    OSInterface_LinuxCountingSemaphore(const uint32_t maxCount, const uint32_t initialCount) :
+        maxCount(maxCount), count(initialCount)
+    {
+    }
+
+    OSInterface_LinuxCountingSemaphore(const OSInterface_LinuxCountingSemaphore&)            = delete;
+    OSInterface_LinuxCountingSemaphore& operator=(const OSInterface_LinuxCountingSemaphore&) = delete;
+    OSInterface_LinuxCountingSemaphore(OSInterface_LinuxCountingSemaphore&&)                 = delete;
+    OSInterface_LinuxCountingSemaphore& operator=(OSInterface_LinuxCountingSemaphore&&)      = delete;
+
+    ~OSInterface_LinuxCountingSemaphore() override = default;
+
+    bool signal() override
+    {
+        return give(1) != 0;
+    }
+
+    uint32_t signalN(const uint32_t count) override
+    {
+        return give(count);
+    }
+
+    bool signalFromISR() override
+    {
+        return give(1) != 0;
+    }
+
+    uint32_t signalNFromISR(const uint32_t count) override
+    {
+        return give(count);
+    }
+
+    bool wait(const uint32_t maxTimeToWait_ms) override
+    {
+        return take(1, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitMicros(const uint32_t maxTimeToWait_us) override
+    {
+        return take(1, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+    bool waitN(const uint32_t count, const uint32_t maxTimeToWait_ms) override
+    {
+        return take(count, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitFromISR() override
+    {
+        return tryTake(1);
+    }
+
+    bool waitNFromISR(const uint32_t count) override
+    {
+        return tryTake(count);
+    }
+
+    uint32_t getCount() override
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+private:
+    bool tryTake(const uint32_t taken)
+    {
+        uint32_t current = count.load(std::memory_order_relaxed);
+        while (current >= taken)
+        {
+            if (count.compare_exchange_weak(current, current - taken, std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t give(uint32_t added);
+    bool     take(uint32_t taken, uint64_t timeout_ns);
+
+    const uint32_t              maxCount;
+    std::atomic<uint32_t>       count;
+    std::atomic<uint32_t>       bulkWaiters{0}; // Threads waiting for more than one count
+    OSInterface_LinuxEventCount available;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXCOUNTINGSEMAPHORE_H
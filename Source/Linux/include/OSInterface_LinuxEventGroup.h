@@ -0,0 +1,68 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXEVENTGROUP_H
+#define OSINTERFACE_OSINTERFACE_LINUXEVENTGROUP_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_EventGroup.h"
+#include "OSInterface_LinuxFutex.h"
+
+/**
+ * @brief Futex-based event group
+ *
+ * The flags are a single atomic word. Setting or clearing flags is one atomic operation, and setting them only enters
+ * the kernel when a thread is sleeping in waitBits().
+ */
+class OSInterface_LinuxEventGroup final : public OSInterface_EventGroup
+{
+public:
+    OSInterface_LinuxEventGroup() = default;
+
+    OSInterface_LinuxEventGroup(const OSInterface_LinuxEventGroup&)            = delete;
+    OSInterface_LinuxEventGroup& operator=(const OSInterface_LinuxEventGroup&) = delete;
+    OSInterface_LinuxEventGroup(OSInterface_LinuxEventGroup&&)                 = delete;
+    OSInterface_LinuxEventGroup& operator=(OSInterface_LinuxEventGroup&&)      = delete;
+
+    ~OSInterface_LinuxEventGroup() override = default;
+
+    uint32_t setBits(uint32_t bits) override;
+
+    uint32_t setBitsFromISR(const uint32_t bits) override
+    {
+        return setBits(bits);
+    }
+
+    uint32_t clearBits(const uint32_t bits) override
+    {
+        return flags.fetch_and(~bits, std::memory_order_acq_rel);
+    }
+
+    uint32_t clearBitsFromISR(const uint32_t bits) override
+    {
+        return clearBits(bits);
+    }
+
+    uint32_t getBits() override
+    {
+        return flags.load(std::memory_order_acquire);
+    }
+
+    uint32_t waitBits(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                      const uint32_t maxTimeToWait_ms) override
+    {
+        return wait(bits, mode, clearOnExit, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    uint32_t waitBitsMicros(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                            const uint32_t maxTimeToWait_us) override
+    {
+        return wait(bits, mode, clearOnExit, maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+private:
+    uint32_t wait(uint32_t bits, WaitMode mode, bool clearOnExit, uint64_t timeout_ns);
+
+    std::atomic<uint32_t>       flags{0};
+    OSInterface_LinuxEventCount changed;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXEVENTGROUP_H
@@ -0,0 +1,121 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXEXECUTOR_H
+#define OSINTERFACE_OSINTERFACE_LINUXEXECUTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "OSInterface.h"
+#include "OSInterface_Job.h"
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxLockFreeQueue.h"
+#include "OSInterface_LinuxMutex.h"
+
+class OSInterface_LinuxExecutor;
+
+/**
+ * @brief Job submitted to an OSInterface_LinuxExecutor, also used as its completion handle
+ */
+class OSInterface_LinuxJob final : public OSInterface_Job
+{
+public:
+    OSInterface_LinuxJob(OSInterfaceProcess job, void* arg);
+
+    OSInterface_LinuxJob(const OSInterface_LinuxJob&)            = delete;
+    OSInterface_LinuxJob& operator=(const OSInterface_LinuxJob&) = delete;
+    OSInterface_LinuxJob(OSInterface_LinuxJob&&)                 = delete;
+    OSInterface_LinuxJob& operator=(OSInterface_LinuxJob&&)      = delete;
+
+    ~OSInterface_LinuxJob() override;
+
+    bool               wait(uint32_t maxTimeToWait_ms) override;
+    [[nodiscard]] bool isDone() override;
+
+private:
+    friend class OSInterface_LinuxExecutor;
+
+    static constexpr uint32_t PENDING = 0;
+    static constexpr uint32_t DONE    = 1;
+    static constexpr uint32_t WAITED  = 2; // Pending with at least one thread sleeping on it
+
+    /**
+     * @note When called from a worker, the worker runs other queued jobs until the job is done, as the job may be
+     * queued behind them. The timeout may then be exceeded by the duration of the last job run.
+     */
+    bool waitUntil(const OSInterface_LinuxDeadline* deadline);
+    void run();
+
+    const OSInterfaceProcess job;
+    void* const              arg;
+    std::atomic<uint32_t>    state{PENDING};
+
+    // Guarded by the lock of the worker queue holding the job
+    OSInterface_LinuxJob* previous{nullptr};
+    OSInterface_LinuxJob* next{nullptr};
+};
+
+/**
+ * @brief Fixed pool of worker threads running the jobs given to OSInterface_Linux::osSubmit()
+ *
+ * Every worker owns a deque of jobs. Jobs submitted from outside the pool are spread over the deques round-robin,
+ * jobs submitted from a job go to the deque of its worker. A worker runs the newest job of its own deque first and,
+ * once it is empty, steals the oldest job of another deque. Idle workers sleep on a futex until a job is submitted. A
+ * job waiting for another job keeps its worker busy with the queued jobs, so that jobs can wait for the jobs they
+ * submit even with a single worker.
+ * The workers are started by the first submission, one per CPU.
+ */
+class OSInterface_LinuxExecutor
+{
+public:
+    OSInterface_LinuxExecutor() = default;
+
+    OSInterface_LinuxExecutor(const OSInterface_LinuxExecutor&)            = delete;
+    OSInterface_LinuxExecutor& operator=(const OSInterface_LinuxExecutor&) = delete;
+    OSInterface_LinuxExecutor(OSInterface_LinuxExecutor&&)                 = delete;
+    OSInterface_LinuxExecutor& operator=(OSInterface_LinuxExecutor&&)      = delete;
+
+    /**
+     * @note Runs every job still queued before stopping the workers. Every job must be deleted before the executor.
+     */
+    ~OSInterface_LinuxExecutor();
+
+    /**
+     * @brief Queue a job
+     *
+     * @param job Function to run
+     * @param arg Argument to pass to the job
+     * @return OSInterface_LinuxJob* Completion handle, nullptr if it could not be allocated or no worker could start
+     */
+    OSInterface_LinuxJob* submit(OSInterfaceProcess job, void* arg);
+
+private:
+    friend class OSInterface_LinuxJob;
+
+    struct alignas(OSInterface_LINUX_CACHE_LINE_SIZE) Worker
+    {
+        OSInterface_LinuxMutex lock;
+        OSInterface_LinuxJob*  oldest{nullptr}; // Stolen first by other workers
+        OSInterface_LinuxJob*  newest{nullptr}; // Run first by the owner
+        std::thread            thread;
+    };
+
+    bool                  start();
+    void                  push(Worker& worker, OSInterface_LinuxJob& job);
+    OSInterface_LinuxJob* popNewest(Worker& worker);
+    OSInterface_LinuxJob* popOldest(Worker& worker);
+    OSInterface_LinuxJob* take(uint32_t index);
+    bool                  runQueued(uint32_t index);
+    void                  run(uint32_t index);
+
+    OSInterface_LinuxMutex    startLock;
+    std::unique_ptr<Worker[]> workers;
+    std::atomic<uint32_t>     workerCount{0}; // 0 until the workers are started
+    std::atomic<uint32_t>     nextWorker{0};
+    std::atomic<uint32_t>     queuedJobs{0};
+    std::atomic<bool>         stopping{false};
+
+    OSInterface_LinuxEventCount jobQueued;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXEXECUTOR_H
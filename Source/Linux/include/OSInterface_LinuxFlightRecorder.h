@@ -0,0 +1,79 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXFLIGHTRECORDER_H
+#define OSINTERFACE_OSINTERFACE_LINUXFLIGHTRECORDER_H
+
+#ifdef OSInterface_ASYNC_LOG
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <map>
+    #include <unordered_map>
+    #include <utility>
+    #include "OSInterface_AsyncLog.h"
+    #include "OSInterface_FlightRecord.h"
+
+/**
+ * @brief Log sink appending binary records to a memory-mapped circular file
+ *
+ * Records keep the raw arguments of the log call and refer to their tag and format string by ID, so they are several
+ * times smaller than the text and are written without formatting. Tags and format strings are added to the string
+ * table of the file the first time they are logged. As the file is mapped shared, everything written to it survives a
+ * crash of the process. Once the record area is full the oldest records are overwritten. Decode the file with the
+ * OSInterface_LogDecoder tool.
+ *
+ * Install it with OSInterface_AsyncLog::setSink(), and remove it the same way before deleting it.
+ */
+class OSInterface_LinuxFlightRecorder final : public OSInterface_LogSink
+{
+public:
+    static constexpr uint32_t DEFAULT_STRING_TABLE_SIZE = 256 * 1024;
+
+    /**
+     * @brief Create (or truncate) and map a flight-recorder file
+     *
+     * @param path Path of the file
+     * @param recordAreaSize Bytes of records kept, the oldest are overwritten beyond
+     * @param stringTableSize Bytes of tags and format strings, records with new strings are dropped once it is full
+     * @note Check isValid() after construction, creating or mapping the file may fail.
+     */
+    OSInterface_LinuxFlightRecorder(const char* path, uint32_t recordAreaSize,
+                                    uint32_t stringTableSize = DEFAULT_STRING_TABLE_SIZE);
+
+    OSInterface_LinuxFlightRecorder(const OSInterface_LinuxFlightRecorder&)            = delete;
+    OSInterface_LinuxFlightRecorder& operator=(const OSInterface_LinuxFlightRecorder&) = delete;
+    OSInterface_LinuxFlightRecorder(OSInterface_LinuxFlightRecorder&&)                 = delete;
+    OSInterface_LinuxFlightRecorder& operator=(OSInterface_LinuxFlightRecorder&&)      = delete;
+
+    ~OSInterface_LinuxFlightRecorder() override;
+
+    /**
+     * @return true if the file is mapped and records can be written, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    void write(const OSInterface_LogRecord& record) override;
+    void flush() override;
+
+private:
+    static constexpr uint16_t NO_ID = UINT16_MAX;
+
+    uint16_t addString(uint16_t kind, const char* first, const char* second, uint16_t& count);
+    uint16_t tagId(const char* tag);
+    uint16_t messageId(const char* format, const char* signature);
+    void     advanceTail(uint64_t head, uint64_t size);
+
+    OSInterface_FlightRecordFile* file{nullptr};
+    size_t                        mappedSize{0};
+    uint8_t*                      strings{nullptr};
+    uint8_t*                      records{nullptr};
+
+    // Only used by the drain thread
+    std::unordered_map<const char*, uint16_t>               tags;
+    std::map<std::pair<const char*, const char*>, uint16_t> messages; // By format and signature
+    uint16_t                                                tagCount{0};
+    uint16_t                                                messageCount{0};
+    uint64_t                                                droppedRecords{0}; // Records with too many strings
+};
+
+#endif // OSInterface_ASYNC_LOG
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXFLIGHTRECORDER_H
@@ -0,0 +1,255 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXFUTEX_H
+#define OSINTERFACE_OSINTERFACE_LINUXFUTEX_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_Instrumentation.h"
+#include "OSInterface_LinuxClock.h"
+
+/**
+ * @brief Thin wrapper around the futex(2) system call
+ *
+ * All futexes used by the backend are process-private.
+ */
+class OSInterface_LinuxFutex
+{
+public:
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "A futex word must be exactly 32 bits");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "A futex word must be lock-free");
+
+    /**
+     * @brief Sleep while the futex word holds the expected value
+     *
+     * @param word Futex word
+     * @param expected Value the word must still hold for the caller to go to sleep
+     * @param deadline Absolute deadline, or nullptr to wait without timeout
+     * @return false if the deadline was reached, true if woken up, interrupted or if the word did not hold the
+     * expected value. The caller must re-check its condition in every case.
+     */
+    static bool wait(std::atomic<uint32_t>& word, uint32_t expected, const OSInterface_LinuxDeadline* deadline);
+
+    /**
+     * @brief Wake up threads sleeping on the futex word
+     *
+     * @param word Futex word
+     * @param count Maximum number of threads to wake up
+     */
+    static void wake(std::atomic<uint32_t>& word, int count);
+
+    /**
+     * @brief Wake up every thread sleeping on the futex word
+     *
+     * @param word Futex word
+     */
+    static void wakeAll(std::atomic<uint32_t>& word);
+};
+
+/**
+ * @brief Busy-wait helpers for the short spins done before sleeping on a futex
+ */
+class OSInterface_LinuxSpin
+{
+public:
+    /**
+     * @brief Tell the CPU that the thread is spinning, which saves power and frees resources for the other hardware
+     * thread of the core
+     */
+    static void pause()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @return true if spinning can help, which requires the lock owner to run on another CPU, false otherwise
+     */
+    static bool isUseful();
+};
+
+/**
+ * @brief Futex-backed event count used to build blocking operations on top of lock-free conditions
+ *
+ * Waiters follow the prepareWait() / re-check condition / commitWait() or cancelWait() protocol. Notifiers first make
+ * the condition true and then call notifyOne() or notifyAll(), which do not enter the kernel unless a waiter is
+ * registered.
+ */
+class OSInterface_LinuxEventCount
+{
+public:
+    /**
+     * @brief Register the calling thread as a waiter
+     *
+     * @return uint32_t Key to pass to commitWait()
+     */
+    uint32_t prepareWait()
+    {
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return sequence.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Unregister the calling thread after its condition turned out to be already satisfied
+     */
+    void cancelWait()
+    {
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sleep until notified or until the deadline is reached, then unregister the calling thread
+     *
+     * @param key Key returned by prepareWait()
+     * @param deadline Absolute deadline, or nullptr to wait without timeout
+     * @return false if the deadline was reached, true otherwise
+     */
+    bool commitWait(const uint32_t key, const OSInterface_LinuxDeadline* deadline)
+    {
+        const bool result = OSInterface_LinuxFutex::wait(sequence, key, deadline);
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+     * @brief Retry a non-blocking operation until it succeeds or the timeout expires, sleeping between attempts
+     *
+     * @param tryOperation Callable returning true once the operation succeeded
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if the operation succeeded, false if the timeout was reached
+     * @note The deadline is only computed once the first attempt failed.
+     */
+    template <typename Operation> bool await(Operation&& tryOperation, const uint32_t maxTimeToWait_ms)
+    {
+        return awaitFor(tryOperation, maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    /**
+     * @brief Retry a non-blocking operation until it succeeds or the timeout expires, sleeping between attempts
+     *
+     * @param tryOperation Callable returning true once the operation succeeded
+     * @param timeout_ns Maximum time to wait in nanoseconds
+     * @return true if the operation succeeded, false if the timeout was reached
+     * @note The deadline is only computed once the first attempt failed.
+     */
+    template <typename Operation> bool awaitFor(Operation&& tryOperation, const uint64_t timeout_ns)
+    {
+        if (tryOperation())
+        {
+            return true;
+        }
+#ifdef OSInterface_INSTRUMENTATION
+        if (stats != nullptr)
+        {
+            return awaitInstrumented(tryOperation, timeout_ns);
+        }
+#endif
+        if (timeout_ns == 0)
+        {
+            return false;
+        }
+        return awaitUntil(tryOperation, OSInterface_LinuxDeadline::after(timeout_ns));
+    }
+
+    /**
+     * @brief Retry a non-blocking operation until it succeeds or the deadline is reached, sleeping between attempts
+     *
+     * @param tryOperation Callable returning true once the operation succeeded
+     * @param deadline Absolute deadline
+     * @return true if the operation succeeded, false if the deadline was reached
+     */
+    template <typename Operation> bool awaitUntil(Operation&& tryOperation, const OSInterface_LinuxDeadline& deadline)
+    {
+        while (true)
+        {
+            const uint32_t key = prepareWait();
+            if (tryOperation())
+            {
+                cancelWait();
+                return true;
+            }
+            if (!commitWait(key, &deadline))
+            {
+                return tryOperation();
+            }
+        }
+    }
+
+    /**
+     * @brief Wake up one registered waiter, if any
+     */
+    void notifyOne()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) != 0)
+        {
+            sequence.fetch_add(1, std::memory_order_seq_cst);
+            OSInterface_LinuxFutex::wake(sequence, 1);
+        }
+    }
+
+    /**
+     * @brief Wake up every registered waiter
+     */
+    void notifyAll()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) != 0)
+        {
+            sequence.fetch_add(1, std::memory_order_seq_cst);
+            OSInterface_LinuxFutex::wakeAll(sequence);
+        }
+    }
+
+    /**
+     * @brief Wake up as many registered waiters as a batch of new items can satisfy
+     *
+     * @param items Number of items made available: none wakes nobody, one wakes one waiter, more wake every waiter
+     */
+    void notifyBatch(const uint32_t items)
+    {
+        if (items == 1)
+        {
+            notifyOne();
+        }
+        else if (items > 1)
+        {
+            notifyAll();
+        }
+    }
+
+#ifdef OSInterface_INSTRUMENTATION
+    /**
+     * @brief Record the contended calls to awaitFor() (and await()) in wait statistics
+     *
+     * @param waitStats Statistics to update, must outlive the event count
+     */
+    void instrument(OSInterface_WaitStats* waitStats)
+    {
+        stats = waitStats;
+    }
+#endif
+
+private:
+#ifdef OSInterface_INSTRUMENTATION
+    template <typename Operation> bool awaitInstrumented(Operation& tryOperation, const uint64_t timeout_ns)
+    {
+        const uint64_t start = OSInterface_LinuxClock::nowNanos();
+        const bool     result =
+            timeout_ns != 0 && awaitUntil(tryOperation, OSInterface_LinuxDeadline::after(timeout_ns));
+        stats->record(timeout_ns, OSInterface_LinuxClock::nowNanos() - start, result);
+        return result;
+    }
+
+    OSInterface_WaitStats* stats{nullptr};
+#endif
+
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<uint32_t> waiters{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXFUTEX_H
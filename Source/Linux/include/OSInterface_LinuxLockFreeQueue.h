@@ -0,0 +1,225 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXLOCKFREEQUEUE_H
+#define OSINTERFACE_OSINTERFACE_LINUXLOCKFREEQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "OSInterface_Instrumentation.h"
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxWaitSet.h"
+#include "OSInterface_UntypedQueue.h"
+
+/**
+ * @brief Size used to keep producer-side and consumer-side indices on separate cache lines
+ */
+static constexpr size_t OSInterface_LINUX_CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Bounded wait-free single-producer/single-consumer ring queue
+ *
+ * The producer only writes the tail and the consumer only writes the head, each on its own cache line. Both sides keep
+ * a cached copy of the other side's index and only reload it when the ring looks full (empty). Blocking calls sleep on
+ * a futex only when the ring is full (empty) and a timeout was given.
+ *
+ * @note sendToFront() and sendToFrontFromISR() are not supported and always return false.
+ * @note reset() must be called from the consumer side.
+ */
+class OSInterface_LinuxSPSCQueue final : public OSInterface_UntypedQueue, public OSInterface_LinuxWaitable
+{
+public:
+    /**
+     * @brief Create the queue
+     *
+     * @param maxMessages Maximum number of messages in the queue
+     * @param messageSize Size of each message in bytes
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_LinuxSPSCQueue(uint32_t maxMessages, uint32_t messageSize);
+
+    OSInterface_LinuxSPSCQueue(const OSInterface_LinuxSPSCQueue&)            = delete;
+    OSInterface_LinuxSPSCQueue& operator=(const OSInterface_LinuxSPSCQueue&) = delete;
+    OSInterface_LinuxSPSCQueue(OSInterface_LinuxSPSCQueue&&)                 = delete;
+    OSInterface_LinuxSPSCQueue& operator=(OSInterface_LinuxSPSCQueue&&)      = delete;
+
+    ~OSInterface_LinuxSPSCQueue() override = default;
+
+    /**
+     * @return true if the queue storage was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] bool     isEmpty() override;
+    [[nodiscard]] bool     isFull() override;
+    void                   reset() override;
+    bool                   receive(void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   receiveMicros(void* message, uint32_t maxTimeToWait_us) override;
+    bool                   receiveFromISR(void* message) override;
+    bool                   sendToBack(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToBackMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToBackFromISR(const void* message) override;
+    bool                   sendToFront(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToFrontFromISR(const void* message) override;
+    void*                  acquireSendSlot(uint32_t maxTimeToWait_ms) override;
+    void                   commitSend(void* slot) override;
+    const void*            peekReceiveSlot(uint32_t maxTimeToWait_ms) override;
+    void                   releaseReceive(const void* slot) override;
+    uint32_t               sendToBackN(const void* messages, uint32_t count, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendToBackNFromISR(const void* messages, uint32_t count) override;
+    uint32_t               receiveN(void* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveNFromISR(void* messages, uint32_t maxMessages) override;
+    uint32_t               drain(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    uint32_t               drainFromISR(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    bool                   pollReady() override;
+
+#ifdef OSInterface_INSTRUMENTATION
+    void setName(const char* name) override
+    {
+        stats.setName(name);
+    }
+
+    OSInterface_InstrumentationStats& getStats()
+    {
+        return stats;
+    }
+#endif
+
+private:
+    [[nodiscard]] size_t offsetOf(uint64_t position) const;
+
+    uint8_t* tryReserveSend();
+    uint8_t* tryReserveReceive();
+    bool     tryReceive(void* message);
+    bool     trySend(const void* message);
+    uint32_t tryReceiveN(void* messages, uint32_t count);
+    uint32_t trySendN(const void* messages, uint32_t count);
+
+    const uint32_t             maxMessages;
+    const uint32_t             messageSize;
+    const bool                 powerOfTwo;
+    std::unique_ptr<uint8_t[]> storage;
+
+    OSInterface_LinuxEventCount notEmpty;
+    OSInterface_LinuxEventCount notFull;
+
+#ifdef OSInterface_INSTRUMENTATION
+    OSInterface_InstrumentationStats stats{OSInterface_InstrumentationStats::QUEUE};
+#endif
+
+    // Consumer side
+    alignas(OSInterface_LINUX_CACHE_LINE_SIZE) std::atomic<uint64_t> head{0};
+    uint64_t cachedTail{0};
+
+    // Producer side
+    alignas(OSInterface_LINUX_CACHE_LINE_SIZE) std::atomic<uint64_t> tail{0};
+    uint64_t cachedHead{0};
+};
+
+/**
+ * @brief Bounded lock-free multi-producer/multi-consumer ring queue (Dmitry Vyukov's design)
+ *
+ * Every slot carries a sequence number telling whether it is ready to be written or read for a given lap of the ring,
+ * so producers and consumers only contend on their own position counter, each on its own cache line. Blocking calls
+ * sleep on a futex only when the ring is full (empty) and a timeout was given.
+ *
+ * @note sendToFront() and sendToFrontFromISR() are not supported and always return false.
+ */
+class OSInterface_LinuxMPMCQueue final : public OSInterface_UntypedQueue, public OSInterface_LinuxWaitable
+{
+public:
+    /**
+     * @brief Create the queue
+     *
+     * @param maxMessages Maximum number of messages in the queue
+     * @param messageSize Size of each message in bytes
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_LinuxMPMCQueue(uint32_t maxMessages, uint32_t messageSize);
+
+    OSInterface_LinuxMPMCQueue(const OSInterface_LinuxMPMCQueue&)            = delete;
+    OSInterface_LinuxMPMCQueue& operator=(const OSInterface_LinuxMPMCQueue&) = delete;
+    OSInterface_LinuxMPMCQueue(OSInterface_LinuxMPMCQueue&&)                 = delete;
+    OSInterface_LinuxMPMCQueue& operator=(OSInterface_LinuxMPMCQueue&&)      = delete;
+
+    ~OSInterface_LinuxMPMCQueue() override = default;
+
+    /**
+     * @return true if the queue storage was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] bool     isEmpty() override;
+    [[nodiscard]] bool     isFull() override;
+    void                   reset() override;
+    bool                   receive(void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   receiveMicros(void* message, uint32_t maxTimeToWait_us) override;
+    bool                   receiveFromISR(void* message) override;
+    bool                   sendToBack(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToBackMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToBackFromISR(const void* message) override;
+    bool                   sendToFront(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToFrontFromISR(const void* message) override;
+    void*                  acquireSendSlot(uint32_t maxTimeToWait_ms) override;
+    void                   commitSend(void* slot) override;
+    const void*            peekReceiveSlot(uint32_t maxTimeToWait_ms) override;
+    void                   releaseReceive(const void* slot) override;
+    uint32_t               sendToBackN(const void* messages, uint32_t count, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendToBackNFromISR(const void* messages, uint32_t count) override;
+    uint32_t               receiveN(void* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveNFromISR(void* messages, uint32_t maxMessages) override;
+    uint32_t               drain(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    uint32_t               drainFromISR(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    bool                   pollReady() override;
+
+#ifdef OSInterface_INSTRUMENTATION
+    void setName(const char* name) override
+    {
+        stats.setName(name);
+    }
+
+    OSInterface_InstrumentationStats& getStats()
+    {
+        return stats;
+    }
+#endif
+
+private:
+    [[nodiscard]] uint32_t slotOf(uint64_t position) const;
+    [[nodiscard]] uint32_t slotIndex(const void* address) const;
+
+    uint8_t* tryReserveSend();
+    uint8_t* tryReserveReceive();
+    uint64_t tryReserveSendN(uint32_t count, uint32_t& reserved);
+    uint64_t tryReserveReceiveN(uint32_t count, uint32_t& reserved);
+    bool     tryReceive(void* message);
+    bool     trySend(const void* message);
+    uint32_t tryReceiveN(void* messages, uint32_t count);
+    uint32_t trySendN(const void* messages, uint32_t count);
+#ifdef OSInterface_INSTRUMENTATION
+    void recordLength();
+#endif
+
+    const uint32_t                           maxMessages;
+    const uint32_t                           messageSize;
+    const bool                               powerOfTwo;
+    std::unique_ptr<std::atomic<uint64_t>[]> sequences;
+    std::unique_ptr<uint8_t[]>               storage;
+
+    OSInterface_LinuxEventCount notEmpty;
+    OSInterface_LinuxEventCount notFull;
+
+#ifdef OSInterface_INSTRUMENTATION
+    OSInterface_InstrumentationStats stats{OSInterface_InstrumentationStats::QUEUE};
+#endif
+
+    alignas(OSInterface_LINUX_CACHE_LINE_SIZE) std::atomic<uint64_t> enqueuePosition{0};
+    alignas(OSInterface_LINUX_CACHE_LINE_SIZE) std::atomic<uint64_t> dequeuePosition{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXLOCKFREEQUEUE_H
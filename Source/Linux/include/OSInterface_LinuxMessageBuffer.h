@@ -0,0 +1,75 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXMESSAGEBUFFER_H
+#define OSINTERFACE_OSINTERFACE_LINUXMESSAGEBUFFER_H
+
+#include <cstdint>
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_MessageBuffer.h"
+#include "OSInterface_MessageRing.h"
+
+/**
+ * @brief Message buffer protected by a futex mutex
+ *
+ * Blocked senders and receivers sleep on event counts that are only signaled when somebody is actually waiting.
+ * Messages are copied under the lock, and only their own bytes are.
+ */
+class OSInterface_LinuxMessageBuffer final : public OSInterface_MessageBuffer
+{
+public:
+    /**
+     * @brief Create the buffer
+     *
+     * @param capacity Size of the ring in bytes, headers included
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    explicit OSInterface_LinuxMessageBuffer(const uint32_t capacity) : ring(capacity)
+    {
+    }
+
+    OSInterface_LinuxMessageBuffer(const OSInterface_LinuxMessageBuffer&)            = delete;
+    OSInterface_LinuxMessageBuffer& operator=(const OSInterface_LinuxMessageBuffer&) = delete;
+    OSInterface_LinuxMessageBuffer(OSInterface_LinuxMessageBuffer&&)                 = delete;
+    OSInterface_LinuxMessageBuffer& operator=(OSInterface_LinuxMessageBuffer&&)      = delete;
+
+    ~OSInterface_LinuxMessageBuffer() override = default;
+
+    /**
+     * @return true if the ring was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return ring.isValid();
+    }
+
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] uint32_t maxMessageLength() override;
+    [[nodiscard]] uint32_t nextLength() override;
+    [[nodiscard]] bool     isEmpty() override;
+    void                   reset() override;
+    bool                   send(const void* message, uint32_t length, uint32_t maxTimeToWait_ms) override;
+    bool                   sendFromISR(const void* message, uint32_t length) override;
+    uint32_t               receive(void* buffer, uint32_t bufferSize, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveFromISR(void* buffer, uint32_t bufferSize) override;
+    void*                  acquireSend(uint32_t length, uint32_t maxTimeToWait_ms) override;
+    void*                  acquireSendFromISR(uint32_t length) override;
+    void                   commitSend(void* message) override;
+    const void*            peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    const void*            peekReceiveFromISR(uint32_t& length) override;
+    void                   releaseReceive(const void* message) override;
+
+private:
+    static constexpr uint32_t TOO_LONG = UINT32_MAX; // tryReceive() result for a message longer than the buffer
+
+    bool        trySend(const void* message, uint32_t length);
+    uint32_t    tryReceive(void* buffer, uint32_t bufferSize);
+    void*       tryAcquireSend(uint32_t length);
+    const void* tryPeekReceive(uint32_t& length);
+
+    OSInterface_LinuxMutex      lock;
+    OSInterface_LinuxEventCount notEmpty;
+    OSInterface_LinuxEventCount notFull;
+    OSInterface_MessageRing     ring; // Guarded by lock
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXMESSAGEBUFFER_H
@@ -0,0 +1,141 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXMUTEX_H
+#define OSINTERFACE_OSINTERFACE_LINUXMUTEX_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_Instrumentation.h"
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_Mutex.h"
+
+/**
+ * @brief Futex-based mutex
+ *
+ * The futex word holds UNLOCKED, LOCKED (no waiters) or CONTENDED (possibly waiters). Locking and unlocking an
+ * uncontended mutex is a single atomic instruction and never enters the kernel.
+ *
+ * An adaptive mutex spins before sleeping, up to twice the number of spins that recently sufficed to take the mutex, so
+ * that it keeps spinning only while spinning pays off. It never spins on a single-CPU system.
+ */
+class OSInterface_LinuxMutex final : public OSInterface_Mutex
+{
+public:
+    OSInterface_LinuxMutex() = default;
+
+    /**
+     * @param adaptive true to spin for a short while before sleeping, false to sleep right away
+     */
+    explicit OSInterface_LinuxMutex(const bool adaptive) : adaptive(adaptive)
+    {
+    }
+
+    OSInterface_LinuxMutex(const OSInterface_LinuxMutex&)            = delete;
+    OSInterface_LinuxMutex& operator=(const OSInterface_LinuxMutex&) = delete;
+    OSInterface_LinuxMutex(OSInterface_LinuxMutex&&)                 = delete;
+    OSInterface_LinuxMutex& operator=(OSInterface_LinuxMutex&&)      = delete;
+
+    ~OSInterface_LinuxMutex() override = default;
+
+    void signal() override
+    {
+#ifdef OSInterface_INSTRUMENTATION
+        stats.holdTime.record(OSInterface_LinuxClock::nowNanos() - lockedAt_ns);
+#endif
+        if (state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+        {
+            wakeOne();
+        }
+    }
+
+    bool wait(const uint32_t maxTimeToWait_ms) override
+    {
+        return waitFor(maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitMicros(const uint32_t maxTimeToWait_us) override
+    {
+        return waitFor(maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+    /**
+     * @brief Lock the mutex without timeout. Together with unlock() this makes the mutex usable with std::lock_guard.
+     */
+    void lock()
+    {
+        uint32_t expected = UNLOCKED;
+        if (!state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            lockContended(expected);
+        }
+        acquired();
+    }
+
+    /**
+     * @brief Unlock the mutex
+     */
+    void unlock()
+    {
+        signal();
+    }
+
+    /**
+     * @brief Lock the mutex within a timeout
+     *
+     * @param timeout_ns Maximum time to wait in nanoseconds
+     * @return true if the mutex was acquired, false if the timeout was reached
+     */
+    bool waitFor(const uint64_t timeout_ns)
+    {
+        uint32_t expected = UNLOCKED;
+        if (state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed) ||
+            waitContended(expected, timeout_ns))
+        {
+            acquired();
+            return true;
+        }
+        return false;
+    }
+
+#ifdef OSInterface_INSTRUMENTATION
+    void setName(const char* name) override
+    {
+        stats.setName(name);
+    }
+
+    OSInterface_InstrumentationStats& getStats()
+    {
+        return stats;
+    }
+#endif
+
+private:
+    static constexpr uint32_t UNLOCKED  = 0;
+    static constexpr uint32_t LOCKED    = 1;
+    static constexpr uint32_t CONTENDED = 2;
+    static constexpr uint32_t MIN_SPINS = 10;
+    static constexpr uint32_t MAX_SPINS = 100;
+
+    void acquired()
+    {
+#ifdef OSInterface_INSTRUMENTATION
+        stats.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        lockedAt_ns = OSInterface_LinuxClock::nowNanos();
+#endif
+    }
+
+    bool spin();
+    bool waitContended(uint32_t current, uint64_t timeout_ns);
+    bool sleepContended(uint32_t current, uint64_t timeout_ns);
+    void lockContended(uint32_t current);
+    void wakeOne();
+
+    std::atomic<uint32_t> state{UNLOCKED};
+    std::atomic<uint32_t> spinEstimate{0}; // Spins that recently sufficed, updated without synchronization
+    const bool            adaptive{false};
+
+#ifdef OSInterface_INSTRUMENTATION
+    OSInterface_InstrumentationStats stats{OSInterface_InstrumentationStats::MUTEX};
+    uint64_t                         lockedAt_ns{0}; // Written by the owner
+#endif
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXMUTEX_H
@@ -0,0 +1,118 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXPRIORITYQUEUE_H
+#define OSINTERFACE_OSINTERFACE_LINUXPRIORITYQUEUE_H
+
+#include <cstdint>
+#include "OSInterface_Instrumentation.h"
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_LinuxWaitSet.h"
+#include "OSInterface_PriorityRing.h"
+#include "OSInterface_UntypedPriorityQueue.h"
+
+/**
+ * @brief Priority queue protected by a futex mutex
+ *
+ * Blocked receivers sleep on one event count, blocked senders on the event count of the level they send to, so that
+ * freeing a slot only wakes a sender that can use it. Messages are copied under the lock.
+ */
+class OSInterface_LinuxPriorityQueue final : public OSInterface_UntypedPriorityQueue, public OSInterface_LinuxWaitable
+{
+public:
+    /**
+     * @brief Create the queue
+     *
+     * @param maxMessages Maximum number of messages of each priority
+     * @param messageSize Size of each message in bytes
+     * @param priorityLevels Number of priority levels, from 1 to MAX_PRIORITY_LEVELS
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_LinuxPriorityQueue(const uint32_t maxMessages, const uint32_t messageSize,
+                                   const uint32_t priorityLevels) :
+        ring(priorityLevels, maxMessages, messageSize)
+    {
+#ifdef OSInterface_INSTRUMENTATION
+        notEmpty.instrument(&stats.wait);
+        for (OSInterface_LinuxEventCount& level : notFull)
+        {
+            level.instrument(&stats.sendWait);
+        }
+#endif
+    }
+
+    OSInterface_LinuxPriorityQueue(const OSInterface_LinuxPriorityQueue&)            = delete;
+    OSInterface_LinuxPriorityQueue& operator=(const OSInterface_LinuxPriorityQueue&) = delete;
+    OSInterface_LinuxPriorityQueue(OSInterface_LinuxPriorityQueue&&)                 = delete;
+    OSInterface_LinuxPriorityQueue& operator=(OSInterface_LinuxPriorityQueue&&)      = delete;
+
+    ~OSInterface_LinuxPriorityQueue() override = default;
+
+    /**
+     * @return true if the ring was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return ring.isValid();
+    }
+
+    [[nodiscard]] uint32_t priorityLevels() override;
+    [[nodiscard]] uint32_t length(uint32_t priority) override;
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] bool     isEmpty() override;
+    [[nodiscard]] bool     isFull() override;
+    void                   reset() override;
+    bool                   receive(void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   receiveMicros(void* message, uint32_t maxTimeToWait_us) override;
+    bool                   receiveFromISR(void* message) override;
+    bool                   send(const void* message, uint32_t priority, uint32_t maxTimeToWait_ms) override;
+    bool                   sendMicros(const void* message, uint32_t priority, uint32_t maxTimeToWait_us) override;
+    bool                   sendFromISR(const void* message, uint32_t priority) override;
+    bool                   sendToBack(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToBackMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToBackFromISR(const void* message) override;
+    bool                   sendToFront(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToFrontMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToFrontFromISR(const void* message) override;
+    void*                  acquireSendSlot(uint32_t maxTimeToWait_ms) override;
+    void                   commitSend(void* slot) override;
+    const void*            peekReceiveSlot(uint32_t maxTimeToWait_ms) override;
+    void                   releaseReceive(const void* slot) override;
+    uint32_t               sendToBackN(const void* messages, uint32_t count, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendToBackNFromISR(const void* messages, uint32_t count) override;
+    uint32_t               receiveN(void* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveNFromISR(void* messages, uint32_t maxMessages) override;
+    uint32_t               drain(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    uint32_t               drainFromISR(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    bool                   pollReady() override;
+
+#ifdef OSInterface_INSTRUMENTATION
+    void setName(const char* name) override
+    {
+        stats.setName(name);
+    }
+
+    OSInterface_InstrumentationStats& getStats()
+    {
+        return stats;
+    }
+#endif
+
+private:
+    bool     tryReceive(void* message);
+    bool     trySend(const void* message, uint32_t priority, bool toFront);
+    bool     sendFor(const void* message, uint32_t priority, uint64_t timeout_ns, bool toFront);
+    uint32_t tryReceiveN(void* messages, uint32_t count);
+    uint32_t trySendN(const void* messages, uint32_t count);
+    void     slotFreed(const void* slot);
+
+    OSInterface_LinuxMutex      lock;
+    OSInterface_LinuxEventCount notEmpty;
+    OSInterface_LinuxEventCount notFull[MAX_PRIORITY_LEVELS]; // One per level
+    OSInterface_PriorityRing    ring;                         // Guarded by lock
+#ifdef OSInterface_INSTRUMENTATION
+    OSInterface_InstrumentationStats stats{OSInterface_InstrumentationStats::QUEUE};
+#endif
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXPRIORITYQUEUE_H
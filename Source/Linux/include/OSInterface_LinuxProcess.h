@@ -0,0 +1,63 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXPROCESS_H
+#define OSINTERFACE_OSINTERFACE_LINUXPROCESS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <pthread.h>
+#include "OSInterface.h"
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_Process.h"
+
+/**
+ * @brief Thread started by OSInterface_Linux::osRunProcess() with attributes, also used as its join handle
+ *
+ * The thread is created with pthread attributes rather than std::thread, so that its affinity, scheduling and stack are
+ * set before it runs its first instruction. A locked stack is mapped by this object with a guard page below it, and
+ * locked with mlock(), which also faults every page in.
+ */
+class OSInterface_LinuxProcess final : public OSInterface_Process
+{
+public:
+    OSInterface_LinuxProcess(OSInterfaceProcess process, void* arg);
+
+    OSInterface_LinuxProcess(const OSInterface_LinuxProcess&)            = delete;
+    OSInterface_LinuxProcess& operator=(const OSInterface_LinuxProcess&) = delete;
+    OSInterface_LinuxProcess(OSInterface_LinuxProcess&&)                 = delete;
+    OSInterface_LinuxProcess& operator=(OSInterface_LinuxProcess&&)      = delete;
+
+    ~OSInterface_LinuxProcess() override;
+
+    /**
+     * @brief Start the thread
+     *
+     * @return true if the thread was started, false if the attributes could not be applied (the error is logged)
+     */
+    bool start(const OSInterface_ProcessAttributes& attributes);
+
+    void               join() override;
+    bool               join(uint32_t maxTimeToWait_ms) override;
+    [[nodiscard]] bool isDone() override;
+
+private:
+    static constexpr uint32_t RUNNING = 0;
+    static constexpr uint32_t DONE    = 1;
+    static constexpr uint32_t WAITED  = 2; // Running with at least one thread sleeping on it
+
+    static void* run(void* self);
+
+    bool setAttributes(pthread_attr_t& threadAttributes, const OSInterface_ProcessAttributes& attributes);
+    bool mapLockedStack(pthread_attr_t& threadAttributes, size_t size);
+    bool joinUntil(const OSInterface_LinuxDeadline* deadline);
+
+    const OSInterfaceProcess process;
+    void* const              arg;
+    std::atomic<uint32_t>    state{RUNNING};
+    pthread_t                thread{};
+    bool                     started{false};
+    char                     name[16]{}; // Linux limits thread names to 15 characters plus the terminator
+    void*                    stackMapping{nullptr}; // Guard page and locked stack, nullptr if the stack is pthread's
+    size_t                   stackMappingSize{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXPROCESS_H
@@ -0,0 +1,106 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXRWLOCK_H
+#define OSINTERFACE_OSINTERFACE_LINUXRWLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include "OSInterface_LinuxClock.h"
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_RWLock.h"
+
+/**
+ * @brief Futex-based reader-writer lock with distributed reader counts
+ *
+ * Readers count themselves in one of several cache-line-sized slots, picked per thread, so readers on different cores
+ * do not write to the same cache line. Taking and releasing a read lock is one atomic instruction and one load while no
+ * writer is around. A writer first raises a flag that sends new readers to sleep, then waits for the slots to empty;
+ * writers are serialized by a mutex. Nothing enters the kernel unless a thread has to sleep.
+ */
+class OSInterface_LinuxRWLock final : public OSInterface_RWLock
+{
+public:
+    OSInterface_LinuxRWLock() = default;
+
+    OSInterface_LinuxRWLock(const OSInterface_LinuxRWLock&)            = delete;
+    OSInterface_LinuxRWLock& operator=(const OSInterface_LinuxRWLock&) = delete;
+    OSInterface_LinuxRWLock(OSInterface_LinuxRWLock&&)                 = delete;
+    OSInterface_LinuxRWLock& operator=(OSInterface_LinuxRWLock&&)      = delete;
+
+    ~OSInterface_LinuxRWLock() override = default;
+
+    bool waitRead(const uint32_t maxTimeToWait_ms) override
+    {
+        return readFor(maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitReadMicros(const uint32_t maxTimeToWait_us) override
+    {
+        return readFor(maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+    void signalRead() override
+    {
+        slots[threadSlot()].readers.fetch_sub(1, std::memory_order_seq_cst);
+        if (writer.load(std::memory_order_seq_cst) != 0)
+        {
+            readersGone.notifyOne();
+        }
+    }
+
+    bool waitWrite(const uint32_t maxTimeToWait_ms) override
+    {
+        return writeFor(maxTimeToWait_ms * OSInterface_LinuxClock::NANOS_PER_MILLI);
+    }
+
+    bool waitWriteMicros(const uint32_t maxTimeToWait_us) override
+    {
+        return writeFor(maxTimeToWait_us * OSInterface_LinuxClock::NANOS_PER_MICRO);
+    }
+
+    void signalWrite() override;
+
+private:
+    static constexpr uint32_t READER_SLOTS = 16;
+
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint32_t> readers{0};
+    };
+
+    /**
+     * @brief Get the slot of the calling thread, assigned round-robin on its first read lock
+     */
+    static uint32_t threadSlot();
+
+    bool tryRead(ReaderSlot& slot)
+    {
+        // Pairs with the writer raising its flag then reading the slots: one of the two sees the other
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if (writer.load(std::memory_order_seq_cst) == 0)
+        {
+            return true;
+        }
+        slot.readers.fetch_sub(1, std::memory_order_seq_cst);
+        readersGone.notifyOne();
+        return false;
+    }
+
+    bool readFor(const uint64_t timeout_ns)
+    {
+        ReaderSlot& slot = slots[threadSlot()];
+        return tryRead(slot) || readContended(slot, timeout_ns);
+    }
+
+    bool readContended(ReaderSlot& slot, uint64_t timeout_ns);
+    bool writeFor(uint64_t timeout_ns);
+    bool hasReaders() const;
+
+    ReaderSlot slots[READER_SLOTS];
+
+    alignas(64) std::atomic<uint32_t> writer{0}; // Set while a writer holds or waits for the lock
+    OSInterface_LinuxMutex      writerLock;      // Held by the writer that set the flag
+    OSInterface_LinuxEventCount writerGone;      // Readers wait on it for the flag to be cleared
+    OSInterface_LinuxEventCount readersGone;     // The writer waits on it for the slots to empty
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXRWLOCK_H
@@ -0,0 +1,78 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXSTREAMBUFFER_H
+#define OSINTERFACE_OSINTERFACE_LINUXSTREAMBUFFER_H
+
+#include <cstdint>
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_StreamBuffer.h"
+#include "OSInterface_StreamRing.h"
+
+/**
+ * @brief Stream buffer protected by a futex mutex
+ *
+ * The reader sleeps on an event count that senders only signal once the stream reaches the trigger level, and only
+ * when the reader is actually waiting. Views handed out by the zero-copy API are read and written outside the lock.
+ */
+class OSInterface_LinuxStreamBuffer final : public OSInterface_StreamBuffer
+{
+public:
+    /**
+     * @brief Create the buffer
+     *
+     * @param capacity Size of the ring in bytes
+     * @param triggerLevel Number of bytes the stream must hold before a blocked receive returns, at most capacity
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_LinuxStreamBuffer(const uint32_t capacity, const uint32_t triggerLevel) :
+        ring(capacity), triggerLevel(triggerLevel == 0 ? 1 : triggerLevel)
+    {
+    }
+
+    OSInterface_LinuxStreamBuffer(const OSInterface_LinuxStreamBuffer&)            = delete;
+    OSInterface_LinuxStreamBuffer& operator=(const OSInterface_LinuxStreamBuffer&) = delete;
+    OSInterface_LinuxStreamBuffer(OSInterface_LinuxStreamBuffer&&)                 = delete;
+    OSInterface_LinuxStreamBuffer& operator=(OSInterface_LinuxStreamBuffer&&)      = delete;
+
+    ~OSInterface_LinuxStreamBuffer() override = default;
+
+    /**
+     * @return true if the ring was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return ring.isValid();
+    }
+
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t available() override;
+    bool                   setTriggerLevel(uint32_t triggerLevel) override;
+    void                   reset() override;
+    uint32_t               send(const void* data, uint32_t length, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendFromISR(const void* data, uint32_t length) override;
+    uint32_t               receive(void* buffer, uint32_t maxLength, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveFromISR(void* buffer, uint32_t maxLength) override;
+    void*                  acquireSend(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    void*                  acquireSendFromISR(uint32_t& length) override;
+    void                   commitSend(uint32_t written) override;
+    const void*            peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    const void*            peekReceiveFromISR(uint32_t& length) override;
+    void                   releaseReceive(uint32_t consumed) override;
+
+private:
+    uint32_t    trySend(const void* data, uint32_t length);
+    uint32_t    tryReceive(void* buffer, uint32_t maxLength, bool triggeredOnly);
+    void*       tryAcquireSend(uint32_t& length);
+    const void* tryPeekReceive(uint32_t& length, bool triggeredOnly);
+    void        sent(bool triggered);
+
+    OSInterface_LinuxMutex      lock;
+    OSInterface_LinuxEventCount notEmpty; // Signaled once the stream reaches the trigger level
+    OSInterface_LinuxEventCount notFull;
+
+    // Guarded by lock
+    OSInterface_StreamRing ring;
+    uint32_t               triggerLevel;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXSTREAMBUFFER_H
@@ -0,0 +1,177 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXTIMER_H
+#define OSINTERFACE_OSINTERFACE_LINUXTIMER_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "OSInterface.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_LinuxWaitSet.h"
+#include "OSInterface_Timer.h"
+
+class OSInterface_LinuxTimerService;
+
+/**
+ * @brief Software timer served by the dispatcher thread of an OSInterface_LinuxTimerService
+ *
+ * As a wait set member, the timer is ready from an expiration until a wait on the set reports it.
+ */
+class OSInterface_LinuxTimer final : public OSInterface_Timer, public OSInterface_LinuxWaitable
+{
+public:
+    OSInterface_LinuxTimer(OSInterface_LinuxTimerService& service, uint32_t period, Mode mode,
+                           OSInterfaceProcess callback, void* callbackArg, const char* timerName);
+
+    OSInterface_LinuxTimer(const OSInterface_LinuxTimer&)            = delete;
+    OSInterface_LinuxTimer& operator=(const OSInterface_LinuxTimer&) = delete;
+    OSInterface_LinuxTimer(OSInterface_LinuxTimer&&)                 = delete;
+    OSInterface_LinuxTimer& operator=(OSInterface_LinuxTimer&&)      = delete;
+
+    /**
+     * @note If the callback is running on the dispatcher thread, the destructor waits for it to return (unless the
+     * timer is deleted from its own callback).
+     */
+    ~OSInterface_LinuxTimer() override;
+
+    bool start() override;
+    bool startFromISR() override;
+    bool stop() override;
+    bool stopFromISR() override;
+    [[nodiscard]] bool isRunning() const override;
+    bool setPeriod(uint32_t newPeriod_ms) override;
+    bool setPeriodFromISR(uint32_t newPeriod_ms) override;
+    [[nodiscard]] uint32_t getPeriod() const override;
+    [[nodiscard]] Mode     getMode() const override;
+    [[nodiscard]] uint32_t getTimeout() const override;
+    [[nodiscard]] uint32_t getTimeoutTime() const override;
+    [[nodiscard]] uint64_t getTimeoutTime64() const override;
+    bool                   pollReady() override;
+
+    /**
+     * @return const char* Name given at creation time (can be nullptr)
+     */
+    [[nodiscard]] const char* getName() const;
+
+    /**
+     * @brief Allow the timer to expire late so that its expirations can be coalesced with those of other timers
+     *
+     * @param newSlack_ms Maximum delay in milliseconds added to every expiration, 0 (the default) to expire on time
+     * @note The new slack applies from the next time the timer is (re)armed.
+     */
+    void setSlack(uint32_t newSlack_ms);
+
+    /**
+     * @return uint32_t Maximum delay in milliseconds added to every expiration
+     */
+    [[nodiscard]] uint32_t getSlack() const;
+
+private:
+    friend class OSInterface_LinuxTimerService;
+
+    static constexpr uint32_t NOT_IN_WHEEL = UINT32_MAX;
+
+    void expire();
+
+    OSInterface_LinuxTimerService& service;
+    const Mode                     mode;
+    const OSInterfaceProcess       callback;
+    void* const                    callbackArg;
+    const char* const              name;
+    std::atomic<uint32_t>          period_ms;
+    std::atomic<uint32_t>          slack_ms{0};
+    std::atomic<bool>              running{false};
+    std::atomic<uint64_t>          expiry_ns{0};
+    std::atomic<bool>              expired{false}; // Not yet reported to the wait set
+
+    // Guarded by the service lock
+    OSInterface_LinuxTimer* wheelPrevious{nullptr};
+    OSInterface_LinuxTimer* wheelNext{nullptr};
+    uint64_t                wheelExpiry{0};          // Tick the timer expires at, slack included
+    uint32_t                wheelSlot{NOT_IN_WHEEL}; // Index of the wheel slot list holding the timer
+};
+
+/**
+ * @brief Single dispatcher thread serving every OSInterface_LinuxTimer of an OSInterface_Linux instance
+ *
+ * Armed timers are kept in a hierarchical timing wheel with a 1 ms tick: WHEEL_LEVELS levels of WHEEL_SLOTS slots,
+ * each slot of a level spanning a whole revolution of the level below. A timer is linked into the slot of the
+ * lowest level able to hold its expiry tick and moved down one or more levels when the wheel reaches that slot, so
+ * arming, re-arming and stopping a timer are O(1). A bitmap of non-empty slots per level gives the next tick with
+ * anything to do, and the dispatcher sleeps until then. Callbacks run one at a time on the dispatcher thread, so
+ * periodic callbacks never overlap.
+ */
+class OSInterface_LinuxTimerService
+{
+public:
+    OSInterface_LinuxTimerService();
+
+    OSInterface_LinuxTimerService(const OSInterface_LinuxTimerService&)            = delete;
+    OSInterface_LinuxTimerService& operator=(const OSInterface_LinuxTimerService&) = delete;
+    OSInterface_LinuxTimerService(OSInterface_LinuxTimerService&&)                 = delete;
+    OSInterface_LinuxTimerService& operator=(OSInterface_LinuxTimerService&&)      = delete;
+
+    /**
+     * @note Every timer must be deleted before the service.
+     */
+    ~OSInterface_LinuxTimerService();
+
+    /**
+     * @brief (Re)arm a timer so that it expires one period from now
+     *
+     * @param timer Timer to arm
+     */
+    void arm(OSInterface_LinuxTimer& timer);
+
+    /**
+     * @brief Disarm a timer
+     *
+     * @param timer Timer to disarm
+     */
+    void disarm(OSInterface_LinuxTimer& timer);
+
+    /**
+     * @brief Disarm a timer that is being deleted and wait for its in-flight callback, if any
+     *
+     * @param timer Timer to remove
+     */
+    void remove(OSInterface_LinuxTimer& timer);
+
+private:
+    static constexpr uint32_t WHEEL_LEVEL_BITS = 6;
+    static constexpr uint32_t WHEEL_SLOTS      = 1U << WHEEL_LEVEL_BITS;
+    static constexpr uint32_t WHEEL_LEVELS     = 6; // 36 bits of ticks, more than the longest period
+    static constexpr uint64_t NO_TICK          = UINT64_MAX;
+
+    static_assert(WHEEL_SLOTS == 64, "Every level's occupancy must fit in a 64-bit bitmap");
+
+    static uint64_t currentTick();
+    static uint64_t tickOf(uint64_t time_ns);
+    static uint64_t applySlack(uint64_t tick, uint32_t slack_ms);
+
+    void     armLocked(OSInterface_LinuxTimer& timer, uint64_t expiry_ns);
+    void     disarmLocked(OSInterface_LinuxTimer& timer);
+    void     link(OSInterface_LinuxTimer& timer, uint64_t tick);
+    void     unlink(OSInterface_LinuxTimer& timer);
+    void     advanceTo(uint64_t tick);
+    uint64_t nextEventTick() const;
+    void     run();
+
+    OSInterface_LinuxMutex lock;
+
+    // Guarded by lock
+    OSInterface_LinuxTimer* slots[WHEEL_LEVELS * WHEEL_SLOTS]{};
+    uint64_t                occupied[WHEEL_LEVELS]{}; // Bit n of level l set if slot n of level l is not empty
+    uint64_t                wheelTick;                // Next tick to expire, every earlier one has been served
+    uint64_t                plannedWakeTick{0};       // Tick the dispatcher sleeps until, 0 while it is awake
+    OSInterface_LinuxTimer* runningTimer{nullptr};
+    bool                    stopping{false};
+
+    // Futexes the dispatcher and remove() sleep on
+    std::atomic<uint32_t> wakeSequence{0};
+    std::atomic<uint32_t> callbackSequence{0};
+    std::atomic<uint32_t> callbackWaiters{0};
+
+    std::thread dispatcher;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXTIMER_H
@@ -0,0 +1,138 @@
+#ifndef OSINTERFACE_OSINTERFACE_LINUXWAITSET_H
+#define OSINTERFACE_OSINTERFACE_LINUXWAITSET_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "OSInterface_LinuxFutex.h"
+#include "OSInterface_LinuxMutex.h"
+#include "OSInterface_WaitSet.h"
+
+class OSInterface_LinuxWaitSet;
+
+/**
+ * @brief Base of the Linux objects that can be members of an OSInterface_LinuxWaitSet
+ *
+ * Objects call notifyWaitSet() whenever they may have become ready. It costs a single load while the object is not a
+ * member of a wait set.
+ */
+class OSInterface_LinuxWaitable
+{
+public:
+    OSInterface_LinuxWaitable() = default;
+
+    OSInterface_LinuxWaitable(const OSInterface_LinuxWaitable&)            = delete;
+    OSInterface_LinuxWaitable& operator=(const OSInterface_LinuxWaitable&) = delete;
+    OSInterface_LinuxWaitable(OSInterface_LinuxWaitable&&)                 = delete;
+    OSInterface_LinuxWaitable& operator=(OSInterface_LinuxWaitable&&)      = delete;
+
+    virtual ~OSInterface_LinuxWaitable() = default;
+
+    /**
+     * @brief Check whether the object is ready
+     *
+     * @return true if the object is ready, false otherwise
+     * @note Edge-triggered objects (timers) clear their ready state when it is reported.
+     */
+    virtual bool pollReady() = 0;
+
+    /**
+     * @brief Make the object a member of a wait set
+     *
+     * @param set Wait set to notify from now on
+     * @return true if attached, false if the object already belongs to a wait set
+     */
+    bool attach(OSInterface_LinuxWaitSet& set);
+
+    /**
+     * @brief Stop notifying the wait set of the object
+     *
+     * @note Once this returns, no notification to the previous wait set is in flight.
+     */
+    void detach();
+
+protected:
+    /**
+     * @brief Wake up the wait set of the object, if any
+     *
+     * @note The change that made the object ready must be ordered before this call by a sequentially consistent
+     * operation, for instance the fence of an event count notification.
+     */
+    void notifyWaitSet()
+    {
+        if (waitSet.load(std::memory_order_seq_cst) != nullptr)
+        {
+            notifyWaitSetSlow();
+        }
+    }
+
+    /**
+     * @return true if the object is a member of a wait set, false otherwise
+     */
+    [[nodiscard]] bool isInWaitSet() const
+    {
+        return waitSet.load(std::memory_order_relaxed) != nullptr;
+    }
+
+private:
+    void notifyWaitSetSlow();
+
+    OSInterface_LinuxMutex                 attachLock;
+    std::atomic<OSInterface_LinuxWaitSet*> waitSet{nullptr};
+};
+
+/**
+ * @brief Futex-based wait set
+ *
+ * Members wake the set through an event count, so a thread waiting on the set sleeps in the kernel until one of them
+ * may have become ready and then polls every member. Polling starts after the last reported member so that a busy
+ * member cannot starve the others.
+ */
+class OSInterface_LinuxWaitSet final : public OSInterface_WaitSet
+{
+public:
+    OSInterface_LinuxWaitSet() = default;
+
+    OSInterface_LinuxWaitSet(const OSInterface_LinuxWaitSet&)            = delete;
+    OSInterface_LinuxWaitSet& operator=(const OSInterface_LinuxWaitSet&) = delete;
+    OSInterface_LinuxWaitSet(OSInterface_LinuxWaitSet&&)                 = delete;
+    OSInterface_LinuxWaitSet& operator=(OSInterface_LinuxWaitSet&&)      = delete;
+
+    ~OSInterface_LinuxWaitSet() override;
+
+    bool     add(OSInterface_UntypedQueue* queue) override;
+    bool     add(OSInterface_BinarySemaphore* semaphore) override;
+    bool     add(OSInterface_Timer* timer) override;
+    bool     remove(OSInterface_UntypedQueue* queue) override;
+    bool     remove(OSInterface_BinarySemaphore* semaphore) override;
+    bool     remove(OSInterface_Timer* timer) override;
+    uint32_t wait(const void** readyMembers, uint32_t maxMembers, uint32_t maxTimeToWait_ms) override;
+
+    /**
+     * @brief Wake up the threads waiting on the set so that they poll the members again
+     */
+    void notify()
+    {
+        event.notifyAll();
+    }
+
+private:
+    struct Member
+    {
+        const void*                handle; // Pointer given to add()
+        OSInterface_LinuxWaitable* waitable;
+    };
+
+    bool     addMember(const void* handle, OSInterface_LinuxWaitable* waitable);
+    bool     removeMember(const void* handle);
+    uint32_t poll(const void** readyMembers, uint32_t maxMembers);
+
+    OSInterface_LinuxEventCount event;
+    OSInterface_LinuxMutex      lock;
+
+    // Guarded by lock
+    std::vector<Member> members;
+    size_t              nextMember{0}; // Member polled first by the next wait()
+};
+
+#endif // OSINTERFACE_OSINTERFACE_LINUXWAITSET_H
@@ -0,0 +1,394 @@
+#ifdef OSInterface_ASYNC_LOG
+
+    #include <algorithm>
+    #include <atomic>
+    #include <chrono>
+    #include <cstdlib>
+    #include <mutex>
+    #include <new>
+    #include <system_error>
+    #include <thread>
+    #include <vector>
+    #include "OSInterface_AsyncLog.h"
+
+static constexpr size_t RING_SIZE    = 64 * 1024; // Bytes of records buffered per thread
+static constexpr size_t OUTPUT_SIZE  = 64 * 1024; // Bytes written to stdout at once
+static constexpr size_t LINE_SIZE    = 1024;      // Longer lines are truncated
+static constexpr size_t ALIGNMENT    = 8;
+static constexpr auto   DRAIN_PERIOD = std::chrono::milliseconds(10);
+
+struct RecordHeader
+{
+    uint32_t                size; // Bytes of the record, header included. 0 to skip to the start of the ring.
+    uint16_t                argumentsSize;
+    uint8_t                 level;
+    uint8_t                 padding;
+    uint64_t                timestamp_ns;
+    const char*             tag;
+    const char*             format;
+    const char*             signature;
+    OSInterfaceLogFormatter formatter;
+};
+
+static_assert(sizeof(RecordHeader) % ALIGNMENT == 0, "Records must stay aligned in the ring");
+
+/**
+ * @brief Single-producer single-consumer ring of the records of one thread
+ */
+struct Ring
+{
+    // Written by the owning thread
+    alignas(64) std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> dropped{0};
+    uint64_t              record{0}; // Position of the record being written
+    uint64_t              recordEnd{0};
+    size_t                recordArgumentsSize{0};
+
+    // Written by the drain thread
+    alignas(64) std::atomic<uint64_t> tail{0};
+    uint64_t reportedDrops{0};
+
+    std::atomic<bool> retired{false}; // Set once the owning thread exited
+    Ring*             next{nullptr};  // Changed under the registry lock
+
+    alignas(RecordHeader) uint8_t buffer[RING_SIZE];
+};
+
+struct LogState
+{
+    std::mutex         registryLock;
+    std::atomic<Ring*> rings{nullptr};
+    uint64_t           retiredDrops{0}; // Guarded by registryLock, drops of the rings already deleted
+
+    std::atomic<uint64_t> lostRecords{0}; // Records of threads without a ring
+    uint64_t              reportedLostRecords{0};
+
+    // Held while draining, by the drain thread or by flush()
+    std::mutex           drainLock;
+    OSInterface_LogSink* sink{nullptr}; // Guarded by drainLock, nullptr for stdout
+
+    struct Reader
+    {
+        Ring*    ring;
+        uint64_t position;
+        uint64_t limit; // Head when the pass started, so that a pass always ends
+    };
+
+    std::vector<Reader> readers;
+    char                output[OUTPUT_SIZE];
+    size_t              outputLength{0};
+};
+
+static void drainLoop();
+
+static LogState& state()
+{
+    // Never deleted, detached threads may still log while static objects are destroyed
+    static LogState* instance = []
+    {
+        auto* created = new LogState();
+        try
+        {
+            std::thread(drainLoop).detach();
+        }
+        catch (const std::system_error&)
+        {
+            // Records are then only written by flush()
+        }
+        std::atexit(OSInterface_AsyncLog::flush);
+        return created;
+    }();
+    return *instance;
+}
+
+static thread_local Ring* threadRing         = nullptr;
+static thread_local bool  threadRingReleased = false;
+
+struct RingOwner
+{
+    ~RingOwner()
+    {
+        threadRingReleased = true;
+        if (threadRing != nullptr)
+        {
+            threadRing->retired.store(true, std::memory_order_release);
+            threadRing = nullptr;
+        }
+    }
+};
+
+static Ring* createThreadRing()
+{
+    if (threadRingReleased)
+    {
+        return nullptr; // Logging from a thread_local destructor
+    }
+    static thread_local RingOwner owner;
+    auto*                         ring = new (std::nothrow) Ring();
+    if (ring != nullptr)
+    {
+        LogState&       log = state();
+        std::lock_guard guard(log.registryLock);
+        ring->next = log.rings.load(std::memory_order_relaxed);
+        log.rings.store(ring, std::memory_order_release);
+    }
+    threadRing = ring;
+    return ring;
+}
+
+static uint64_t nowNanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint8_t* OSInterface_AsyncLog::reserve(const size_t size)
+{
+    Ring* ring = threadRing != nullptr ? threadRing : createThreadRing();
+    if (ring == nullptr)
+    {
+        state().lostRecords.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const size_t   recordSize = (sizeof(RecordHeader) + size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    uint64_t       head       = ring->head.load(std::memory_order_relaxed);
+    const size_t   contiguous = RING_SIZE - head % RING_SIZE;
+    const size_t   skip       = recordSize > contiguous ? contiguous : 0;
+    const uint64_t tail       = ring->tail.load(std::memory_order_acquire);
+    if (recordSize > RING_SIZE / 2 || head + skip + recordSize - tail > RING_SIZE)
+    {
+        ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    if (skip != 0)
+    {
+        reinterpret_cast<RecordHeader*>(&ring->buffer[head % RING_SIZE])->size = 0;
+        head += skip;
+    }
+    ring->record              = head;
+    ring->recordEnd           = head + recordSize;
+    ring->recordArgumentsSize = size;
+    return &ring->buffer[head % RING_SIZE] + sizeof(RecordHeader);
+}
+
+void OSInterface_AsyncLog::commit(uint8_t* arguments, const uint8_t level, const char* tag, const char* format,
+                                  const char* signature, const OSInterfaceLogFormatter formatter)
+{
+    Ring* ring            = threadRing;
+    auto* header          = reinterpret_cast<RecordHeader*>(arguments - sizeof(RecordHeader));
+    header->size          = static_cast<uint32_t>(ring->recordEnd - ring->record);
+    header->argumentsSize = static_cast<uint16_t>(ring->recordArgumentsSize);
+    header->level         = level;
+    header->timestamp_ns  = nowNanos();
+    header->tag           = tag;
+    header->format        = format;
+    header->signature     = signature;
+    header->formatter     = formatter;
+    ring->head.store(ring->recordEnd, std::memory_order_release);
+}
+
+static void writeOutput(LogState& log)
+{
+    if (log.outputLength != 0)
+    {
+        fwrite(log.output, 1, log.outputLength, stdout);
+        log.outputLength = 0;
+    }
+}
+
+/**
+ * @brief Format a line into the output buffer, writing the buffer out first if the line may not fit
+ */
+static void formatLine(LogState& log, const OSInterface_LogRecord& record)
+{
+    if (OUTPUT_SIZE - log.outputLength < LINE_SIZE)
+    {
+        writeOutput(log);
+    }
+    char*     line   = &log.output[log.outputLength];
+    const int length = record.toText(line, LINE_SIZE);
+    if (length <= 0)
+    {
+        return;
+    }
+    if (static_cast<size_t>(length) >= LINE_SIZE)
+    {
+        line[LINE_SIZE - 2] = '\n'; // Truncated
+        log.outputLength += LINE_SIZE - 1;
+        return;
+    }
+    log.outputLength += static_cast<size_t>(length);
+}
+
+static void reportDrops(LogState& log, const uint64_t drops, uint64_t& reported)
+{
+    if (drops != reported)
+    {
+        if (OUTPUT_SIZE - log.outputLength < LINE_SIZE)
+        {
+            writeOutput(log);
+        }
+        const int length = snprintf(&log.output[log.outputLength], LINE_SIZE,
+                                    "Warning - OSInterface_AsyncLog: %llu log records dropped\n",
+                                    static_cast<unsigned long long>(drops - reported));
+        log.outputLength += static_cast<size_t>(std::max(length, 0));
+        reported = drops;
+    }
+}
+
+/**
+ * @brief Get the oldest record of a reader, skipping the end of the ring when the records wrap
+ *
+ * @return const RecordHeader* The record, nullptr if the reader reached its limit
+ */
+static const RecordHeader* nextRecord(LogState::Reader& reader)
+{
+    while (reader.position != reader.limit)
+    {
+        const auto* header = reinterpret_cast<const RecordHeader*>(&reader.ring->buffer[reader.position % RING_SIZE]);
+        if (header->size != 0)
+        {
+            return header;
+        }
+        reader.position += RING_SIZE - reader.position % RING_SIZE;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Write every record committed before the call, merging the threads in timestamp order
+ *
+ * @note Must be called with the drain lock held.
+ */
+static void drainPass(LogState& log)
+{
+    log.readers.clear();
+    for (Ring* ring = log.rings.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+    {
+        log.readers.push_back({ring, ring->tail.load(std::memory_order_relaxed),
+                               ring->head.load(std::memory_order_acquire)});
+    }
+
+    while (true)
+    {
+        LogState::Reader*   oldest       = nullptr;
+        const RecordHeader* oldestRecord = nullptr;
+        for (LogState::Reader& reader : log.readers)
+        {
+            const RecordHeader* record = nextRecord(reader);
+            if (record != nullptr && (oldestRecord == nullptr || record->timestamp_ns < oldestRecord->timestamp_ns))
+            {
+                oldest       = &reader;
+                oldestRecord = record;
+            }
+        }
+        if (oldest == nullptr)
+        {
+            break;
+        }
+        const OSInterface_LogRecord record{oldestRecord->timestamp_ns,
+                                           oldestRecord->level,
+                                           oldestRecord->tag,
+                                           oldestRecord->format,
+                                           oldestRecord->signature,
+                                           reinterpret_cast<const uint8_t*>(oldestRecord + 1),
+                                           oldestRecord->argumentsSize,
+                                           oldestRecord->formatter};
+        if (log.sink != nullptr)
+        {
+            log.sink->write(record);
+        }
+        else
+        {
+            formatLine(log, record);
+        }
+        oldest->position += oldestRecord->size;
+        oldest->ring->tail.store(oldest->position, std::memory_order_release);
+    }
+
+    for (const LogState::Reader& reader : log.readers)
+    {
+        reader.ring->tail.store(reader.position, std::memory_order_release);
+        reportDrops(log, reader.ring->dropped.load(std::memory_order_relaxed), reader.ring->reportedDrops);
+    }
+    reportDrops(log, log.lostRecords.load(std::memory_order_relaxed), log.reportedLostRecords);
+    if (log.outputLength != 0)
+    {
+        writeOutput(log);
+        fflush(stdout);
+    }
+    if (log.sink != nullptr)
+    {
+        log.sink->flush();
+    }
+
+    // Rings of exited threads are deleted once they are empty
+    for (const LogState::Reader& reader : log.readers)
+    {
+        Ring* ring = reader.ring;
+        if (ring->retired.load(std::memory_order_acquire) &&
+            ring->head.load(std::memory_order_acquire) == reader.position)
+        {
+            std::lock_guard guard(log.registryLock);
+            Ring*           previous = nullptr;
+            Ring*           current  = log.rings.load(std::memory_order_relaxed);
+            while (current != ring)
+            {
+                previous = current;
+                current  = current->next;
+            }
+            if (previous != nullptr)
+            {
+                previous->next = ring->next;
+            }
+            else
+            {
+                log.rings.store(ring->next, std::memory_order_relaxed);
+            }
+            log.retiredDrops += ring->dropped.load(std::memory_order_relaxed);
+            delete ring;
+        }
+    }
+}
+
+static void drainLoop()
+{
+    LogState& log = state();
+    while (true)
+    {
+        std::this_thread::sleep_for(DRAIN_PERIOD);
+        std::lock_guard guard(log.drainLock);
+        drainPass(log);
+    }
+}
+
+void OSInterface_AsyncLog::flush()
+{
+    LogState&       log = state();
+    std::lock_guard guard(log.drainLock);
+    drainPass(log);
+}
+
+void OSInterface_AsyncLog::setSink(OSInterface_LogSink* sink)
+{
+    LogState&       log = state();
+    std::lock_guard guard(log.drainLock);
+    drainPass(log); // Records logged before the call still go to the previous destination
+    log.sink = sink;
+}
+
+uint64_t OSInterface_AsyncLog::droppedRecords()
+{
+    LogState&       log = state();
+    std::lock_guard guard(log.registryLock);
+    uint64_t        dropped = log.retiredDrops + log.lostRecords.load(std::memory_order_relaxed);
+    for (const Ring* ring = log.rings.load(std::memory_order_relaxed); ring != nullptr; ring = ring->next)
+    {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+#endif // OSInterface_ASYNC_LOG
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include "OSInterface_EventLoop.h"
+
+static const char* TAG = "OSInterface_EventLoop";
+
+bool OSInterface_Awaiter::await_suspend(const std::coroutine_handle<OSInterface_Task::promise_type> task)
+{
+    // Resumes the task at once, with result false, if the loop cannot wait for the object
+    return task.promise().loop->suspend(*this, task);
+}
+
+bool OSInterface_Awaiter::attempt()
+{
+    switch (kind)
+    {
+        case QUEUE:
+            return static_cast<OSInterface_UntypedQueue*>(object)->receive(message, 0);
+        case SEMAPHORE:
+            return static_cast<OSInterface_BinarySemaphore*>(object)->wait(0);
+        case TIMER:
+            // Reported by the wait set once per expiration, the expiration itself is the event
+            return false;
+        default:
+            return true;
+    }
+}
+
+OSInterface_EventLoop::OSInterface_EventLoop(OSInterface& os) :
+    os(os), waitSet(os.osCreateWaitSet()), wakeup(os.osCreateBinarySemaphore())
+{
+    if (waitSet != nullptr && wakeup != nullptr && !waitSet->add(wakeup))
+    {
+        delete wakeup;
+        wakeup = nullptr;
+    }
+}
+
+OSInterface_EventLoop::~OSInterface_EventLoop()
+{
+    for (const auto& [object, member] : members)
+    {
+        removeFromWaitSet(member);
+    }
+    members.clear();
+    deadlines.clear();
+    // The awaiters live in the frames, so the bookkeeping above must be gone before the frames are
+    for (void* frame : tasks)
+    {
+        std::coroutine_handle<>::from_address(frame).destroy();
+    }
+    if (waitSet != nullptr && wakeup != nullptr)
+    {
+        waitSet->remove(wakeup);
+    }
+    delete waitSet;
+    delete wakeup;
+}
+
+bool OSInterface_EventLoop::isValid() const
+{
+    return waitSet != nullptr && wakeup != nullptr;
+}
+
+bool OSInterface_EventLoop::spawn(OSInterface_Task&& task)
+{
+    if (!task.handle)
+    {
+        OSInterfaceLogError(TAG, "Could not allocate a task");
+        return false;
+    }
+    task.handle.promise().loop = this;
+    tasks.insert(task.handle.address());
+    runnable.push_back(task.handle);
+    task.handle = nullptr;
+    return true;
+}
+
+void OSInterface_EventLoop::run()
+{
+    if (!isValid())
+    {
+        OSInterfaceLogError(TAG, "Cannot run an invalid loop");
+        return;
+    }
+    const void* ready[READY_BATCH];
+    while (!stopRequested.exchange(false, std::memory_order_acquire))
+    {
+        resumeRunnable();
+        if (tasks.empty())
+        {
+            return;
+        }
+        const uint32_t timeout = runnable.empty() ? timeUntilNextDeadline() : 0;
+        const uint32_t count   = waitSet->wait(ready, READY_BATCH, timeout);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (ready[i] == wakeup)
+            {
+                wakeup->wait(0);
+            }
+            else
+            {
+                serve(ready[i]);
+            }
+        }
+        expireDeadlines();
+    }
+}
+
+void OSInterface_EventLoop::stop()
+{
+    if (!isValid())
+    {
+        return;
+    }
+    stopRequested.store(true, std::memory_order_release);
+    wakeup->signal();
+}
+
+uint32_t OSInterface_EventLoop::taskCount() const
+{
+    return static_cast<uint32_t>(tasks.size());
+}
+
+/**
+ * @brief Register a task waiting for its awaiter
+ *
+ * @return true if the task is suspended, false if the object could not be added to the wait set
+ */
+bool OSInterface_EventLoop::suspend(OSInterface_Awaiter& awaiter, const std::coroutine_handle<> task)
+{
+    awaiter.task = task;
+    if (awaiter.kind != OSInterface_Awaiter::SLEEP)
+    {
+        auto [entry, added] = members.try_emplace(awaiter.object, Member{awaiter.kind, awaiter.object, {}});
+        if (added && !addToWaitSet(entry->second))
+        {
+            OSInterfaceLogError(TAG, "Could not wait for %p, it cannot be added to the wait set", awaiter.object);
+            members.erase(entry);
+            awaiter.result = false;
+            return false;
+        }
+        entry->second.waiters.push_back(&awaiter);
+    }
+    if (awaiter.timeout_ms != UINT32_MAX)
+    {
+        awaiter.deadline    = deadlines.emplace(os.osMillis64() + awaiter.timeout_ms, &awaiter);
+        awaiter.hasDeadline = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Resume the tasks waiting for a member of the wait set that is ready, oldest first, as long as the member
+ * satisfies them
+ */
+void OSInterface_EventLoop::serve(const void* object)
+{
+    for (;;)
+    {
+        const auto entry = members.find(object);
+        if (entry == members.end())
+        {
+            return;
+        }
+        OSInterface_Awaiter* awaiter = entry->second.waiters.front();
+        if (entry->second.kind != OSInterface_Awaiter::TIMER && !awaiter->attempt())
+        {
+            return;
+        }
+        complete(*awaiter, true);
+    }
+}
+
+/**
+ * @brief Forget a suspended awaiter and make its task runnable
+ */
+void OSInterface_EventLoop::complete(OSInterface_Awaiter& awaiter, const bool result)
+{
+    if (awaiter.kind != OSInterface_Awaiter::SLEEP)
+    {
+        const auto entry   = members.find(awaiter.object);
+        auto&      waiters = entry->second.waiters;
+        waiters.erase(std::find(waiters.begin(), waiters.end(), &awaiter));
+        if (waiters.empty())
+        {
+            removeFromWaitSet(entry->second);
+            members.erase(entry);
+        }
+    }
+    if (awaiter.hasDeadline)
+    {
+        deadlines.erase(awaiter.deadline);
+        awaiter.hasDeadline = false;
+    }
+    awaiter.result = result;
+    runnable.push_back(awaiter.task);
+}
+
+void OSInterface_EventLoop::expireDeadlines()
+{
+    const uint64_t now = os.osMillis64();
+    while (!deadlines.empty() && deadlines.begin()->first <= now)
+    {
+        OSInterface_Awaiter* awaiter = deadlines.begin()->second;
+        complete(*awaiter, awaiter->kind == OSInterface_Awaiter::SLEEP);
+    }
+}
+
+void OSInterface_EventLoop::resumeRunnable()
+{
+    // Tasks made runnable while these run wait for the next round, after the wait set was checked
+    resuming.swap(runnable);
+    for (const std::coroutine_handle<> task : resuming)
+    {
+        task.resume();
+        if (task.done())
+        {
+            tasks.erase(task.address());
+            task.destroy();
+        }
+    }
+    resuming.clear();
+}
+
+bool OSInterface_EventLoop::addToWaitSet(const Member& member)
+{
+    switch (member.kind)
+    {
+        case OSInterface_Awaiter::QUEUE:
+            return waitSet->add(static_cast<OSInterface_UntypedQueue*>(member.object));
+        case OSInterface_Awaiter::SEMAPHORE:
+            return waitSet->add(static_cast<OSInterface_BinarySemaphore*>(member.object));
+        default:
+            return waitSet->add(static_cast<OSInterface_Timer*>(member.object));
+    }
+}
+
+void OSInterface_EventLoop::removeFromWaitSet(const Member& member)
+{
+    switch (member.kind)
+    {
+        case OSInterface_Awaiter::QUEUE:
+            waitSet->remove(static_cast<OSInterface_UntypedQueue*>(member.object));
+            break;
+        case OSInterface_Awaiter::SEMAPHORE:
+            waitSet->remove(static_cast<OSInterface_BinarySemaphore*>(member.object));
+            break;
+        default:
+            waitSet->remove(static_cast<OSInterface_Timer*>(member.object));
+            break;
+    }
+}
+
+/**
+ * @return uint32_t Milliseconds until the earliest deadline, UINT32_MAX if there is none
+ */
+uint32_t OSInterface_EventLoop::timeUntilNextDeadline()
+{
+    if (deadlines.empty())
+    {
+        return UINT32_MAX;
+    }
+    const uint64_t now      = os.osMillis64();
+    const uint64_t deadline = deadlines.begin()->first;
+    return deadline <= now ? 0 : static_cast<uint32_t>(std::min<uint64_t>(deadline - now, UINT32_MAX - 1));
+}
@@ -0,0 +1,193 @@
+#ifdef OSInterface_INSTRUMENTATION
+
+    #include <cinttypes>
+    #include <mutex>
+    #include "OSInterface_Instrumentation.h"
+
+struct Registry
+{
+    std::mutex                        lock;
+    OSInterface_InstrumentationStats* first{nullptr};
+};
+
+static Registry& registry()
+{
+    // Never deleted, objects may be destroyed after the static objects
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+uint64_t OSInterface_Histogram::total() const
+{
+    uint64_t sum = 0;
+    for (uint32_t bucket = 0; bucket < BUCKETS; bucket++)
+    {
+        sum += count(bucket);
+    }
+    return sum;
+}
+
+uint64_t OSInterface_Histogram::percentile(const uint32_t percent) const
+{
+    const uint64_t recorded = total();
+    if (recorded == 0)
+    {
+        return 0;
+    }
+    // Rank of the percentile, rounded up so that 100 is the last duration
+    const uint64_t rank       = (recorded * percent + 99) / 100;
+    uint64_t       cumulative = 0;
+    for (uint32_t bucket = 0; bucket < BUCKETS; bucket++)
+    {
+        cumulative += count(bucket);
+        if (cumulative >= rank && cumulative != 0)
+        {
+            return upperBound(bucket);
+        }
+    }
+    return upperBound(BUCKETS - 1);
+}
+
+OSInterface_InstrumentationStats::~OSInterface_InstrumentationStats()
+{
+    OSInterface_Instrumentation::remove(*this);
+}
+
+void OSInterface_InstrumentationStats::publish()
+{
+    OSInterface_Instrumentation::add(*this);
+}
+
+void OSInterface_InstrumentationStats::setName(const char* newName)
+{
+    {
+        std::lock_guard guard(registry().lock);
+        name = newName;
+    }
+    publish();
+}
+
+void OSInterface_Instrumentation::add(OSInterface_InstrumentationStats& stats)
+{
+    Registry&       objects = registry();
+    std::lock_guard guard(objects.lock);
+    if (!stats.published)
+    {
+        stats.published = true;
+        stats.next      = objects.first;
+        if (stats.next != nullptr)
+        {
+            stats.next->previous = &stats;
+        }
+        objects.first = &stats;
+    }
+}
+
+void OSInterface_Instrumentation::remove(OSInterface_InstrumentationStats& stats)
+{
+    Registry&       objects = registry();
+    std::lock_guard guard(objects.lock);
+    if (!stats.published)
+    {
+        return;
+    }
+    if (stats.previous != nullptr)
+    {
+        stats.previous->next = stats.next;
+    }
+    else
+    {
+        objects.first = stats.next;
+    }
+    if (stats.next != nullptr)
+    {
+        stats.next->previous = stats.previous;
+    }
+    stats.published = false;
+}
+
+void OSInterface_Instrumentation::forEach(const OSInterfaceInstrumentationVisitor visitor, void* arg)
+{
+    Registry&       objects = registry();
+    std::lock_guard guard(objects.lock);
+    for (const OSInterface_InstrumentationStats* stats = objects.first; stats != nullptr; stats = stats->next)
+    {
+        visitor(*stats, arg);
+    }
+}
+
+static const char* kindName(const OSInterface_InstrumentationStats::Kind kind)
+{
+    switch (kind)
+    {
+        case OSInterface_InstrumentationStats::MUTEX:
+            return "mutex";
+        case OSInterface_InstrumentationStats::BINARY_SEMAPHORE:
+            return "binary semaphore";
+        case OSInterface_InstrumentationStats::QUEUE:
+            return "queue";
+    }
+    return "object";
+}
+
+/**
+ * @brief Print the 50th and 99th percentiles and the maximum of a histogram, as upper bounds in microseconds
+ */
+static void printHistogram(FILE* out, const char* label, const OSInterface_Histogram& histogram)
+{
+    if (histogram.total() == 0)
+    {
+        return;
+    }
+    fprintf(out, " %s_us(p50/p99/max)<=%.3f/%.3f/%.3f", label,
+            static_cast<double>(histogram.percentile(50)) / 1000, static_cast<double>(histogram.percentile(99)) / 1000,
+            static_cast<double>(histogram.percentile(100)) / 1000);
+}
+
+static void printWaits(FILE* out, const char* label, const OSInterface_WaitStats& wait)
+{
+    fprintf(out, " %s_contentions=%" PRIu64 " %s_waits=%" PRIu64 " %s_timeouts=%" PRIu64, label,
+            wait.contentions.load(std::memory_order_relaxed), label, wait.waits.load(std::memory_order_relaxed), label,
+            wait.timeouts.load(std::memory_order_relaxed));
+    printHistogram(out, label, wait.waitTime);
+}
+
+static void printStats(const OSInterface_InstrumentationStats& stats, void* arg)
+{
+    FILE* out = static_cast<FILE*>(arg);
+    if (stats.getName() != nullptr)
+    {
+        fprintf(out, "%s (%s):", stats.getName(), kindName(stats.getKind()));
+    }
+    else
+    {
+        fprintf(out, "%s@%p:", kindName(stats.getKind()), static_cast<const void*>(&stats));
+    }
+
+    if (stats.getKind() == OSInterface_InstrumentationStats::QUEUE)
+    {
+        fprintf(out, " high_water_mark=%" PRIu32, stats.highWaterMark.load(std::memory_order_relaxed));
+        printWaits(out, "empty", stats.wait);
+        printWaits(out, "full", stats.sendWait);
+    }
+    else
+    {
+        fprintf(out, " acquisitions=%" PRIu64, stats.acquisitions.load(std::memory_order_relaxed));
+        printWaits(out, "wait", stats.wait);
+        printHistogram(out, "hold", stats.holdTime);
+    }
+    fputc('\n', out);
+}
+
+void OSInterface_Instrumentation::dump(FILE* out)
+{
+    forEach(printStats, out);
+    fflush(out);
+}
+
+void OSInterface_Instrumentation::dumpProcess(void* /*arg*/)
+{
+    dump(stdout);
+}
+
+#endif // OSInterface_INSTRUMENTATION
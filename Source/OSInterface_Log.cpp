@@ -1,5 +1,105 @@
+#include <atomic>
+#include <cstring>
 #include "OSInterface_Log.h"
 
+static constexpr uint32_t MAX_TAGS      = 256;  // Distinct tag strings, power of two
+static constexpr uint32_t POINTER_SLOTS = 1024; // Distinct tag pointers, power of two
+static constexpr uint16_t NO_TAG        = UINT16_MAX;
+static constexpr uint8_t  LEVEL_UNSET   = UINT8_MAX;
+
+// Tag strings, interned by content. Slots are claimed once and never released, their index is the tag ID.
+struct TagEntry
+{
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint8_t>     level{LEVEL_UNSET};
+};
+
+// Tag pointers seen by log calls, mapped to the ID of their string so that lookups do not compare strings
+struct PointerEntry
+{
+    std::atomic<const char*> pointer{nullptr};
+    std::atomic<uint16_t>    tag{NO_TAG}; // NO_TAG until the thread claiming the slot stores it
+};
+
+static TagEntry             tags[MAX_TAGS];
+static PointerEntry         pointers[POINTER_SLOTS];
+static std::atomic<uint8_t> defaultLevel{OSInterface_LOG_DEFAULT_LEVEL};
+
+static uint32_t hashString(const char* string)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (; *string != '\0'; string++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*string)) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t hashPointer(const char* pointer)
+{
+    const auto address = reinterpret_cast<uintptr_t>(pointer);
+    return static_cast<uint32_t>((static_cast<uint64_t>(address) * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+/**
+ * @brief Find or add a tag string
+ *
+ * @return uint16_t ID of the tag, NO_TAG if the table is full
+ */
+static uint16_t internTag(const char* tag)
+{
+    uint32_t index = hashString(tag) & (MAX_TAGS - 1);
+    for (uint32_t probe = 0; probe < MAX_TAGS; probe++, index = (index + 1) & (MAX_TAGS - 1))
+    {
+        const char* name = tags[index].name.load(std::memory_order_acquire);
+        if (name == nullptr &&
+            tags[index].name.compare_exchange_strong(name, tag, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return static_cast<uint16_t>(index);
+        }
+        // The slot was taken, possibly just now by another thread
+        if (strcmp(name, tag) == 0)
+        {
+            return static_cast<uint16_t>(index);
+        }
+    }
+    return NO_TAG;
+}
+
+/**
+ * @brief Get the ID of a tag, looking up its pointer first
+ *
+ * @return uint16_t ID of the tag, NO_TAG if the table of tags is full
+ */
+static uint16_t findTag(const char* tag)
+{
+    uint32_t index = hashPointer(tag) & (POINTER_SLOTS - 1);
+    for (uint32_t probe = 0; probe < POINTER_SLOTS; probe++, index = (index + 1) & (POINTER_SLOTS - 1))
+    {
+        const char* pointer = pointers[index].pointer.load(std::memory_order_acquire);
+        if (pointer == nullptr)
+        {
+            const uint16_t id = internTag(tag);
+            if (id == NO_TAG)
+            {
+                return NO_TAG;
+            }
+            if (pointers[index].pointer.compare_exchange_strong(pointer, tag, std::memory_order_acq_rel,
+                                                                std::memory_order_acquire))
+            {
+                pointers[index].tag.store(id, std::memory_order_release);
+                return id;
+            }
+        }
+        if (pointer == tag)
+        {
+            const uint16_t id = pointers[index].tag.load(std::memory_order_acquire);
+            return id != NO_TAG ? id : internTag(tag);
+        }
+    }
+    return internTag(tag); // Too many distinct pointers, fall back to comparing strings
+}
+
 const char* OSInterfaceLogLevelToString(const OSInterfaceLogLevel level)
 {
     switch (level)
@@ -22,3 +122,41 @@ const char* OSInterfaceLogLevelToString(const OSInterfaceLogLevel level)
             return "UNKNOWN";
     }
 }
+
+bool OSInterfaceLogSetTagLevel(const char* tag, const OSInterfaceLogLevel level)
+{
+    if (tag == nullptr)
+    {
+        return false;
+    }
+    if (strcmp(tag, "*") == 0)
+    {
+        defaultLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+        return true;
+    }
+    const uint16_t id = findTag(tag);
+    if (id == NO_TAG)
+    {
+        return false;
+    }
+    tags[id].level.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    return true;
+}
+
+OSInterfaceLogLevel OSInterfaceLogGetTagLevel(const char* tag)
+{
+    uint8_t level = LEVEL_UNSET;
+    if (tag != nullptr)
+    {
+        const uint16_t id = findTag(tag);
+        if (id != NO_TAG)
+        {
+            level = tags[id].level.load(std::memory_order_relaxed);
+        }
+    }
+    if (level == LEVEL_UNSET)
+    {
+        level = defaultLevel.load(std::memory_order_relaxed);
+    }
+    return static_cast<OSInterfaceLogLevel>(level);
+}
@@ -0,0 +1,147 @@
+#include <new>
+#include "OSInterface_MessageRing.h"
+
+OSInterface_MessageRing::OSInterface_MessageRing(const uint32_t capacity) :
+    capacity(capacity & ~(HEADER_SIZE - 1)), storage(new(std::nothrow) uint64_t[this->capacity / sizeof(uint64_t)])
+{
+}
+
+uint32_t OSInterface_MessageRing::entrySize(const uint32_t length)
+{
+    return HEADER_SIZE + ((length + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1));
+}
+
+OSInterface_MessageRing::Header* OSInterface_MessageRing::headerAt(const uint32_t offset) const
+{
+    return reinterpret_cast<Header*>(reinterpret_cast<uint8_t*>(storage.get()) + offset);
+}
+
+OSInterface_MessageRing::Header* OSInterface_MessageRing::headerOf(const void* message)
+{
+    return reinterpret_cast<Header*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(message)) - HEADER_SIZE);
+}
+
+uint8_t* OSInterface_MessageRing::reserve(const uint32_t length, const bool committed)
+{
+    if (length == 0 || length > maxMessageLength())
+    {
+        return nullptr;
+    }
+    const uint32_t needed = entrySize(length);
+    if (used == 0)
+    {
+        // Restart from the beginning so that the longest messages fit
+        head = 0;
+        tail = 0;
+    }
+    else if (tail < head || (tail == head && used == capacity))
+    {
+        if (needed > head - tail)
+        {
+            return nullptr;
+        }
+    }
+    if (tail >= head && needed > capacity - tail)
+    {
+        if (needed > head)
+        {
+            return nullptr;
+        }
+        Header* padding = headerAt(tail);
+        padding->length = capacity - tail - HEADER_SIZE;
+        padding->state  = RELEASED;
+        used += capacity - tail;
+        tail = 0;
+    }
+
+    Header* header = headerAt(tail);
+    header->length = length;
+    header->state  = committed ? READY : WRITING;
+    tail += needed;
+    if (tail == capacity)
+    {
+        tail = 0;
+    }
+    used += needed;
+    if (committed)
+    {
+        ready++;
+    }
+    return reinterpret_cast<uint8_t*>(header) + HEADER_SIZE;
+}
+
+void OSInterface_MessageRing::commit(void* message)
+{
+    headerOf(message)->state = READY;
+    ready++;
+}
+
+const uint8_t* OSInterface_MessageRing::front(uint32_t& length) const
+{
+    // Messages being read keep their place, the next one may be behind them
+    uint32_t offset    = head;
+    uint32_t remaining = used;
+    while (remaining != 0)
+    {
+        const Header* header = headerAt(offset);
+        if (header->state == READY)
+        {
+            length = header->length;
+            return reinterpret_cast<const uint8_t*>(header) + HEADER_SIZE;
+        }
+        if (header->state == WRITING)
+        {
+            break;
+        }
+        const uint32_t size = entrySize(header->length);
+        offset              = offset + size == capacity ? 0 : offset + size;
+        remaining -= size;
+    }
+    return nullptr;
+}
+
+void OSInterface_MessageRing::take(const void* message)
+{
+    headerOf(message)->state = READING;
+    ready--;
+}
+
+void OSInterface_MessageRing::release(const void* message)
+{
+    Header* header = headerOf(message);
+    if (header->state == READY)
+    {
+        ready--;
+    }
+    header->state = RELEASED;
+    skipReleased();
+}
+
+void OSInterface_MessageRing::reset()
+{
+    uint32_t offset    = head;
+    uint32_t remaining = used;
+    while (remaining != 0)
+    {
+        Header* header = headerAt(offset);
+        if (header->state == READY)
+        {
+            header->state = RELEASED;
+        }
+        const uint32_t size = entrySize(header->length);
+        offset              = offset + size == capacity ? 0 : offset + size;
+        remaining -= size;
+    }
+    ready = 0;
+    skipReleased();
+}
+
+void OSInterface_MessageRing::skipReleased()
+{
+    while (used != 0 && headerAt(head)->state == RELEASED)
+    {
+        const uint32_t size = entrySize(headerAt(head)->length);
+        head                = head + size == capacity ? 0 : head + size;
+        used -= size;
+    }
+}
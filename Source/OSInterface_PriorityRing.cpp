@@ -0,0 +1,126 @@
+#include <bit>
+#include <new>
+#include "OSInterface_PriorityRing.h"
+
+OSInterface_PriorityRing::OSInterface_PriorityRing(const uint32_t levels, const uint32_t maxMessages,
+                                                   const uint32_t messageSize) :
+    levels(levels), maxMessages(maxMessages), messageSize(messageSize),
+    storage(new(std::nothrow) uint8_t[static_cast<size_t>(levels) * maxMessages * messageSize]),
+    rings(new(std::nothrow) uint32_t[static_cast<size_t>(levels) * maxMessages]),
+    freeSlots(new(std::nothrow) uint32_t[static_cast<size_t>(levels) * maxMessages]),
+    levelState(new(std::nothrow) Level[levels])
+{
+    if (!isValid())
+    {
+        return;
+    }
+    for (uint32_t level = 0; level < levels; level++)
+    {
+        // Popped from the end, so that the slots of a level are first used in order
+        uint32_t* freeStack = &freeSlots[static_cast<size_t>(level) * maxMessages];
+        for (uint32_t i = 0; i < maxMessages; i++)
+        {
+            freeStack[i] = level * maxMessages + (maxMessages - 1 - i);
+        }
+        levelState[level].freeCount = maxMessages;
+    }
+    freeTotal = levels * maxMessages;
+}
+
+bool OSInterface_PriorityRing::isValid() const
+{
+    return levels > 0 && levels <= MAX_LEVELS && maxMessages > 0 && messageSize > 0 &&
+           static_cast<uint64_t>(levels) * maxMessages <= UINT32_MAX && storage != nullptr && rings != nullptr &&
+           freeSlots != nullptr && levelState != nullptr;
+}
+
+uint8_t* OSInterface_PriorityRing::slotAddress(const uint32_t slot) const
+{
+    return &storage[static_cast<size_t>(slot) * messageSize];
+}
+
+uint32_t OSInterface_PriorityRing::slotIndex(const void* address) const
+{
+    return static_cast<uint32_t>((static_cast<const uint8_t*>(address) - storage.get()) / messageSize);
+}
+
+uint32_t OSInterface_PriorityRing::length(const uint32_t level) const
+{
+    return level < levels ? levelState[level].queued : 0;
+}
+
+uint32_t OSInterface_PriorityRing::levelOf(const void* slot) const
+{
+    return slotIndex(slot) / maxMessages;
+}
+
+uint8_t* OSInterface_PriorityRing::reserve(const uint32_t level)
+{
+    if (level >= levels || levelState[level].freeCount == 0)
+    {
+        return nullptr;
+    }
+    Level&         state = levelState[level];
+    const uint32_t slot  = freeSlots[static_cast<size_t>(level) * maxMessages + --state.freeCount];
+    freeTotal--;
+    return slotAddress(slot);
+}
+
+void OSInterface_PriorityRing::queue(void* slot, const bool toFront)
+{
+    const uint32_t index = slotIndex(slot);
+    const uint32_t level = index / maxMessages;
+    Level&         state = levelState[level];
+    uint32_t       position;
+    if (toFront)
+    {
+        state.head = state.head == 0 ? maxMessages - 1 : state.head - 1;
+        position   = state.head;
+    }
+    else
+    {
+        position = state.head + state.queued;
+        if (position >= maxMessages)
+        {
+            position -= maxMessages;
+        }
+    }
+    rings[static_cast<size_t>(level) * maxMessages + position] = index;
+    state.queued++;
+    queuedTotal++;
+    nonEmpty |= UINT32_C(1) << level;
+}
+
+uint8_t* OSInterface_PriorityRing::take()
+{
+    if (nonEmpty == 0)
+    {
+        return nullptr;
+    }
+    const uint32_t level = std::bit_width(nonEmpty) - 1;
+    Level&         state = levelState[level];
+    const uint32_t slot  = rings[static_cast<size_t>(level) * maxMessages + state.head];
+    state.head           = state.head + 1 == maxMessages ? 0 : state.head + 1;
+    if (--state.queued == 0)
+    {
+        nonEmpty &= ~(UINT32_C(1) << level);
+    }
+    queuedTotal--;
+    return slotAddress(slot);
+}
+
+void OSInterface_PriorityRing::release(const void* slot)
+{
+    const uint32_t index = slotIndex(slot);
+    const uint32_t level = index / maxMessages;
+    freeSlots[static_cast<size_t>(level) * maxMessages + levelState[level].freeCount++] = index;
+    freeTotal++;
+}
+
+void OSInterface_PriorityRing::reset()
+{
+    while (nonEmpty != 0)
+    {
+        release(take());
+    }
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include "OSInterface_StreamRing.h"
+
+OSInterface_StreamRing::OSInterface_StreamRing(const uint32_t capacity) :
+    capacity(capacity), storage(new(std::nothrow) uint8_t[capacity])
+{
+}
+
+uint32_t OSInterface_StreamRing::write(const void* data, const uint32_t length)
+{
+    const auto* bytes   = static_cast<const uint8_t*>(data);
+    uint32_t    written = 0;
+    // At most two copies, up to the end of the ring and from its start
+    while (written < length && used != capacity)
+    {
+        uint32_t       contiguous;
+        uint8_t*       view  = writeView(contiguous);
+        const uint32_t count = std::min(length - written, contiguous);
+        memcpy(view, bytes + written, count);
+        commitWrite(count);
+        written += count;
+    }
+    return written;
+}
+
+uint32_t OSInterface_StreamRing::read(void* data, const uint32_t maxLength)
+{
+    auto*    bytes = static_cast<uint8_t*>(data);
+    uint32_t total = 0;
+    while (total < maxLength && used != 0)
+    {
+        uint32_t       contiguous;
+        const uint8_t* view  = readView(contiguous);
+        const uint32_t count = std::min(maxLength - total, contiguous);
+        memcpy(bytes + total, view, count);
+        consume(count);
+        total += count;
+    }
+    return total;
+}
+
+uint8_t* OSInterface_StreamRing::writeView(uint32_t& length) const
+{
+    const uint64_t end  = static_cast<uint64_t>(head) + used;
+    const auto     tail = static_cast<uint32_t>(end < capacity ? end : end - capacity);
+    length              = tail >= head && used != capacity ? capacity - tail : head - tail;
+    return &storage[tail];
+}
+
+void OSInterface_StreamRing::commitWrite(const uint32_t written)
+{
+    used += written;
+}
+
+const uint8_t* OSInterface_StreamRing::readView(uint32_t& length) const
+{
+    length = std::min(used, capacity - head);
+    return &storage[head];
+}
+
+void OSInterface_StreamRing::consume(const uint32_t consumed)
+{
+    head += consumed;
+    if (head >= capacity)
+    {
+        head -= capacity;
+    }
+    // The head is not moved back to the start once the stream is empty, a writer may hold a view past the end
+    used -= consumed;
+}
+
+void OSInterface_StreamRing::reset()
+{
+    head = 0;
+    used = 0;
+}
@@ -0,0 +1,268 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "OSInterface_Sim.h"
+#include "OSInterface_SimBinarySemaphore.h"
+#include "OSInterface_SimCountingSemaphore.h"
+#include "OSInterface_SimEventGroup.h"
+#include "OSInterface_SimJob.h"
+#include "OSInterface_SimMessageBuffer.h"
+#include "OSInterface_SimMutex.h"
+#include "OSInterface_SimPriorityQueue.h"
+#include "OSInterface_SimProcessHandle.h"
+#include "OSInterface_SimRWLock.h"
+#include "OSInterface_SimStreamBuffer.h"
+#include "OSInterface_SimUntypedQueue.h"
+#include "OSInterface_SimWaitSet.h"
+
+static const char* TAG = "OSInterface_Sim";
+
+// Every block starts with its size, padded to keep the memory suitably aligned for any fundamental type
+static constexpr size_t BLOCK_HEADER_SIZE = alignof(std::max_align_t);
+
+OSInterface_Sim::OSInterface_Sim(const uint64_t seed) : scheduler(seed), timerService(scheduler)
+{
+}
+
+OSInterface_Sim::~OSInterface_Sim()
+{
+    // The process of the timer service is blocked on the service, terminate it while the service still exists
+    scheduler.terminate();
+}
+
+void OSInterface_Sim::osSleep(const uint32_t ms)
+{
+    if (ms == 0)
+    {
+        scheduler.yield();
+        return;
+    }
+    scheduler.sleepUntil(scheduler.deadlineAfter(ms * OSInterface_SimScheduler::NANOS_PER_MILLI));
+}
+
+uint32_t OSInterface_Sim::osMillis()
+{
+    return static_cast<uint32_t>(osMillis64());
+}
+
+void OSInterface_Sim::osSleepMicros(const uint32_t us)
+{
+    if (us == 0)
+    {
+        scheduler.yield();
+        return;
+    }
+    scheduler.sleepUntil(scheduler.deadlineAfter(us * OSInterface_SimScheduler::NANOS_PER_MICRO));
+}
+
+uint64_t OSInterface_Sim::osMillis64()
+{
+    return scheduler.now() / OSInterface_SimScheduler::NANOS_PER_MILLI;
+}
+
+uint64_t OSInterface_Sim::osMicros64()
+{
+    return scheduler.now() / OSInterface_SimScheduler::NANOS_PER_MICRO;
+}
+
+uint64_t OSInterface_Sim::osTicks()
+{
+    return scheduler.now();
+}
+
+uint64_t OSInterface_Sim::osTicksPerSecond()
+{
+    return 1000 * OSInterface_SimScheduler::NANOS_PER_MILLI;
+}
+
+OSInterface_SimMutex* OSInterface_Sim::osCreateMutex()
+{
+    return new (std::nothrow) OSInterface_SimMutex(scheduler);
+}
+
+OSInterface_SimMutex* OSInterface_Sim::osCreateMutex(const OSInterface_Mutex::Mode /*mode*/)
+{
+    return osCreateMutex();
+}
+
+OSInterface_SimRWLock* OSInterface_Sim::osCreateRWLock()
+{
+    return new (std::nothrow) OSInterface_SimRWLock(scheduler);
+}
+
+OSInterface_SimBinarySemaphore* OSInterface_Sim::osCreateBinarySemaphore()
+{
+    return new (std::nothrow) OSInterface_SimBinarySemaphore(scheduler);
+}
+
+OSInterface_SimCountingSemaphore* OSInterface_Sim::osCreateCountingSemaphore(const uint32_t maxCount,
+                                                                             const uint32_t initialCount)
+{
+    if (maxCount == 0 || initialCount > maxCount)
+    {
+        return nullptr;
+    }
+    return new (std::nothrow) OSInterface_SimCountingSemaphore(scheduler, maxCount, initialCount);
+}
+
+OSInterface_SimEventGroup* OSInterface_Sim::osCreateEventGroup()
+{
+    return new (std::nothrow) OSInterface_SimEventGroup(scheduler);
+}
+
+OSInterface_SimTimer* OSInterface_Sim::osCreateTimer(const uint32_t period, const OSInterface_Timer::Mode mode,
+                                                     const OSInterfaceProcess callback, void* callbackArg,
+                                                     const char* timerName)
+{
+    if (period == 0 || callback == nullptr)
+    {
+        return nullptr;
+    }
+    return new (std::nothrow) OSInterface_SimTimer(timerService, period, mode, callback, callbackArg, timerName);
+}
+
+OSInterface_SimUntypedQueue* OSInterface_Sim::osCreateUntypedQueue(const uint32_t maxMessages,
+                                                                   const uint32_t messageSize)
+{
+    auto* queue = new (std::nothrow) OSInterface_SimUntypedQueue(scheduler, maxMessages, messageSize);
+    if (queue != nullptr && !queue->isValid())
+    {
+        delete queue;
+        queue = nullptr;
+    }
+    return queue;
+}
+
+OSInterface_SimUntypedQueue* OSInterface_Sim::osCreateUntypedQueue(
+    const uint32_t maxMessages, const uint32_t messageSize, const OSInterface_UntypedQueue::AccessPattern /*pattern*/)
+{
+    // Processes never run concurrently, so the general queue costs nothing more than a specialized one
+    return osCreateUntypedQueue(maxMessages, messageSize);
+}
+
+OSInterface_SimPriorityQueue* OSInterface_Sim::osCreatePriorityQueue(const uint32_t maxMessages,
+                                                                     const uint32_t messageSize,
+                                                                     const uint32_t priorityLevels)
+{
+    auto* queue = new (std::nothrow) OSInterface_SimPriorityQueue(scheduler, maxMessages, messageSize, priorityLevels);
+    if (queue != nullptr && !queue->isValid())
+    {
+        delete queue;
+        queue = nullptr;
+    }
+    return queue;
+}
+
+OSInterface_SimMessageBuffer* OSInterface_Sim::osCreateMessageBuffer(const uint32_t capacity)
+{
+    auto* buffer = new (std::nothrow) OSInterface_SimMessageBuffer(scheduler, capacity);
+    if (buffer != nullptr && !buffer->isValid())
+    {
+        delete buffer;
+        buffer = nullptr;
+    }
+    return buffer;
+}
+
+OSInterface_SimStreamBuffer* OSInterface_Sim::osCreateStreamBuffer(const uint32_t capacity,
+                                                                   const uint32_t triggerLevel)
+{
+    if (triggerLevel > capacity)
+    {
+        return nullptr;
+    }
+    auto* buffer = new (std::nothrow) OSInterface_SimStreamBuffer(scheduler, capacity, triggerLevel);
+    if (buffer != nullptr && !buffer->isValid())
+    {
+        delete buffer;
+        buffer = nullptr;
+    }
+    return buffer;
+}
+
+OSInterface_SimWaitSet* OSInterface_Sim::osCreateWaitSet()
+{
+    return new (std::nothrow) OSInterface_SimWaitSet(scheduler);
+}
+
+void* OSInterface_Sim::osMalloc(const uint32_t size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    auto* block = static_cast<uint8_t*>(std::malloc(BLOCK_HEADER_SIZE + size));
+    if (block == nullptr)
+    {
+        failedAllocations++;
+        return nullptr;
+    }
+    *reinterpret_cast<uint32_t*>(block) = size;
+    bytesInUse += BLOCK_HEADER_SIZE + size;
+    if (bytesInUse > peakBytesInUse)
+    {
+        peakBytesInUse = bytesInUse;
+    }
+    return block + BLOCK_HEADER_SIZE;
+}
+
+void OSInterface_Sim::osFree(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    uint8_t* block = static_cast<uint8_t*>(ptr) - BLOCK_HEADER_SIZE;
+    bytesInUse -= BLOCK_HEADER_SIZE + *reinterpret_cast<const uint32_t*>(block);
+    std::free(block);
+}
+
+void OSInterface_Sim::osGetMemoryStats(OSInterface_MemoryStats& stats)
+{
+    stats                   = {};
+    stats.bytesInUse        = bytesInUse;
+    stats.peakBytesInUse    = peakBytesInUse;
+    stats.failedAllocations = failedAllocations;
+}
+
+void OSInterface_Sim::osRunProcess(const OSInterfaceProcess process, void* arg)
+{
+    osRunProcess(process, nullptr, arg);
+}
+
+void OSInterface_Sim::osRunProcess(const OSInterfaceProcess process, const char* processName, void* arg)
+{
+    // The scheduler logs the failures
+    scheduler.spawn(process, arg, processName);
+}
+
+OSInterface_SimProcessHandle* OSInterface_Sim::osRunProcess(const OSInterfaceProcess process, void* arg,
+                                                             const OSInterface_ProcessAttributes& attributes)
+{
+    auto* handle = new (std::nothrow) OSInterface_SimProcessHandle(scheduler, process, arg);
+    if (handle != nullptr && !handle->start(attributes))
+    {
+        delete handle;
+        handle = nullptr;
+    }
+    if (handle == nullptr)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s'", attributes.name != nullptr ? attributes.name : "");
+    }
+    return handle;
+}
+
+OSInterface_SimJob* OSInterface_Sim::osSubmit(const OSInterfaceProcess job, void* arg)
+{
+    auto* handle = new (std::nothrow) OSInterface_SimJob(scheduler, job, arg);
+    if (handle != nullptr && !handle->start())
+    {
+        delete handle;
+        handle = nullptr;
+    }
+    if (handle == nullptr)
+    {
+        OSInterfaceLogError(TAG, "Could not submit job");
+    }
+    return handle;
+}
@@ -0,0 +1,34 @@
+#include "OSInterface_SimBinarySemaphore.h"
+
+void OSInterface_SimBinarySemaphore::signal()
+{
+    signaled = true;
+    scheduler.wakeOne(waiters);
+    notifyWaitSet();
+}
+
+bool OSInterface_SimBinarySemaphore::wait(const uint32_t maxTimeToWait_ms)
+{
+    return waitFor(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimBinarySemaphore::waitMicros(const uint32_t maxTimeToWait_us)
+{
+    return waitFor(maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+bool OSInterface_SimBinarySemaphore::pollReady()
+{
+    return signaled;
+}
+
+bool OSInterface_SimBinarySemaphore::waitFor(const uint64_t timeout_ns)
+{
+    return scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns),
+                           [this]
+                           {
+                               const bool taken = signaled;
+                               signaled         = false;
+                               return taken;
+                           });
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include "OSInterface_SimCountingSemaphore.h"
+
+bool OSInterface_SimCountingSemaphore::signal()
+{
+    return signalN(1) != 0;
+}
+
+uint32_t OSInterface_SimCountingSemaphore::signalN(const uint32_t count)
+{
+    const uint32_t added = std::min(count, maxCount - this->count);
+    if (added != 0)
+    {
+        this->count += added;
+        // Waiters for several counts may need any of them, so they all check again
+        scheduler.wakeAll(waiters);
+    }
+    return added;
+}
+
+bool OSInterface_SimCountingSemaphore::signalFromISR()
+{
+    return signal();
+}
+
+uint32_t OSInterface_SimCountingSemaphore::signalNFromISR(const uint32_t count)
+{
+    return signalN(count);
+}
+
+bool OSInterface_SimCountingSemaphore::wait(const uint32_t maxTimeToWait_ms)
+{
+    return take(1, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimCountingSemaphore::waitMicros(const uint32_t maxTimeToWait_us)
+{
+    return take(1, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+bool OSInterface_SimCountingSemaphore::waitN(const uint32_t count, const uint32_t maxTimeToWait_ms)
+{
+    return take(count, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimCountingSemaphore::waitFromISR()
+{
+    return tryTake(1);
+}
+
+bool OSInterface_SimCountingSemaphore::waitNFromISR(const uint32_t count)
+{
+    return tryTake(count);
+}
+
+uint32_t OSInterface_SimCountingSemaphore::getCount()
+{
+    return count;
+}
+
+bool OSInterface_SimCountingSemaphore::tryTake(const uint32_t taken)
+{
+    if (taken > count)
+    {
+        return false;
+    }
+    count -= taken;
+    return true;
+}
+
+bool OSInterface_SimCountingSemaphore::take(const uint32_t taken, const uint64_t timeout_ns)
+{
+    if (taken > maxCount)
+    {
+        return false;
+    }
+    return scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns), [this, taken] { return tryTake(taken); });
+}
@@ -0,0 +1,63 @@
+#include "OSInterface_SimEventGroup.h"
+
+uint32_t OSInterface_SimEventGroup::setBits(const uint32_t bits)
+{
+    flags |= bits;
+    scheduler.wakeAll(waiters);
+    return flags;
+}
+
+uint32_t OSInterface_SimEventGroup::setBitsFromISR(const uint32_t bits)
+{
+    return setBits(bits);
+}
+
+uint32_t OSInterface_SimEventGroup::clearBits(const uint32_t bits)
+{
+    const uint32_t previous = flags;
+    flags &= ~bits;
+    return previous;
+}
+
+uint32_t OSInterface_SimEventGroup::clearBitsFromISR(const uint32_t bits)
+{
+    return clearBits(bits);
+}
+
+uint32_t OSInterface_SimEventGroup::getBits()
+{
+    return flags;
+}
+
+uint32_t OSInterface_SimEventGroup::waitBits(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                                             const uint32_t maxTimeToWait_ms)
+{
+    return wait(bits, mode, clearOnExit, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+uint32_t OSInterface_SimEventGroup::waitBitsMicros(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                                                   const uint32_t maxTimeToWait_us)
+{
+    return wait(bits, mode, clearOnExit, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+uint32_t OSInterface_SimEventGroup::wait(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                                         const uint64_t timeout_ns)
+{
+    if (bits == 0)
+    {
+        return flags;
+    }
+    uint32_t   observed = 0;
+    const bool met      = scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns),
+                                          [this, bits, mode, &observed]
+                                          {
+                                         observed = flags;
+                                         return mode == WAIT_ALL ? (observed & bits) == bits : (observed & bits) != 0;
+                                     });
+    if (met && clearOnExit)
+    {
+        flags &= ~bits;
+    }
+    return observed;
+}
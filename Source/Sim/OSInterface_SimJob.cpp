@@ -0,0 +1,35 @@
+#include "OSInterface_SimJob.h"
+
+OSInterface_SimJob::~OSInterface_SimJob()
+{
+    if (started)
+    {
+        scheduler.await(waiters, OSInterface_SimScheduler::FOREVER, [this] { return done; });
+    }
+}
+
+bool OSInterface_SimJob::start()
+{
+    started = scheduler.spawn(run, this, "OSInterfaceJob");
+    return started;
+}
+
+bool OSInterface_SimJob::wait(const uint32_t maxTimeToWait_ms)
+{
+    return scheduler.await(waiters,
+                           scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                           [this] { return done; });
+}
+
+bool OSInterface_SimJob::isDone()
+{
+    return done;
+}
+
+void OSInterface_SimJob::run(void* arg)
+{
+    auto& self = *static_cast<OSInterface_SimJob*>(arg);
+    self.job(self.arg);
+    self.done = true;
+    self.scheduler.wakeAll(self.waiters);
+}
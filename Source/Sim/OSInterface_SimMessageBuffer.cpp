@@ -0,0 +1,167 @@
+#include <cstring>
+#include "OSInterface_SimMessageBuffer.h"
+
+uint32_t OSInterface_SimMessageBuffer::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_SimMessageBuffer::available()
+{
+    return ring.available();
+}
+
+uint32_t OSInterface_SimMessageBuffer::maxMessageLength()
+{
+    return ring.maxMessageLength();
+}
+
+uint32_t OSInterface_SimMessageBuffer::nextLength()
+{
+    uint32_t length = 0;
+    ring.front(length);
+    return length;
+}
+
+bool OSInterface_SimMessageBuffer::isEmpty()
+{
+    return ring.isEmpty();
+}
+
+void OSInterface_SimMessageBuffer::reset()
+{
+    ring.reset();
+    scheduler.wakeAll(notFull);
+}
+
+bool OSInterface_SimMessageBuffer::trySend(const void* message, const uint32_t length)
+{
+    uint8_t* destination = ring.reserve(length, true);
+    if (destination == nullptr)
+    {
+        return false;
+    }
+    memcpy(destination, message, length);
+    scheduler.wakeOne(notEmpty);
+    return true;
+}
+
+uint32_t OSInterface_SimMessageBuffer::tryReceive(void* buffer, const uint32_t bufferSize)
+{
+    uint32_t       length;
+    const uint8_t* message = ring.front(length);
+    if (message == nullptr)
+    {
+        return 0;
+    }
+    if (length > bufferSize)
+    {
+        return TOO_LONG;
+    }
+    memcpy(buffer, message, length);
+    ring.release(message);
+    // The room freed may fit several short messages, or only the long message of another sender
+    scheduler.wakeAll(notFull);
+    return length;
+}
+
+bool OSInterface_SimMessageBuffer::send(const void* message, const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    if (length == 0 || length > ring.maxMessageLength())
+    {
+        return false;
+    }
+    return scheduler.await(notFull,
+                           scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                           [this, message, length] { return trySend(message, length); });
+}
+
+bool OSInterface_SimMessageBuffer::sendFromISR(const void* message, const uint32_t length)
+{
+    return trySend(message, length);
+}
+
+uint32_t OSInterface_SimMessageBuffer::receive(void* buffer, const uint32_t bufferSize,
+                                               const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    scheduler.await(notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, buffer, bufferSize, &received]
+                    {
+                        received = tryReceive(buffer, bufferSize);
+                        return received != 0;
+                    });
+    if (received == TOO_LONG)
+    {
+        // The message stays for another receiver, which may have been waiting for it
+        scheduler.wakeOne(notEmpty);
+        return 0;
+    }
+    return received;
+}
+
+uint32_t OSInterface_SimMessageBuffer::receiveFromISR(void* buffer, const uint32_t bufferSize)
+{
+    const uint32_t received = tryReceive(buffer, bufferSize);
+    return received == TOO_LONG ? 0 : received;
+}
+
+void* OSInterface_SimMessageBuffer::acquireSend(const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    void* message = nullptr;
+    if (length != 0 && length <= ring.maxMessageLength())
+    {
+        scheduler.await(notFull,
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, length, &message]
+                        {
+                            message = ring.reserve(length, false);
+                            return message != nullptr;
+                        });
+    }
+    return message;
+}
+
+void* OSInterface_SimMessageBuffer::acquireSendFromISR(const uint32_t length)
+{
+    return ring.reserve(length, false);
+}
+
+void OSInterface_SimMessageBuffer::commitSend(void* message)
+{
+    ring.commit(message);
+    scheduler.wakeOne(notEmpty);
+}
+
+const void* OSInterface_SimMessageBuffer::tryPeekReceive(uint32_t& length)
+{
+    const uint8_t* message = ring.front(length);
+    if (message != nullptr)
+    {
+        ring.take(message);
+    }
+    return message;
+}
+
+const void* OSInterface_SimMessageBuffer::peekReceive(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    const void* message = nullptr;
+    scheduler.await(notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &length, &message]
+                    {
+                        message = tryPeekReceive(length);
+                        return message != nullptr;
+                    });
+    return message;
+}
+
+const void* OSInterface_SimMessageBuffer::peekReceiveFromISR(uint32_t& length)
+{
+    return tryPeekReceive(length);
+}
+
+void OSInterface_SimMessageBuffer::releaseReceive(const void* message)
+{
+    ring.release(message);
+    scheduler.wakeAll(notFull);
+}
@@ -0,0 +1,31 @@
+#include "OSInterface_SimMutex.h"
+
+void OSInterface_SimMutex::signal()
+{
+    locked = false;
+    scheduler.wakeOne(waiters);
+}
+
+bool OSInterface_SimMutex::wait(const uint32_t maxTimeToWait_ms)
+{
+    return waitFor(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimMutex::waitMicros(const uint32_t maxTimeToWait_us)
+{
+    return waitFor(maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+bool OSInterface_SimMutex::waitFor(const uint64_t timeout_ns)
+{
+    return scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns),
+                           [this]
+                           {
+                               if (locked)
+                               {
+                                   return false;
+                               }
+                               locked = true;
+                               return true;
+                           });
+}
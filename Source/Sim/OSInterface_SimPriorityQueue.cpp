@@ -0,0 +1,306 @@
+#include <cstring>
+#include "OSInterface_SimPriorityQueue.h"
+
+uint32_t OSInterface_SimPriorityQueue::priorityLevels()
+{
+    return ring.levelCount();
+}
+
+uint32_t OSInterface_SimPriorityQueue::length(const uint32_t priority)
+{
+    return ring.length(priority);
+}
+
+uint32_t OSInterface_SimPriorityQueue::length()
+{
+    return ring.length();
+}
+
+uint32_t OSInterface_SimPriorityQueue::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_SimPriorityQueue::available()
+{
+    return ring.available();
+}
+
+bool OSInterface_SimPriorityQueue::isEmpty()
+{
+    return ring.length() == 0;
+}
+
+bool OSInterface_SimPriorityQueue::isFull()
+{
+    return ring.available() == 0;
+}
+
+void OSInterface_SimPriorityQueue::reset()
+{
+    ring.reset();
+    for (uint32_t level = 0; level < ring.levelCount(); level++)
+    {
+        scheduler.wakeAll(notFull[level]);
+    }
+}
+
+void OSInterface_SimPriorityQueue::messagesAdded(const uint32_t count)
+{
+    // One process per message, the others keep waiting
+    uint32_t woken = 0;
+    while (woken < count && scheduler.wakeOne(notEmpty))
+    {
+        woken++;
+    }
+    notifyWaitSet();
+}
+
+void OSInterface_SimPriorityQueue::slotFreed(const void* slot)
+{
+    scheduler.wakeOne(notFull[ring.levelOf(slot)]);
+}
+
+bool OSInterface_SimPriorityQueue::tryReceive(void* message)
+{
+    const uint8_t* slot = ring.take();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(message, slot, ring.messageLength());
+    ring.release(slot);
+    slotFreed(slot);
+    return true;
+}
+
+bool OSInterface_SimPriorityQueue::trySend(const void* message, const uint32_t priority, const bool toFront)
+{
+    uint8_t* slot = ring.reserve(priority);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(slot, message, ring.messageLength());
+    ring.queue(slot, toFront);
+    messagesAdded(1);
+    return true;
+}
+
+bool OSInterface_SimPriorityQueue::receiveFor(void* message, const uint64_t timeout_ns)
+{
+    return scheduler.await(notEmpty, scheduler.deadlineAfter(timeout_ns),
+                           [this, message] { return tryReceive(message); });
+}
+
+bool OSInterface_SimPriorityQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return receiveFor(message, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimPriorityQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return receiveFor(message, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+bool OSInterface_SimPriorityQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_SimPriorityQueue::sendFor(const void* message, const uint32_t priority, const uint64_t timeout_ns,
+                                           const bool toFront)
+{
+    if (priority >= ring.levelCount())
+    {
+        return false;
+    }
+    return scheduler.await(notFull[priority], scheduler.deadlineAfter(timeout_ns),
+                           [this, message, priority, toFront] { return trySend(message, priority, toFront); });
+}
+
+bool OSInterface_SimPriorityQueue::send(const void* message, const uint32_t priority, const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, priority, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms), false);
+}
+
+bool OSInterface_SimPriorityQueue::sendMicros(const void* message, const uint32_t priority,
+                                              const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, priority, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_SimPriorityQueue::sendFromISR(const void* message, const uint32_t priority)
+{
+    return trySend(message, priority, false);
+}
+
+bool OSInterface_SimPriorityQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, 0, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms), false);
+}
+
+bool OSInterface_SimPriorityQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, 0, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_SimPriorityQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message, 0, false);
+}
+
+bool OSInterface_SimPriorityQueue::sendToFront(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return sendFor(message, ring.levelCount() - 1, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms), true);
+}
+
+bool OSInterface_SimPriorityQueue::sendToFrontMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return sendFor(message, ring.levelCount() - 1, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO, true);
+}
+
+bool OSInterface_SimPriorityQueue::sendToFrontFromISR(const void* message)
+{
+    return trySend(message, ring.levelCount() - 1, true);
+}
+
+void* OSInterface_SimPriorityQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    scheduler.await(notFull[0],
+                    scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &slot]
+                    {
+                        slot = ring.reserve(0);
+                        return slot != nullptr;
+                    });
+    return slot;
+}
+
+void OSInterface_SimPriorityQueue::commitSend(void* slot)
+{
+    ring.queue(slot, false);
+    messagesAdded(1);
+}
+
+const void* OSInterface_SimPriorityQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    scheduler.await(notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &slot]
+                    {
+                        slot = ring.take();
+                        return slot != nullptr;
+                    });
+    return slot;
+}
+
+void OSInterface_SimPriorityQueue::releaseReceive(const void* slot)
+{
+    ring.release(slot);
+    slotFreed(slot);
+}
+
+uint32_t OSInterface_SimPriorityQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    uint32_t received = 0;
+    while (received < count && tryReceive(static_cast<uint8_t*>(messages) +
+                                          static_cast<size_t>(received) * ring.messageLength()))
+    {
+        received++;
+    }
+    return received;
+}
+
+uint32_t OSInterface_SimPriorityQueue::trySendN(const void* messages, const uint32_t count)
+{
+    uint32_t sent = 0;
+    uint8_t* slot;
+    while (sent < count && (slot = ring.reserve(0)) != nullptr)
+    {
+        memcpy(slot, static_cast<const uint8_t*>(messages) + static_cast<size_t>(sent) * ring.messageLength(),
+               ring.messageLength());
+        ring.queue(slot, false);
+        sent++;
+    }
+    if (sent != 0)
+    {
+        messagesAdded(sent);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_SimPriorityQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                   const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        scheduler.await(notFull[0],
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, messages, count, &sent]
+                        {
+                            sent = trySendN(messages, count);
+                            return sent != 0;
+                        });
+    }
+    return sent;
+}
+
+uint32_t OSInterface_SimPriorityQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_SimPriorityQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                                const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        scheduler.await(notEmpty,
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, messages, maxMessages, &received]
+                        {
+                            received = tryReceiveN(messages, maxMessages);
+                            return received != 0;
+                        });
+    }
+    return received;
+}
+
+uint32_t OSInterface_SimPriorityQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_SimPriorityQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    // Only drain what is queued now, even if the callbacks let senders run. Each slot is held during its callback,
+    // so it cannot be reused before the callback returns.
+    const uint32_t limit   = ring.length();
+    uint32_t       drained = 0;
+    while (drained < limit)
+    {
+        const uint8_t* slot = ring.take();
+        if (slot == nullptr)
+        {
+            break;
+        }
+        callback(slot, arg);
+        releaseReceive(slot);
+        drained++;
+    }
+    return drained;
+}
+
+uint32_t OSInterface_SimPriorityQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_SimPriorityQueue::pollReady()
+{
+    return ring.length() != 0;
+}
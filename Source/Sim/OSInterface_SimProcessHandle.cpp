@@ -0,0 +1,49 @@
+#include <new>
+#include "OSInterface_SimProcessHandle.h"
+
+OSInterface_SimProcessHandle::~OSInterface_SimProcessHandle()
+{
+    if (started)
+    {
+        scheduler.await(waiters, OSInterface_SimScheduler::FOREVER, [this] { return done; });
+    }
+}
+
+bool OSInterface_SimProcessHandle::start(const OSInterface_ProcessAttributes& attributes)
+{
+    try
+    {
+        name = attributes.name != nullptr ? attributes.name : "";
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    started = scheduler.spawn(run, this, name.c_str());
+    return started;
+}
+
+void OSInterface_SimProcessHandle::join()
+{
+    scheduler.await(waiters, OSInterface_SimScheduler::FOREVER, [this] { return done; });
+}
+
+bool OSInterface_SimProcessHandle::join(const uint32_t maxTimeToWait_ms)
+{
+    return scheduler.await(waiters,
+                           scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                           [this] { return done; });
+}
+
+bool OSInterface_SimProcessHandle::isDone()
+{
+    return done;
+}
+
+void OSInterface_SimProcessHandle::run(void* arg)
+{
+    auto& self = *static_cast<OSInterface_SimProcessHandle*>(arg);
+    self.process(self.arg);
+    self.done = true;
+    self.scheduler.wakeAll(self.waiters);
+}
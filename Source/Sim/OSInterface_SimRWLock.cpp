@@ -0,0 +1,71 @@
+#include "OSInterface_SimRWLock.h"
+
+bool OSInterface_SimRWLock::waitRead(const uint32_t maxTimeToWait_ms)
+{
+    return readFor(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimRWLock::waitReadMicros(const uint32_t maxTimeToWait_us)
+{
+    return readFor(maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+void OSInterface_SimRWLock::signalRead()
+{
+    readers--;
+    if (readers == 0)
+    {
+        scheduler.wakeAll(waiters);
+    }
+}
+
+bool OSInterface_SimRWLock::waitWrite(const uint32_t maxTimeToWait_ms)
+{
+    return writeFor(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimRWLock::waitWriteMicros(const uint32_t maxTimeToWait_us)
+{
+    return writeFor(maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+void OSInterface_SimRWLock::signalWrite()
+{
+    writer = false;
+    scheduler.wakeAll(waiters);
+}
+
+bool OSInterface_SimRWLock::readFor(const uint64_t timeout_ns)
+{
+    return scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns),
+                           [this]
+                           {
+                               if (writer || waitingWriters != 0)
+                               {
+                                   return false;
+                               }
+                               readers++;
+                               return true;
+                           });
+}
+
+bool OSInterface_SimRWLock::writeFor(const uint64_t timeout_ns)
+{
+    waitingWriters++;
+    const bool acquired = scheduler.await(waiters, scheduler.deadlineAfter(timeout_ns),
+                                          [this]
+                                          {
+                                              if (writer || readers != 0)
+                                              {
+                                                  return false;
+                                              }
+                                              writer = true;
+                                              return true;
+                                          });
+    waitingWriters--;
+    if (!acquired && waitingWriters == 0)
+    {
+        scheduler.wakeAll(waiters); // Readers held back by this writer
+    }
+    return acquired;
+}
@@ -0,0 +1,342 @@
+#include <algorithm>
+#include <new>
+#include <system_error>
+#include <thread>
+#include "OSInterface_SimScheduler.h"
+
+static const char* TAG = "OSInterface_Sim";
+
+/**
+ * @brief Thread and blocking state of a simulated process
+ *
+ * As an alarm, the process times out of its current block() when it rings.
+ */
+class OSInterface_SimProcess final : public OSInterface_SimAlarm
+{
+public:
+    OSInterface_SimProcess(OSInterface_SimScheduler& scheduler, const OSInterfaceProcess function, void* arg,
+                           const char* name) :
+        scheduler(scheduler), function(function), arg(arg), name(name)
+    {
+    }
+
+    OSInterface_SimScheduler& scheduler;
+    const OSInterfaceProcess  function; // nullptr for the driver
+    void* const               arg;
+    const char* const         name;
+    std::thread               thread;
+    std::condition_variable   resume; // Notified when the process becomes the current one
+    OSInterface_SimWaitQueue* waitingOn{nullptr};
+    bool                      woken{false}; // Outcome of the last block()
+    bool                      terminating{false};
+    bool                      finished{false};
+
+protected:
+    void ring() override
+    {
+        scheduler.timeout(*this);
+    }
+};
+
+static thread_local OSInterface_SimProcess* threadProcess = nullptr;
+
+OSInterface_SimScheduler::OSInterface_SimScheduler(const uint64_t seed) :
+    driver(std::make_unique<Process>(*this, nullptr, nullptr, "driver")), randomState(seed),
+    previousThreadProcess(threadProcess)
+{
+    current       = driver.get();
+    threadProcess = driver.get();
+}
+
+OSInterface_SimScheduler::~OSInterface_SimScheduler()
+{
+    terminate();
+    threadProcess = previousThreadProcess;
+}
+
+void OSInterface_SimScheduler::terminate()
+{
+    if (terminating)
+    {
+        return;
+    }
+    // Processes are terminated one at a time, each one hands the driver back control once it returned
+    terminating = true;
+    for (const std::unique_ptr<Process>& process : processes)
+    {
+        if (!process->finished)
+        {
+            process->terminating = true;
+            cancelAlarm(*process);
+            if (process->waitingOn != nullptr)
+            {
+                std::erase(process->waitingOn->waiters, process.get());
+                process->waitingOn = nullptr;
+            }
+            switchTo(process.get(), driver.get());
+        }
+    }
+    for (const std::unique_ptr<Process>& process : processes)
+    {
+        process->thread.join();
+    }
+}
+
+bool OSInterface_SimScheduler::isProcess() const
+{
+    return caller() != nullptr;
+}
+
+OSInterface_SimScheduler::Process* OSInterface_SimScheduler::caller() const
+{
+    return threadProcess != nullptr && &threadProcess->scheduler == this ? threadProcess : nullptr;
+}
+
+bool OSInterface_SimScheduler::spawn(const OSInterfaceProcess process, void* arg, const char* name)
+{
+    if (terminating)
+    {
+        return false;
+    }
+    reap();
+    try
+    {
+        ready.reserve(ready.size() + 1);
+        processes.push_back(std::make_unique<Process>(*this, process, arg, name));
+    }
+    catch (const std::bad_alloc&)
+    {
+        OSInterfaceLogError(TAG, "Could not allocate process '%s'", name != nullptr ? name : "");
+        return false;
+    }
+    Process* created = processes.back().get();
+    try
+    {
+        created->thread = std::thread(processMain, this, created);
+    }
+    catch (const std::system_error& error)
+    {
+        OSInterfaceLogError(TAG, "Could not start process '%s': %s", name != nullptr ? name : "", error.what());
+        processes.pop_back();
+        return false;
+    }
+    ready.push_back(created);
+    return true;
+}
+
+bool OSInterface_SimScheduler::block(OSInterface_SimWaitQueue& queue, const uint64_t deadline_ns)
+{
+    Process* self = caller();
+    if (self == nullptr)
+    {
+        return false;
+    }
+    if (self->terminating)
+    {
+        throw OSInterface_SimTerminated();
+    }
+    if (deadline_ns <= now_ns)
+    {
+        return false;
+    }
+    queue.waiters.push_back(self);
+    self->waitingOn = &queue;
+    if (deadline_ns != FOREVER)
+    {
+        setAlarm(*self, deadline_ns);
+    }
+    suspend(*self);
+    return self->woken;
+}
+
+void OSInterface_SimScheduler::sleepUntil(const uint64_t deadline_ns)
+{
+    OSInterface_SimWaitQueue nobody;
+    block(nobody, deadline_ns);
+}
+
+void OSInterface_SimScheduler::yield()
+{
+    Process* self = caller();
+    if (self == nullptr)
+    {
+        return;
+    }
+    if (self->terminating)
+    {
+        throw OSInterface_SimTerminated();
+    }
+    ready.push_back(self);
+    suspend(*self);
+}
+
+bool OSInterface_SimScheduler::wakeOne(OSInterface_SimWaitQueue& queue)
+{
+    if (queue.waiters.empty())
+    {
+        return false;
+    }
+    makeReady(*queue.waiters.front(), true);
+    return true;
+}
+
+uint32_t OSInterface_SimScheduler::wakeAll(OSInterface_SimWaitQueue& queue)
+{
+    uint32_t woken = 0;
+    while (wakeOne(queue))
+    {
+        woken++;
+    }
+    return woken;
+}
+
+void OSInterface_SimScheduler::setAlarm(OSInterface_SimAlarm& alarm, const uint64_t deadline_ns)
+{
+    cancelAlarm(alarm);
+    alarm.set         = true;
+    alarm.deadline_ns = std::max(deadline_ns, now_ns);
+    alarm.sequence    = alarmSequence++;
+    alarms.emplace(AlarmKey{alarm.deadline_ns, alarm.sequence}, &alarm);
+}
+
+void OSInterface_SimScheduler::cancelAlarm(OSInterface_SimAlarm& alarm)
+{
+    if (alarm.set)
+    {
+        alarms.erase(AlarmKey{alarm.deadline_ns, alarm.sequence});
+        alarm.set = false;
+    }
+}
+
+void OSInterface_SimScheduler::processMain(OSInterface_SimScheduler* scheduler, Process* process)
+{
+    threadProcess = process;
+    {
+        std::unique_lock guard(scheduler->lock);
+        process->resume.wait(guard, [scheduler, process] { return scheduler->current == process; });
+    }
+    if (!process->terminating)
+    {
+        try
+        {
+            process->function(process->arg);
+        }
+        catch (const OSInterface_SimTerminated&)
+        {
+            // The scheduler is being deleted
+        }
+    }
+    scheduler->finish(*process);
+}
+
+/**
+ * @brief Pick the process to run next, advancing the virtual time until one is ready
+ *
+ * @return Process* The next process, which is no longer in the ready list
+ */
+OSInterface_SimScheduler::Process* OSInterface_SimScheduler::pickNext()
+{
+    while (ready.empty())
+    {
+        if (alarms.empty())
+        {
+            OSInterfaceLogError(TAG, "Deadlock at %llu ms, every process is blocked without a timeout",
+                                static_cast<unsigned long long>(now_ns / NANOS_PER_MILLI));
+            makeReady(*driver, false);
+            break;
+        }
+        // Every alarm of the earliest deadline rings before a process is picked, so that the processes they wake up
+        // are all candidates
+        const uint64_t deadline = alarms.begin()->first.first;
+        now_ns                  = deadline;
+        while (!alarms.empty() && alarms.begin()->first.first == deadline)
+        {
+            OSInterface_SimAlarm* alarm = alarms.begin()->second;
+            alarms.erase(alarms.begin());
+            alarm->set = false;
+            alarm->ring();
+        }
+    }
+    const auto index = static_cast<size_t>(random() % ready.size());
+    Process*   next  = ready[index];
+    ready.erase(ready.begin() + static_cast<ptrdiff_t>(index));
+    return next;
+}
+
+uint64_t OSInterface_SimScheduler::random()
+{
+    // SplitMix64, which unlike the distributions of <random> gives the same sequence with every standard library
+    uint64_t value = (randomState += 0x9E3779B97F4A7C15ULL);
+    value          = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value          = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+void OSInterface_SimScheduler::makeReady(Process& process, const bool woken)
+{
+    if (process.waitingOn != nullptr)
+    {
+        std::erase(process.waitingOn->waiters, &process);
+        process.waitingOn = nullptr;
+    }
+    cancelAlarm(process);
+    process.woken = woken;
+    ready.push_back(&process);
+}
+
+void OSInterface_SimScheduler::timeout(Process& process)
+{
+    makeReady(process, false);
+}
+
+/**
+ * @brief Give control to the next process until the caller is picked again
+ */
+void OSInterface_SimScheduler::suspend(Process& self)
+{
+    Process* next = pickNext();
+    if (next != &self)
+    {
+        switchTo(next, &self);
+    }
+    if (self.terminating)
+    {
+        throw OSInterface_SimTerminated();
+    }
+}
+
+void OSInterface_SimScheduler::switchTo(Process* next, Process* self)
+{
+    std::unique_lock guard(lock);
+    current = next;
+    next->resume.notify_one();
+    self->resume.wait(guard, [this, self] { return current == self; });
+}
+
+void OSInterface_SimScheduler::finish(Process& process)
+{
+    process.finished = true;
+    Process*        next = process.terminating ? driver.get() : pickNext();
+    std::lock_guard guard(lock);
+    current = next;
+    next->resume.notify_one();
+}
+
+/**
+ * @brief Join and delete the processes that returned
+ */
+void OSInterface_SimScheduler::reap()
+{
+    for (auto process = processes.begin(); process != processes.end();)
+    {
+        if ((*process)->finished)
+        {
+            (*process)->thread.join();
+            process = processes.erase(process);
+        }
+        else
+        {
+            ++process;
+        }
+    }
+}
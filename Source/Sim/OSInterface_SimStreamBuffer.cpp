@@ -0,0 +1,177 @@
+#include "OSInterface_SimStreamBuffer.h"
+
+uint32_t OSInterface_SimStreamBuffer::size()
+{
+    return ring.size();
+}
+
+uint32_t OSInterface_SimStreamBuffer::length()
+{
+    return ring.length();
+}
+
+uint32_t OSInterface_SimStreamBuffer::available()
+{
+    return ring.available();
+}
+
+bool OSInterface_SimStreamBuffer::setTriggerLevel(const uint32_t triggerLevel)
+{
+    if (triggerLevel > ring.size())
+    {
+        return false;
+    }
+    this->triggerLevel = triggerLevel == 0 ? 1 : triggerLevel;
+    // A lower level may release a waiting reader
+    sent();
+    return true;
+}
+
+void OSInterface_SimStreamBuffer::reset()
+{
+    ring.reset();
+    scheduler.wakeAll(notFull);
+}
+
+void OSInterface_SimStreamBuffer::sent()
+{
+    if (ring.length() >= triggerLevel)
+    {
+        scheduler.wakeOne(notEmpty);
+    }
+}
+
+void OSInterface_SimStreamBuffer::received(const uint32_t count)
+{
+    if (count != 0)
+    {
+        scheduler.wakeOne(notFull);
+    }
+}
+
+uint32_t OSInterface_SimStreamBuffer::trySend(const void* data, const uint32_t length)
+{
+    const uint32_t written = ring.write(data, length);
+    if (written != 0)
+    {
+        sent();
+    }
+    return written;
+}
+
+uint32_t OSInterface_SimStreamBuffer::tryReceive(void* buffer, const uint32_t maxLength, const bool triggeredOnly)
+{
+    if (triggeredOnly && ring.length() < triggerLevel)
+    {
+        return 0;
+    }
+    const uint32_t count = ring.read(buffer, maxLength);
+    received(count);
+    return count;
+}
+
+uint32_t OSInterface_SimStreamBuffer::send(const void* data, const uint32_t length, const uint32_t maxTimeToWait_ms)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint32_t    total = 0;
+    scheduler.await(notFull, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, bytes, length, &total]
+                    {
+                        total += trySend(bytes + total, length - total);
+                        return total == length;
+                    });
+    return total;
+}
+
+uint32_t OSInterface_SimStreamBuffer::sendFromISR(const void* data, const uint32_t length)
+{
+    return trySend(data, length);
+}
+
+uint32_t OSInterface_SimStreamBuffer::receive(void* buffer, const uint32_t maxLength, const uint32_t maxTimeToWait_ms)
+{
+    if (maxLength == 0)
+    {
+        return 0;
+    }
+    uint32_t   count     = 0;
+    const bool triggered = scheduler.await(
+        notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+        [this, buffer, maxLength, &count]
+        {
+            count = tryReceive(buffer, maxLength, true);
+            return count != 0;
+        });
+    return triggered ? count : tryReceive(buffer, maxLength, false);
+}
+
+uint32_t OSInterface_SimStreamBuffer::receiveFromISR(void* buffer, const uint32_t maxLength)
+{
+    return tryReceive(buffer, maxLength, false);
+}
+
+void* OSInterface_SimStreamBuffer::tryAcquireSend(uint32_t& length)
+{
+    uint8_t* view = ring.writeView(length);
+    return length != 0 ? view : nullptr;
+}
+
+void* OSInterface_SimStreamBuffer::acquireSend(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    void* view = nullptr;
+    scheduler.await(notFull, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &length, &view]
+                    {
+                        view = tryAcquireSend(length);
+                        return view != nullptr;
+                    });
+    return view;
+}
+
+void* OSInterface_SimStreamBuffer::acquireSendFromISR(uint32_t& length)
+{
+    return tryAcquireSend(length);
+}
+
+void OSInterface_SimStreamBuffer::commitSend(const uint32_t written)
+{
+    ring.commitWrite(written);
+    if (written != 0)
+    {
+        sent();
+    }
+}
+
+const void* OSInterface_SimStreamBuffer::tryPeekReceive(uint32_t& length, const bool triggeredOnly)
+{
+    if (ring.length() == 0 || (triggeredOnly && ring.length() < triggerLevel))
+    {
+        length = 0;
+        return nullptr;
+    }
+    return ring.readView(length);
+}
+
+const void* OSInterface_SimStreamBuffer::peekReceive(uint32_t& length, const uint32_t maxTimeToWait_ms)
+{
+    const void* view      = nullptr;
+    const bool  triggered = scheduler.await(
+        notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+        [this, &length, &view]
+        {
+            view = tryPeekReceive(length, true);
+            return view != nullptr;
+        });
+    return triggered ? view : tryPeekReceive(length, false);
+}
+
+const void* OSInterface_SimStreamBuffer::peekReceiveFromISR(uint32_t& length)
+{
+    return tryPeekReceive(length, false);
+}
+
+void OSInterface_SimStreamBuffer::releaseReceive(const uint32_t consumed)
+{
+    ring.consume(consumed);
+    received(consumed);
+}
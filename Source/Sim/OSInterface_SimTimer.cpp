@@ -0,0 +1,164 @@
+#include <utility>
+#include "OSInterface_SimTimer.h"
+
+OSInterface_SimTimer::OSInterface_SimTimer(OSInterface_SimTimerService& service, const uint32_t period,
+                                           const Mode mode, const OSInterfaceProcess callback, void* callbackArg,
+                                           const char* timerName) :
+    service(service), mode(mode), callback(callback), callbackArg(callbackArg), name(timerName), period_ms(period)
+{
+}
+
+OSInterface_SimTimer::~OSInterface_SimTimer()
+{
+    service.disarm(*this);
+}
+
+bool OSInterface_SimTimer::start()
+{
+    return service.arm(*this);
+}
+
+bool OSInterface_SimTimer::startFromISR()
+{
+    return start();
+}
+
+bool OSInterface_SimTimer::stop()
+{
+    service.disarm(*this);
+    return true;
+}
+
+bool OSInterface_SimTimer::stopFromISR()
+{
+    return stop();
+}
+
+bool OSInterface_SimTimer::isRunning() const
+{
+    return isSet();
+}
+
+bool OSInterface_SimTimer::setPeriod(const uint32_t newPeriod_ms)
+{
+    if (newPeriod_ms == 0)
+    {
+        return false;
+    }
+    period_ms = newPeriod_ms;
+    return service.arm(*this);
+}
+
+bool OSInterface_SimTimer::setPeriodFromISR(const uint32_t newPeriod_ms)
+{
+    return setPeriod(newPeriod_ms);
+}
+
+uint32_t OSInterface_SimTimer::getPeriod() const
+{
+    return period_ms;
+}
+
+OSInterface_Timer::Mode OSInterface_SimTimer::getMode() const
+{
+    return mode;
+}
+
+uint32_t OSInterface_SimTimer::getTimeout() const
+{
+    const uint64_t now = service.scheduler.now();
+    return expiry_ns > now ? static_cast<uint32_t>((expiry_ns - now) / OSInterface_SimScheduler::NANOS_PER_MILLI) : 0;
+}
+
+uint32_t OSInterface_SimTimer::getTimeoutTime() const
+{
+    return static_cast<uint32_t>(getTimeoutTime64());
+}
+
+uint64_t OSInterface_SimTimer::getTimeoutTime64() const
+{
+    return expiry_ns / OSInterface_SimScheduler::NANOS_PER_MILLI;
+}
+
+const char* OSInterface_SimTimer::getName() const
+{
+    return name;
+}
+
+bool OSInterface_SimTimer::pollReady()
+{
+    return std::exchange(expired, false);
+}
+
+void OSInterface_SimTimer::ring()
+{
+    if (mode == PERIODIC)
+    {
+        expiry_ns = getDeadline() + period_ms * OSInterface_SimScheduler::NANOS_PER_MILLI;
+        service.scheduler.setAlarm(*this, expiry_ns);
+    }
+    service.post(*this);
+}
+
+void OSInterface_SimTimer::expire()
+{
+    if (isInWaitSet())
+    {
+        expired = true;
+        notifyWaitSet();
+    }
+    callback(callbackArg);
+}
+
+bool OSInterface_SimTimerService::arm(OSInterface_SimTimer& timer)
+{
+    if (!started)
+    {
+        started = scheduler.spawn(run, this, "OSInterfaceTmr");
+        if (!started)
+        {
+            return false;
+        }
+    }
+    timer.expiry_ns = scheduler.deadlineAfter(timer.period_ms * OSInterface_SimScheduler::NANOS_PER_MILLI);
+    scheduler.setAlarm(timer, timer.expiry_ns);
+    return true;
+}
+
+void OSInterface_SimTimerService::disarm(OSInterface_SimTimer& timer)
+{
+    scheduler.cancelAlarm(timer);
+    if (timer.due)
+    {
+        std::erase(dueTimers, &timer);
+        timer.due = false;
+    }
+}
+
+void OSInterface_SimTimerService::post(OSInterface_SimTimer& timer)
+{
+    // A timer whose previous callback has not run yet only gets one, as a late timer of the Linux backend would
+    if (!timer.due)
+    {
+        timer.due = true;
+        dueTimers.push_back(&timer);
+        scheduler.wakeOne(wake);
+    }
+}
+
+void OSInterface_SimTimerService::run(void* arg)
+{
+    auto& service = *static_cast<OSInterface_SimTimerService*>(arg);
+    while (true)
+    {
+        if (!service.scheduler.await(service.wake, OSInterface_SimScheduler::FOREVER,
+                                     [&service] { return !service.dueTimers.empty(); }))
+        {
+            continue;
+        }
+        OSInterface_SimTimer& timer = *service.dueTimers.front();
+        service.dueTimers.pop_front();
+        timer.due = false;
+        timer.expire();
+    }
+}
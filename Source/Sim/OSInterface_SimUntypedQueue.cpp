@@ -0,0 +1,391 @@
+#include <cstring>
+#include <new>
+#include "OSInterface_SimUntypedQueue.h"
+
+OSInterface_SimUntypedQueue::OSInterface_SimUntypedQueue(OSInterface_SimScheduler& scheduler,
+                                                         const uint32_t maxMessages, const uint32_t messageSize) :
+    scheduler(scheduler), maxMessages(maxMessages), messageSize(messageSize),
+    storage(new(std::nothrow) uint8_t[static_cast<size_t>(maxMessages) * messageSize]),
+    states(new(std::nothrow) uint8_t[maxMessages]())
+{
+}
+
+bool OSInterface_SimUntypedQueue::isValid() const
+{
+    return storage != nullptr && states != nullptr && maxMessages > 0 && messageSize > 0;
+}
+
+uint8_t* OSInterface_SimUntypedQueue::slotAddress(const uint32_t slot) const
+{
+    return &storage[static_cast<size_t>(slot) * messageSize];
+}
+
+uint32_t OSInterface_SimUntypedQueue::slotIndex(const void* address) const
+{
+    return static_cast<uint32_t>((static_cast<const uint8_t*>(address) - storage.get()) / messageSize);
+}
+
+uint32_t OSInterface_SimUntypedQueue::next(const uint32_t slot) const
+{
+    return slot + 1 == maxMessages ? 0 : slot + 1;
+}
+
+uint32_t OSInterface_SimUntypedQueue::length()
+{
+    return ready;
+}
+
+uint32_t OSInterface_SimUntypedQueue::size()
+{
+    return maxMessages;
+}
+
+uint32_t OSInterface_SimUntypedQueue::available()
+{
+    return maxMessages - used;
+}
+
+bool OSInterface_SimUntypedQueue::isEmpty()
+{
+    return ready == 0;
+}
+
+bool OSInterface_SimUntypedQueue::isFull()
+{
+    return used == maxMessages;
+}
+
+void OSInterface_SimUntypedQueue::reset()
+{
+    // Slots that are being written keep their place in the ring, so the messages queued behind them are only marked
+    // as discarded and skipped once the receivers get there
+    uint32_t slot = head;
+    for (uint32_t i = 0; i < pending; i++)
+    {
+        if (states[slot] == READY)
+        {
+            states[slot] = DISCARDED;
+        }
+        slot = next(slot);
+    }
+    ready = 0;
+    skipDiscarded();
+    scheduler.wakeAll(notFull);
+}
+
+void OSInterface_SimUntypedQueue::messagesAdded(const uint32_t count)
+{
+    // One process per message or slot, the others keep waiting
+    uint32_t woken = 0;
+    while (woken < count && scheduler.wakeOne(notEmpty))
+    {
+        woken++;
+    }
+    notifyWaitSet();
+}
+
+void OSInterface_SimUntypedQueue::slotsFreed(const uint32_t count)
+{
+    // One process per message or slot, the others keep waiting
+    uint32_t woken = 0;
+    while (woken < count && scheduler.wakeOne(notFull))
+    {
+        woken++;
+    }
+}
+
+uint8_t* OSInterface_SimUntypedQueue::tryPut(const SlotState newState, const bool toFront)
+{
+    uint32_t slot;
+    if (toFront)
+    {
+        slot = head == 0 ? maxMessages - 1 : head - 1;
+        if (states[slot] != FREE)
+        {
+            return nullptr;
+        }
+        head = slot;
+    }
+    else
+    {
+        slot = tail;
+        if (states[slot] != FREE)
+        {
+            return nullptr;
+        }
+        tail = next(tail);
+    }
+    states[slot] = newState;
+    pending++;
+    used++;
+    if (newState == READY)
+    {
+        ready++;
+    }
+    return slotAddress(slot);
+}
+
+void OSInterface_SimUntypedQueue::skipDiscarded()
+{
+    while (pending != 0 && states[head] == DISCARDED)
+    {
+        states[head] = FREE;
+        head         = next(head);
+        pending--;
+        used--;
+    }
+}
+
+uint8_t* OSInterface_SimUntypedQueue::tryTake(const SlotState newState)
+{
+    skipDiscarded();
+    if (pending == 0 || states[head] != READY)
+    {
+        return nullptr;
+    }
+    const uint32_t slot = head;
+    head                = next(head);
+    pending--;
+    ready--;
+    states[slot] = newState;
+    if (newState == FREE)
+    {
+        used--;
+    }
+    return slotAddress(slot);
+}
+
+void OSInterface_SimUntypedQueue::setState(const void* address, const SlotState newState)
+{
+    const uint32_t slot = slotIndex(address);
+    states[slot]        = newState;
+    if (newState == READY)
+    {
+        ready++;
+    }
+    else if (newState == FREE)
+    {
+        used--;
+    }
+}
+
+bool OSInterface_SimUntypedQueue::tryReceive(void* message)
+{
+    const uint8_t* slot = tryTake(FREE);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(message, slot, messageSize);
+    slotsFreed(1);
+    return true;
+}
+
+bool OSInterface_SimUntypedQueue::trySend(const void* message, const bool toFront)
+{
+    uint8_t* slot = tryPut(READY, toFront);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    memcpy(slot, message, messageSize);
+    messagesAdded(1);
+    return true;
+}
+
+bool OSInterface_SimUntypedQueue::receiveFor(void* message, const uint64_t timeout_ns)
+{
+    return scheduler.await(notEmpty, scheduler.deadlineAfter(timeout_ns),
+                           [this, message] { return tryReceive(message); });
+}
+
+bool OSInterface_SimUntypedQueue::receive(void* message, const uint32_t maxTimeToWait_ms)
+{
+    return receiveFor(message, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms));
+}
+
+bool OSInterface_SimUntypedQueue::receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+{
+    return receiveFor(message, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO);
+}
+
+bool OSInterface_SimUntypedQueue::receiveFromISR(void* message)
+{
+    return tryReceive(message);
+}
+
+bool OSInterface_SimUntypedQueue::send(const void* message, const uint64_t timeout_ns, const bool toFront)
+{
+    return scheduler.await(notFull, scheduler.deadlineAfter(timeout_ns),
+                           [this, message, toFront] { return trySend(message, toFront); });
+}
+
+bool OSInterface_SimUntypedQueue::sendToBack(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return send(message, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms), false);
+}
+
+bool OSInterface_SimUntypedQueue::sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return send(message, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO, false);
+}
+
+bool OSInterface_SimUntypedQueue::sendToBackFromISR(const void* message)
+{
+    return trySend(message, false);
+}
+
+bool OSInterface_SimUntypedQueue::sendToFront(const void* message, const uint32_t maxTimeToWait_ms)
+{
+    return send(message, OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms), true);
+}
+
+bool OSInterface_SimUntypedQueue::sendToFrontMicros(const void* message, const uint32_t maxTimeToWait_us)
+{
+    return send(message, maxTimeToWait_us * OSInterface_SimScheduler::NANOS_PER_MICRO, true);
+}
+
+bool OSInterface_SimUntypedQueue::sendToFrontFromISR(const void* message)
+{
+    return trySend(message, true);
+}
+
+void* OSInterface_SimUntypedQueue::acquireSendSlot(const uint32_t maxTimeToWait_ms)
+{
+    uint8_t* slot = nullptr;
+    scheduler.await(notFull, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &slot]
+                    {
+                        slot = tryPut(WRITING, false);
+                        return slot != nullptr;
+                    });
+    return slot;
+}
+
+void OSInterface_SimUntypedQueue::commitSend(void* slot)
+{
+    setState(slot, READY);
+    messagesAdded(1);
+}
+
+const void* OSInterface_SimUntypedQueue::peekReceiveSlot(const uint32_t maxTimeToWait_ms)
+{
+    const uint8_t* slot = nullptr;
+    scheduler.await(notEmpty, scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                    [this, &slot]
+                    {
+                        slot = tryTake(READING);
+                        return slot != nullptr;
+                    });
+    return slot;
+}
+
+void OSInterface_SimUntypedQueue::releaseReceive(const void* slot)
+{
+    setState(slot, FREE);
+    slotsFreed(1);
+}
+
+uint32_t OSInterface_SimUntypedQueue::tryReceiveN(void* messages, const uint32_t count)
+{
+    uint32_t       received = 0;
+    const uint8_t* slot;
+    while (received < count && (slot = tryTake(FREE)) != nullptr)
+    {
+        memcpy(static_cast<uint8_t*>(messages) + static_cast<size_t>(received) * messageSize, slot, messageSize);
+        received++;
+    }
+    slotsFreed(received);
+    return received;
+}
+
+uint32_t OSInterface_SimUntypedQueue::trySendN(const void* messages, const uint32_t count)
+{
+    uint32_t sent = 0;
+    uint8_t* slot;
+    while (sent < count && (slot = tryPut(READY, false)) != nullptr)
+    {
+        memcpy(slot, static_cast<const uint8_t*>(messages) + static_cast<size_t>(sent) * messageSize, messageSize);
+        sent++;
+    }
+    if (sent != 0)
+    {
+        messagesAdded(sent);
+    }
+    return sent;
+}
+
+uint32_t OSInterface_SimUntypedQueue::sendToBackN(const void* messages, const uint32_t count,
+                                                  const uint32_t maxTimeToWait_ms)
+{
+    uint32_t sent = 0;
+    if (count != 0)
+    {
+        scheduler.await(notFull,
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, messages, count, &sent]
+                        {
+                            sent = trySendN(messages, count);
+                            return sent != 0;
+                        });
+    }
+    return sent;
+}
+
+uint32_t OSInterface_SimUntypedQueue::sendToBackNFromISR(const void* messages, const uint32_t count)
+{
+    return trySendN(messages, count);
+}
+
+uint32_t OSInterface_SimUntypedQueue::receiveN(void* messages, const uint32_t maxMessages,
+                                               const uint32_t maxTimeToWait_ms)
+{
+    uint32_t received = 0;
+    if (maxMessages != 0)
+    {
+        scheduler.await(notEmpty,
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, messages, maxMessages, &received]
+                        {
+                            received = tryReceiveN(messages, maxMessages);
+                            return received != 0;
+                        });
+    }
+    return received;
+}
+
+uint32_t OSInterface_SimUntypedQueue::receiveNFromISR(void* messages, const uint32_t maxMessages)
+{
+    return tryReceiveN(messages, maxMessages);
+}
+
+uint32_t OSInterface_SimUntypedQueue::drain(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    // Only drain what is queued now, even if the callbacks let senders run. Each slot stays READING during its
+    // callback, so it cannot be reused before the callback returns.
+    const uint32_t limit   = ready;
+    uint32_t       drained = 0;
+    while (drained < limit)
+    {
+        uint8_t* slot = tryTake(READING);
+        if (slot == nullptr)
+        {
+            break;
+        }
+        callback(slot, arg);
+        setState(slot, FREE);
+        slotsFreed(1);
+        drained++;
+    }
+    return drained;
+}
+
+uint32_t OSInterface_SimUntypedQueue::drainFromISR(const OSInterfaceQueueDrainCallback callback, void* arg)
+{
+    return drain(callback, arg);
+}
+
+bool OSInterface_SimUntypedQueue::pollReady()
+{
+    return ready != 0;
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <new>
+#include "OSInterface_SimWaitSet.h"
+
+bool OSInterface_SimWaitable::attach(OSInterface_SimWaitSet& set)
+{
+    if (waitSet != nullptr)
+    {
+        return false;
+    }
+    waitSet = &set;
+    return true;
+}
+
+void OSInterface_SimWaitable::detach()
+{
+    waitSet = nullptr;
+}
+
+void OSInterface_SimWaitable::notifyWaitSet()
+{
+    if (waitSet != nullptr)
+    {
+        waitSet->notify();
+    }
+}
+
+OSInterface_SimWaitSet::~OSInterface_SimWaitSet()
+{
+    for (const Member& member : members)
+    {
+        member.waitable->detach();
+    }
+}
+
+bool OSInterface_SimWaitSet::add(OSInterface_UntypedQueue* queue)
+{
+    return addMember(queue, dynamic_cast<OSInterface_SimWaitable*>(queue));
+}
+
+bool OSInterface_SimWaitSet::add(OSInterface_BinarySemaphore* semaphore)
+{
+    return addMember(semaphore, dynamic_cast<OSInterface_SimWaitable*>(semaphore));
+}
+
+bool OSInterface_SimWaitSet::add(OSInterface_Timer* timer)
+{
+    return addMember(timer, dynamic_cast<OSInterface_SimWaitable*>(timer));
+}
+
+bool OSInterface_SimWaitSet::remove(OSInterface_UntypedQueue* queue)
+{
+    return removeMember(queue);
+}
+
+bool OSInterface_SimWaitSet::remove(OSInterface_BinarySemaphore* semaphore)
+{
+    return removeMember(semaphore);
+}
+
+bool OSInterface_SimWaitSet::remove(OSInterface_Timer* timer)
+{
+    return removeMember(timer);
+}
+
+uint32_t OSInterface_SimWaitSet::wait(const void** readyMembers, const uint32_t maxMembers,
+                                      const uint32_t maxTimeToWait_ms)
+{
+    uint32_t count = 0;
+    if (readyMembers != nullptr && maxMembers != 0)
+    {
+        scheduler.await(waiters,
+                        scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                        [this, readyMembers, maxMembers, &count]
+                        {
+                            count = poll(readyMembers, maxMembers);
+                            return count != 0;
+                        });
+    }
+    return count;
+}
+
+bool OSInterface_SimWaitSet::addMember(const void* handle, OSInterface_SimWaitable* waitable)
+{
+    if (waitable == nullptr)
+    {
+        return false; // Not created by the simulation backend
+    }
+    try
+    {
+        members.reserve(members.size() + 1);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    if (!waitable->attach(*this))
+    {
+        return false;
+    }
+    members.push_back({handle, waitable});
+    // The member may already be ready and a process may already be waiting on the set
+    notify();
+    return true;
+}
+
+bool OSInterface_SimWaitSet::removeMember(const void* handle)
+{
+    const auto member = std::find_if(members.begin(), members.end(),
+                                     [handle](const Member& entry) { return entry.handle == handle; });
+    if (member == members.end())
+    {
+        return false;
+    }
+    member->waitable->detach();
+    members.erase(member);
+    if (nextMember >= members.size())
+    {
+        nextMember = 0;
+    }
+    return true;
+}
+
+uint32_t OSInterface_SimWaitSet::poll(const void** readyMembers, const uint32_t maxMembers)
+{
+    uint32_t     count = 0;
+    const size_t total = members.size();
+    const size_t first = nextMember;
+    for (size_t i = 0; i < total && count < maxMembers; i++)
+    {
+        const size_t index = (first + i) % total;
+        if (members[index].waitable->pollReady())
+        {
+            readyMembers[count++] = members[index].handle;
+            nextMember            = (index + 1) % total;
+        }
+    }
+    return count;
+}
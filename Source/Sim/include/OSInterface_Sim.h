@@ -0,0 +1,140 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIM_H
+#define OSINTERFACE_OSINTERFACE_SIM_H
+
+#include <cstdint>
+#include "OSInterface.h"
+#include "OSInterface_EventCount.h"
+#include "OSInterface_SimBinarySemaphore.h"
+#include "OSInterface_SimCountingSemaphore.h"
+#include "OSInterface_SimEventGroup.h"
+#include "OSInterface_SimJob.h"
+#include "OSInterface_SimMessageBuffer.h"
+#include "OSInterface_SimMutex.h"
+#include "OSInterface_SimPriorityQueue.h"
+#include "OSInterface_SimProcessHandle.h"
+#include "OSInterface_SimRWLock.h"
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_SimStreamBuffer.h"
+#include "OSInterface_SimTimer.h"
+#include "OSInterface_SimUntypedQueue.h"
+#include "OSInterface_SimWaitSet.h"
+
+/**
+ * @brief Deterministic virtual-time implementation of OSInterface, for tests and simulations
+ *
+ * Every process, timer callback and job runs on an OSInterface_SimScheduler: one at a time, in an order chosen by a
+ * pseudo-random generator, on a virtual clock that only advances when every process is blocked. Sleeping for an hour
+ * takes no real time, and running the same code with the same seed gives the same interleaving and the same times, so
+ * a failing seed can be replayed. osTicks() counts virtual nanoseconds. Like those of OSInterface_Linux, the factories
+ * return the concrete final classes.
+ *
+ * The thread that creates this object is the driver process: the processes it starts only run while it sleeps or
+ * waits. If every process is blocked without a timeout, the blocking call of the driver fails as if it timed out and
+ * the deadlock is logged.
+ *
+ * @note Objects created by this instance must only be used from its processes, including the driver. From other
+ * threads, blocking calls do not block.
+ * @note Every object created by this instance must be deleted before it, by the driver. Deleting it terminates the
+ * processes that are still running (see OSInterface_SimTerminated).
+ */
+class OSInterface_Sim final : public OSInterface
+{
+public:
+    /**
+     * @param seed Seed of the scheduling choices, the same seed replays the same run
+     */
+    explicit OSInterface_Sim(uint64_t seed);
+
+    OSInterface_Sim(const OSInterface_Sim&)            = delete;
+    OSInterface_Sim& operator=(const OSInterface_Sim&) = delete;
+    OSInterface_Sim(OSInterface_Sim&&)                 = delete;
+    OSInterface_Sim& operator=(OSInterface_Sim&&)      = delete;
+
+    ~OSInterface_Sim() override;
+
+    /**
+     * @return OSInterface_SimScheduler& Scheduler of the processes, to sleep until a virtual time or yield
+     */
+    OSInterface_SimScheduler& getScheduler()
+    {
+        return scheduler;
+    }
+
+    void                              osSleep(uint32_t ms) override;
+    uint32_t                          osMillis() override;
+    void                              osSleepMicros(uint32_t us) override;
+    uint64_t                          osMillis64() override;
+    uint64_t                          osMicros64() override;
+    uint64_t                          osTicks() override;
+    uint64_t                          osTicksPerSecond() override;
+    OSInterface_SimMutex*             osCreateMutex() override;
+    OSInterface_SimMutex*             osCreateMutex(OSInterface_Mutex::Mode mode) override;
+    OSInterface_SimRWLock*            osCreateRWLock() override;
+    OSInterface_SimBinarySemaphore*   osCreateBinarySemaphore() override;
+    OSInterface_SimCountingSemaphore* osCreateCountingSemaphore(uint32_t maxCount, uint32_t initialCount) override;
+    OSInterface_SimEventGroup*        osCreateEventGroup() override;
+    OSInterface_SimTimer*             osCreateTimer(uint32_t period, OSInterface_Timer::Mode mode,
+                                                    OSInterfaceProcess callback, void* callbackArg,
+                                                    const char* timerName) override;
+    OSInterface_SimUntypedQueue*      osCreateUntypedQueue(uint32_t maxMessages, uint32_t messageSize) override;
+    OSInterface_SimUntypedQueue*      osCreateUntypedQueue(
+        uint32_t maxMessages, uint32_t messageSize, OSInterface_UntypedQueue::AccessPattern accessPattern) override;
+    OSInterface_SimPriorityQueue*     osCreatePriorityQueue(uint32_t maxMessages, uint32_t messageSize,
+                                                            uint32_t priorityLevels) override;
+    OSInterface_SimMessageBuffer*     osCreateMessageBuffer(uint32_t capacity) override;
+    OSInterface_SimStreamBuffer*      osCreateStreamBuffer(uint32_t capacity, uint32_t triggerLevel) override;
+    OSInterface_SimWaitSet*           osCreateWaitSet() override;
+    void*                             osMalloc(uint32_t size) override;
+    void                              osFree(void* ptr) override;
+    void                              osGetMemoryStats(OSInterface_MemoryStats& stats) override;
+    void                              osRunProcess(OSInterfaceProcess process, void* arg) override;
+    void                              osRunProcess(OSInterfaceProcess process, const char* processName,
+                                                   void* arg) override;
+    OSInterface_SimProcessHandle*     osRunProcess(OSInterfaceProcess process, void* arg,
+                                                   const OSInterface_ProcessAttributes& attributes) override;
+    OSInterface_SimJob*               osSubmit(OSInterfaceProcess job, void* arg) override;
+
+private:
+    OSInterface_SimScheduler    scheduler;
+    OSInterface_SimTimerService timerService; // Its process is terminated by the destructor, before it is deleted
+
+    uint64_t bytesInUse{0};
+    uint64_t peakBytesInUse{0};
+    uint64_t failedAllocations{0};
+};
+
+/**
+ * @brief Event count blocking the processes on a wait queue of the scheduler
+ */
+template <> class OSInterface_EventCount<OSInterface_Sim>
+{
+public:
+    explicit OSInterface_EventCount(OSInterface_Sim& osInterface) : scheduler(osInterface.getScheduler())
+    {
+    }
+
+    OSInterface_EventCount(const OSInterface_EventCount&)            = delete;
+    OSInterface_EventCount& operator=(const OSInterface_EventCount&) = delete;
+    OSInterface_EventCount(OSInterface_EventCount&&)                 = delete;
+    OSInterface_EventCount& operator=(OSInterface_EventCount&&)      = delete;
+
+    ~OSInterface_EventCount() = default;
+
+    template <typename Operation> bool await(Operation&& tryOperation, const uint32_t maxTimeToWait_ms)
+    {
+        return scheduler.await(waiters,
+                               scheduler.deadlineAfter(OSInterface_SimScheduler::timeoutFromMillis(maxTimeToWait_ms)),
+                               tryOperation);
+    }
+
+    void notifyOne()
+    {
+        scheduler.wakeOne(waiters);
+    }
+
+private:
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIM_H
@@ -0,0 +1,41 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMBINARYSEMAPHORE_H
+#define OSINTERFACE_OSINTERFACE_SIMBINARYSEMAPHORE_H
+
+#include <cstdint>
+#include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_SimWaitSet.h"
+
+/**
+ * @brief Binary semaphore of the simulation backend
+ *
+ * As a wait set member, the semaphore is ready while it is signaled.
+ */
+class OSInterface_SimBinarySemaphore final : public OSInterface_BinarySemaphore, public OSInterface_SimWaitable
+{
+public:
+    explicit OSInterface_SimBinarySemaphore(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimBinarySemaphore(const OSInterface_SimBinarySemaphore&)            = delete;
+    OSInterface_SimBinarySemaphore& operator=(const OSInterface_SimBinarySemaphore&) = delete;
+    OSInterface_SimBinarySemaphore(OSInterface_SimBinarySemaphore&&)                 = delete;
+    OSInterface_SimBinarySemaphore& operator=(OSInterface_SimBinarySemaphore&&)      = delete;
+
+    ~OSInterface_SimBinarySemaphore() override = default;
+
+    void signal() override;
+    bool wait(uint32_t maxTimeToWait_ms) override;
+    bool waitMicros(uint32_t maxTimeToWait_us) override;
+    bool pollReady() override;
+
+private:
+    bool waitFor(uint64_t timeout_ns);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+    bool                      signaled{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMBINARYSEMAPHORE_H
@@ -0,0 +1,53 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMCOUNTINGSEMAPHORE_H
+#define OSINTERFACE_OSINTERFACE_SIMCOUNTINGSEMAPHORE_H
+
+#include <cstdint>
+#include "OSInterface_CountingSemaphore.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Counting semaphore of the simulation backend
+ */
+class OSInterface_SimCountingSemaphore final : public OSInterface_CountingSemaphore
+{
+public:
+    /**
+     * @param scheduler Scheduler of the processes using the semaphore
+     * @param maxCount Maximum count, at least 1
+     * @param initialCount Count at creation, at most maxCount
+     */
+    OSInterface_SimCountingSemaphore(OSInterface_SimScheduler& scheduler, const uint32_t maxCount,
+                                     const uint32_t initialCount) :
+        scheduler(scheduler), maxCount(maxCount), count(initialCount)
+    {
+    }
+
+    OSInterface_SimCountingSemaphore(const OSInterface_SimCountingSemaphore&)            = delete;
+    OSInterface_SimCountingSemaphore& operator=(const OSInterface_SimCountingSemaphore&) = delete;
+    OSInterface_SimCountingSemaphore(OSInterface_SimCountingSemaphore&&)                 = delete;
+    OSInterface_SimCountingSemaphore& operator=(OSInterface_SimCountingSemaphore&&)      = delete;
+
+    ~OSInterface_SimCountingSemaphore() override = default;
+
+    bool     signal() override;
+    uint32_t signalN(uint32_t count) override;
+    bool     signalFromISR() override;
+    uint32_t signalNFromISR(uint32_t count) override;
+    bool     wait(uint32_t maxTimeToWait_ms) override;
+    bool     waitMicros(uint32_t maxTimeToWait_us) override;
+    bool     waitN(uint32_t count, uint32_t maxTimeToWait_ms) override;
+    bool     waitFromISR() override;
+    bool     waitNFromISR(uint32_t count) override;
+    uint32_t getCount() override;
+
+private:
+    bool tryTake(uint32_t taken);
+    bool take(uint32_t taken, uint64_t timeout_ns);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+    const uint32_t            maxCount;
+    uint32_t                  count;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMCOUNTINGSEMAPHORE_H
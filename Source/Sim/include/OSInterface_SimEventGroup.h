@@ -0,0 +1,41 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMEVENTGROUP_H
+#define OSINTERFACE_OSINTERFACE_SIMEVENTGROUP_H
+
+#include <cstdint>
+#include "OSInterface_EventGroup.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Event group of the simulation backend
+ */
+class OSInterface_SimEventGroup final : public OSInterface_EventGroup
+{
+public:
+    explicit OSInterface_SimEventGroup(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimEventGroup(const OSInterface_SimEventGroup&)            = delete;
+    OSInterface_SimEventGroup& operator=(const OSInterface_SimEventGroup&) = delete;
+    OSInterface_SimEventGroup(OSInterface_SimEventGroup&&)                 = delete;
+    OSInterface_SimEventGroup& operator=(OSInterface_SimEventGroup&&)      = delete;
+
+    ~OSInterface_SimEventGroup() override = default;
+
+    uint32_t setBits(uint32_t bits) override;
+    uint32_t setBitsFromISR(uint32_t bits) override;
+    uint32_t clearBits(uint32_t bits) override;
+    uint32_t clearBitsFromISR(uint32_t bits) override;
+    uint32_t getBits() override;
+    uint32_t waitBits(uint32_t bits, WaitMode mode, bool clearOnExit, uint32_t maxTimeToWait_ms) override;
+    uint32_t waitBitsMicros(uint32_t bits, WaitMode mode, bool clearOnExit, uint32_t maxTimeToWait_us) override;
+
+private:
+    uint32_t wait(uint32_t bits, WaitMode mode, bool clearOnExit, uint64_t timeout_ns);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+    uint32_t                  flags{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMEVENTGROUP_H
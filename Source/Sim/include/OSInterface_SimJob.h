@@ -0,0 +1,51 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMJOB_H
+#define OSINTERFACE_OSINTERFACE_SIMJOB_H
+
+#include <cstdint>
+#include "OSInterface.h"
+#include "OSInterface_Job.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Job of the simulation backend, run by a process of its own
+ *
+ * A simulated process costs no CPU while it is not running, so there is no point in a worker pool: every job gets a
+ * process, which also keeps the jobs that wait for each other from ever running out of workers.
+ */
+class OSInterface_SimJob final : public OSInterface_Job
+{
+public:
+    OSInterface_SimJob(OSInterface_SimScheduler& scheduler, OSInterfaceProcess job, void* arg) :
+        scheduler(scheduler), job(job), arg(arg)
+    {
+    }
+
+    OSInterface_SimJob(const OSInterface_SimJob&)            = delete;
+    OSInterface_SimJob& operator=(const OSInterface_SimJob&) = delete;
+    OSInterface_SimJob(OSInterface_SimJob&&)                 = delete;
+    OSInterface_SimJob& operator=(OSInterface_SimJob&&)      = delete;
+
+    ~OSInterface_SimJob() override;
+
+    /**
+     * @brief Start the process of the job
+     *
+     * @return true if the process was started, false otherwise
+     */
+    bool start();
+
+    bool               wait(uint32_t maxTimeToWait_ms) override;
+    [[nodiscard]] bool isDone() override;
+
+private:
+    static void run(void* arg);
+
+    OSInterface_SimScheduler& scheduler;
+    const OSInterfaceProcess  job;
+    void* const               arg;
+    OSInterface_SimWaitQueue  waiters;
+    bool                      started{false};
+    bool                      done{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMJOB_H
@@ -0,0 +1,72 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMMESSAGEBUFFER_H
+#define OSINTERFACE_OSINTERFACE_SIMMESSAGEBUFFER_H
+
+#include <cstdint>
+#include "OSInterface_MessageBuffer.h"
+#include "OSInterface_MessageRing.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Message buffer of the simulation backend
+ */
+class OSInterface_SimMessageBuffer final : public OSInterface_MessageBuffer
+{
+public:
+    /**
+     * @brief Create the buffer
+     *
+     * @param scheduler Scheduler of the processes using the buffer
+     * @param capacity Size of the ring in bytes, headers included
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_SimMessageBuffer(OSInterface_SimScheduler& scheduler, const uint32_t capacity) :
+        scheduler(scheduler), ring(capacity)
+    {
+    }
+
+    OSInterface_SimMessageBuffer(const OSInterface_SimMessageBuffer&)            = delete;
+    OSInterface_SimMessageBuffer& operator=(const OSInterface_SimMessageBuffer&) = delete;
+    OSInterface_SimMessageBuffer(OSInterface_SimMessageBuffer&&)                 = delete;
+    OSInterface_SimMessageBuffer& operator=(OSInterface_SimMessageBuffer&&)      = delete;
+
+    ~OSInterface_SimMessageBuffer() override = default;
+
+    /**
+     * @return true if the ring was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return ring.isValid();
+    }
+
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] uint32_t maxMessageLength() override;
+    [[nodiscard]] uint32_t nextLength() override;
+    [[nodiscard]] bool     isEmpty() override;
+    void                   reset() override;
+    bool                   send(const void* message, uint32_t length, uint32_t maxTimeToWait_ms) override;
+    bool                   sendFromISR(const void* message, uint32_t length) override;
+    uint32_t               receive(void* buffer, uint32_t bufferSize, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveFromISR(void* buffer, uint32_t bufferSize) override;
+    void*                  acquireSend(uint32_t length, uint32_t maxTimeToWait_ms) override;
+    void*                  acquireSendFromISR(uint32_t length) override;
+    void                   commitSend(void* message) override;
+    const void*            peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    const void*            peekReceiveFromISR(uint32_t& length) override;
+    void                   releaseReceive(const void* message) override;
+
+private:
+    static constexpr uint32_t TOO_LONG = UINT32_MAX; // tryReceive() result for a message longer than the buffer
+
+    bool        trySend(const void* message, uint32_t length);
+    uint32_t    tryReceive(void* buffer, uint32_t bufferSize);
+    const void* tryPeekReceive(uint32_t& length);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  notEmpty;
+    OSInterface_SimWaitQueue  notFull;
+    OSInterface_MessageRing   ring;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMMESSAGEBUFFER_H
@@ -0,0 +1,40 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMMUTEX_H
+#define OSINTERFACE_OSINTERFACE_SIMMUTEX_H
+
+#include <cstdint>
+#include "OSInterface_Mutex.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Mutex of the simulation backend
+ *
+ * Both modes behave the same, as a simulated process never spins. A released mutex goes to whichever process takes it
+ * first, not necessarily the one blocked the longest.
+ */
+class OSInterface_SimMutex final : public OSInterface_Mutex
+{
+public:
+    explicit OSInterface_SimMutex(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimMutex(const OSInterface_SimMutex&)            = delete;
+    OSInterface_SimMutex& operator=(const OSInterface_SimMutex&) = delete;
+    OSInterface_SimMutex(OSInterface_SimMutex&&)                 = delete;
+    OSInterface_SimMutex& operator=(OSInterface_SimMutex&&)      = delete;
+
+    ~OSInterface_SimMutex() override = default;
+
+    void signal() override;
+    bool wait(uint32_t maxTimeToWait_ms) override;
+    bool waitMicros(uint32_t maxTimeToWait_us) override;
+
+private:
+    bool waitFor(uint64_t timeout_ns);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+    bool                      locked{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMMUTEX_H
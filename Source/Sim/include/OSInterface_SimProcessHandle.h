@@ -0,0 +1,54 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMPROCESSHANDLE_H
+#define OSINTERFACE_OSINTERFACE_SIMPROCESSHANDLE_H
+
+#include <cstdint>
+#include <string>
+#include "OSInterface.h"
+#include "OSInterface_Process.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Join handle of a process of the simulation backend started with attributes
+ *
+ * Simulated processes run one at a time in an order chosen by the scheduler, so only the name of the attributes is
+ * used: CPU affinity, scheduling policy, priority and stack have no effect.
+ */
+class OSInterface_SimProcessHandle final : public OSInterface_Process
+{
+public:
+    OSInterface_SimProcessHandle(OSInterface_SimScheduler& scheduler, OSInterfaceProcess process, void* arg) :
+        scheduler(scheduler), process(process), arg(arg)
+    {
+    }
+
+    OSInterface_SimProcessHandle(const OSInterface_SimProcessHandle&)            = delete;
+    OSInterface_SimProcessHandle& operator=(const OSInterface_SimProcessHandle&) = delete;
+    OSInterface_SimProcessHandle(OSInterface_SimProcessHandle&&)                 = delete;
+    OSInterface_SimProcessHandle& operator=(OSInterface_SimProcessHandle&&)      = delete;
+
+    ~OSInterface_SimProcessHandle() override;
+
+    /**
+     * @brief Start the process
+     *
+     * @return true if the process was started, false otherwise
+     */
+    bool start(const OSInterface_ProcessAttributes& attributes);
+
+    void               join() override;
+    bool               join(uint32_t maxTimeToWait_ms) override;
+    [[nodiscard]] bool isDone() override;
+
+private:
+    static void run(void* arg);
+
+    OSInterface_SimScheduler& scheduler;
+    const OSInterfaceProcess  process;
+    void* const               arg;
+    std::string               name; // The scheduler keeps a pointer to it
+    OSInterface_SimWaitQueue  waiters;
+    bool                      started{false};
+    bool                      done{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMPROCESSHANDLE_H
@@ -0,0 +1,45 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMRWLOCK_H
+#define OSINTERFACE_OSINTERFACE_SIMRWLOCK_H
+
+#include <cstdint>
+#include "OSInterface_RWLock.h"
+#include "OSInterface_SimScheduler.h"
+
+/**
+ * @brief Reader-writer lock of the simulation backend
+ *
+ * New readers wait while a writer is waiting, so that writers are not starved.
+ */
+class OSInterface_SimRWLock final : public OSInterface_RWLock
+{
+public:
+    explicit OSInterface_SimRWLock(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimRWLock(const OSInterface_SimRWLock&)            = delete;
+    OSInterface_SimRWLock& operator=(const OSInterface_SimRWLock&) = delete;
+    OSInterface_SimRWLock(OSInterface_SimRWLock&&)                 = delete;
+    OSInterface_SimRWLock& operator=(OSInterface_SimRWLock&&)      = delete;
+
+    ~OSInterface_SimRWLock() override = default;
+
+    bool waitRead(uint32_t maxTimeToWait_ms) override;
+    bool waitReadMicros(uint32_t maxTimeToWait_us) override;
+    void signalRead() override;
+    bool waitWrite(uint32_t maxTimeToWait_ms) override;
+    bool waitWriteMicros(uint32_t maxTimeToWait_us) override;
+    void signalWrite() override;
+
+private:
+    bool readFor(uint64_t timeout_ns);
+    bool writeFor(uint64_t timeout_ns);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters; // Readers and writers
+    uint32_t                  readers{0};
+    uint32_t                  waitingWriters{0};
+    bool                      writer{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMRWLOCK_H
@@ -0,0 +1,295 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMSCHEDULER_H
+#define OSINTERFACE_OSINTERFACE_SIMSCHEDULER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "OSInterface.h"
+
+class OSInterface_SimProcess;
+
+/**
+ * @brief Processes blocked until another process wakes them up
+ */
+class OSInterface_SimWaitQueue
+{
+public:
+    OSInterface_SimWaitQueue() = default;
+
+    OSInterface_SimWaitQueue(const OSInterface_SimWaitQueue&)            = delete;
+    OSInterface_SimWaitQueue& operator=(const OSInterface_SimWaitQueue&) = delete;
+    OSInterface_SimWaitQueue(OSInterface_SimWaitQueue&&)                 = delete;
+    OSInterface_SimWaitQueue& operator=(OSInterface_SimWaitQueue&&)      = delete;
+
+    ~OSInterface_SimWaitQueue() = default;
+
+    /**
+     * @return true if no process is blocked on the queue, false otherwise
+     */
+    [[nodiscard]] bool isEmpty() const
+    {
+        return waiters.empty();
+    }
+
+private:
+    friend class OSInterface_SimScheduler;
+
+    std::deque<OSInterface_SimProcess*> waiters; // In blocking order
+};
+
+/**
+ * @brief Action run by the scheduler when the virtual time reaches a deadline
+ */
+class OSInterface_SimAlarm
+{
+public:
+    OSInterface_SimAlarm() = default;
+
+    OSInterface_SimAlarm(const OSInterface_SimAlarm&)            = delete;
+    OSInterface_SimAlarm& operator=(const OSInterface_SimAlarm&) = delete;
+    OSInterface_SimAlarm(OSInterface_SimAlarm&&)                 = delete;
+    OSInterface_SimAlarm& operator=(OSInterface_SimAlarm&&)      = delete;
+
+    /**
+     * @note The alarm must be cancelled before it is deleted.
+     */
+    virtual ~OSInterface_SimAlarm() = default;
+
+    /**
+     * @return true if the alarm is set, false otherwise
+     */
+    [[nodiscard]] bool isSet() const
+    {
+        return set;
+    }
+
+    /**
+     * @return uint64_t Virtual time in nanoseconds of the last deadline the alarm was set to
+     */
+    [[nodiscard]] uint64_t getDeadline() const
+    {
+        return deadline_ns;
+    }
+
+protected:
+    /**
+     * @brief Called once the virtual time reached the deadline, the alarm is no longer set
+     *
+     * @note Called from whichever process made the time advance. It must not block, but it can wake processes up and
+     * set alarms.
+     */
+    virtual void ring() = 0;
+
+private:
+    friend class OSInterface_SimScheduler;
+
+    bool     set{false};
+    uint64_t deadline_ns{0};
+    uint64_t sequence{0}; // Orders alarms set to the same deadline
+};
+
+/**
+ * @brief Thrown from blocking calls in the processes that are being terminated by the deletion of their scheduler
+ *
+ * @note Processes must let it propagate, catching it and going on only makes the next blocking call throw it again.
+ */
+struct OSInterface_SimTerminated
+{
+};
+
+/**
+ * @brief Deterministic scheduler of simulated processes running on a virtual clock
+ *
+ * Each process is a thread, but only one of them runs at any time: a process runs until it blocks (on a wait queue,
+ * a sleep or a yield), and the scheduler then picks the next one among the ready processes with a pseudo-random
+ * generator seeded at construction. When no process is ready, the virtual time jumps to the earliest deadline of the
+ * alarms and their actions run. A given seed therefore always produces the same interleaving and the same times, as
+ * long as the processes only synchronize and measure time through the scheduler.
+ *
+ * The thread that creates the scheduler becomes its first process, the driver: the processes it starts only run while
+ * it is blocked. If every process is blocked without a deadline, the blocking call of the driver fails as if it timed
+ * out and a deadlock is logged.
+ *
+ * @note The state of the scheduler, and of every object built on it, must only be used by its processes. Calls from
+ * other threads do not block, they behave as if their timeout was 0.
+ * @note The scheduler must be deleted by the driver. Deleting it terminates the other processes by throwing
+ * OSInterface_SimTerminated from their blocking calls.
+ */
+class OSInterface_SimScheduler
+{
+public:
+    static constexpr uint64_t FOREVER         = UINT64_MAX;
+    static constexpr uint64_t NANOS_PER_MICRO = 1000;
+    static constexpr uint64_t NANOS_PER_MILLI = 1000000;
+
+    /**
+     * @param seed Seed of the choices between ready processes
+     */
+    explicit OSInterface_SimScheduler(uint64_t seed);
+
+    OSInterface_SimScheduler(const OSInterface_SimScheduler&)            = delete;
+    OSInterface_SimScheduler& operator=(const OSInterface_SimScheduler&) = delete;
+    OSInterface_SimScheduler(OSInterface_SimScheduler&&)                 = delete;
+    OSInterface_SimScheduler& operator=(OSInterface_SimScheduler&&)      = delete;
+
+    ~OSInterface_SimScheduler();
+
+    /**
+     * @brief Terminate every process, as the destructor does, and refuse to spawn new ones
+     *
+     * @note Called by the driver, for instance to terminate the processes blocked on objects deleted before the
+     * scheduler.
+     */
+    void terminate();
+
+    /**
+     * @return uint64_t Virtual time in nanoseconds, 0 at construction
+     */
+    [[nodiscard]] uint64_t now() const
+    {
+        return now_ns;
+    }
+
+    /**
+     * @brief Convert a timeout of the OSInterface API to nanoseconds
+     *
+     * @return uint64_t The timeout in nanoseconds, FOREVER for UINT32_MAX. The longest timeout is what callers retry
+     * forever (as the RAII guards do), waiting forever instead lets the scheduler report the deadlocks.
+     */
+    static constexpr uint64_t timeoutFromMillis(const uint32_t timeout_ms)
+    {
+        return timeout_ms == UINT32_MAX ? FOREVER : timeout_ms * NANOS_PER_MILLI;
+    }
+
+    /**
+     * @return uint64_t Virtual time timeout_ns from now, FOREVER if it does not fit
+     */
+    [[nodiscard]] uint64_t deadlineAfter(const uint64_t timeout_ns) const
+    {
+        return timeout_ns >= FOREVER - now_ns ? FOREVER : now_ns + timeout_ns;
+    }
+
+    /**
+     * @return true if the calling thread is one of the processes of this scheduler, false otherwise
+     */
+    [[nodiscard]] bool isProcess() const;
+
+    /**
+     * @brief Start a process, it is ready but only runs once the caller blocks
+     *
+     * @param process Function of the process
+     * @param arg Argument to pass to the process
+     * @param name Name of the process, must outlive it (can be nullptr)
+     * @return true if the process was started, false if its thread could not be created
+     */
+    bool spawn(OSInterfaceProcess process, void* arg, const char* name);
+
+    /**
+     * @brief Block the calling process on a wait queue
+     *
+     * @param queue Queue to block on
+     * @param deadline_ns Virtual time at which to give up, FOREVER to never give up
+     * @return true if woken up by wakeOne() or wakeAll(), false if the deadline was reached
+     */
+    bool block(OSInterface_SimWaitQueue& queue, uint64_t deadline_ns);
+
+    /**
+     * @brief Block the calling process until predicate() returns true, calling it again every time it is woken up
+     *
+     * @param queue Queue the processes changing the outcome of the predicate wake up
+     * @param deadline_ns Virtual time at which to give up, FOREVER to never give up
+     * @param predicate Callable returning bool, which also takes what it waits for (a count, a message...)
+     * @return true if the predicate returned true, false if the deadline was reached first
+     */
+    template <typename Predicate> bool await(OSInterface_SimWaitQueue& queue, const uint64_t deadline_ns,
+                                             Predicate predicate)
+    {
+        while (!predicate())
+        {
+            if (!block(queue, deadline_ns))
+            {
+                return predicate();
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Block the calling process until a virtual time
+     */
+    void sleepUntil(uint64_t deadline_ns);
+
+    /**
+     * @brief Let the scheduler pick a process among the ready ones and the caller
+     */
+    void yield();
+
+    /**
+     * @brief Make the process blocked the longest on a queue ready
+     *
+     * @return true if a process was woken up, false if none was blocked
+     */
+    bool wakeOne(OSInterface_SimWaitQueue& queue);
+
+    /**
+     * @brief Make every process blocked on a queue ready
+     *
+     * @return uint32_t Number of processes woken up
+     */
+    uint32_t wakeAll(OSInterface_SimWaitQueue& queue);
+
+    /**
+     * @brief Set (or move) an alarm
+     *
+     * @param alarm Alarm to set
+     * @param deadline_ns Virtual time at which the alarm rings, at least now()
+     */
+    void setAlarm(OSInterface_SimAlarm& alarm, uint64_t deadline_ns);
+
+    /**
+     * @brief Cancel an alarm, if it is set
+     */
+    void cancelAlarm(OSInterface_SimAlarm& alarm);
+
+private:
+    friend class OSInterface_SimProcess;
+
+    using Process  = OSInterface_SimProcess;
+    using AlarmKey = std::pair<uint64_t, uint64_t>; // Deadline and sequence
+
+    static void processMain(OSInterface_SimScheduler* scheduler, Process* process);
+
+    [[nodiscard]] Process* caller() const;
+
+    Process* pickNext();
+    uint64_t random();
+    void     makeReady(Process& process, bool woken);
+    void     timeout(Process& process);
+    void     suspend(Process& self);
+    void     switchTo(Process* next, Process* self);
+    void     finish(Process& process);
+    void     reap();
+
+    // Guards current, only for the hand-over between threads. The rest of the state is only used by the running
+    // process, the hand-over orders its accesses.
+    std::mutex lock;
+    Process*   current{nullptr};
+
+    std::unique_ptr<Process>                  driver;
+    std::list<std::unique_ptr<Process>>       processes;
+    std::vector<Process*>                     ready;
+    std::map<AlarmKey, OSInterface_SimAlarm*> alarms;
+    uint64_t                                  alarmSequence{0};
+    uint64_t                                  now_ns{0};
+    uint64_t                                  randomState;
+    bool                                      terminating{false};
+    Process*                                  previousThreadProcess; // Of the driver thread, restored on deletion
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMSCHEDULER_H
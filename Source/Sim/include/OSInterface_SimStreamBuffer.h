@@ -0,0 +1,77 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMSTREAMBUFFER_H
+#define OSINTERFACE_OSINTERFACE_SIMSTREAMBUFFER_H
+
+#include <cstdint>
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_StreamBuffer.h"
+#include "OSInterface_StreamRing.h"
+
+/**
+ * @brief Stream buffer of the simulation backend
+ *
+ * Senders only wake the reader up once the stream reaches the trigger level.
+ */
+class OSInterface_SimStreamBuffer final : public OSInterface_StreamBuffer
+{
+public:
+    /**
+     * @brief Create the buffer
+     *
+     * @param scheduler Scheduler of the processes using the buffer
+     * @param capacity Size of the ring in bytes
+     * @param triggerLevel Number of bytes the stream must hold before a blocked receive returns, at most capacity
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_SimStreamBuffer(OSInterface_SimScheduler& scheduler, const uint32_t capacity,
+                                const uint32_t triggerLevel) :
+        scheduler(scheduler), ring(capacity), triggerLevel(triggerLevel == 0 ? 1 : triggerLevel)
+    {
+    }
+
+    OSInterface_SimStreamBuffer(const OSInterface_SimStreamBuffer&)            = delete;
+    OSInterface_SimStreamBuffer& operator=(const OSInterface_SimStreamBuffer&) = delete;
+    OSInterface_SimStreamBuffer(OSInterface_SimStreamBuffer&&)                 = delete;
+    OSInterface_SimStreamBuffer& operator=(OSInterface_SimStreamBuffer&&)      = delete;
+
+    ~OSInterface_SimStreamBuffer() override = default;
+
+    /**
+     * @return true if the ring was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return ring.isValid();
+    }
+
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t available() override;
+    bool                   setTriggerLevel(uint32_t triggerLevel) override;
+    void                   reset() override;
+    uint32_t               send(const void* data, uint32_t length, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendFromISR(const void* data, uint32_t length) override;
+    uint32_t               receive(void* buffer, uint32_t maxLength, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveFromISR(void* buffer, uint32_t maxLength) override;
+    void*                  acquireSend(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    void*                  acquireSendFromISR(uint32_t& length) override;
+    void                   commitSend(uint32_t written) override;
+    const void*            peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) override;
+    const void*            peekReceiveFromISR(uint32_t& length) override;
+    void                   releaseReceive(uint32_t consumed) override;
+
+private:
+    uint32_t    trySend(const void* data, uint32_t length);
+    uint32_t    tryReceive(void* buffer, uint32_t maxLength, bool triggeredOnly);
+    void*       tryAcquireSend(uint32_t& length);
+    const void* tryPeekReceive(uint32_t& length, bool triggeredOnly);
+    void        sent();
+    void        received(uint32_t count);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  notEmpty; // Woken up once the stream reaches the trigger level
+    OSInterface_SimWaitQueue  notFull;
+    OSInterface_StreamRing    ring;
+    uint32_t                  triggerLevel;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMSTREAMBUFFER_H
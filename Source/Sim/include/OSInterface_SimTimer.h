@@ -0,0 +1,138 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMTIMER_H
+#define OSINTERFACE_OSINTERFACE_SIMTIMER_H
+
+#include <cstdint>
+#include <deque>
+#include "OSInterface.h"
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_SimWaitSet.h"
+#include "OSInterface_Timer.h"
+
+class OSInterface_SimTimerService;
+
+/**
+ * @brief Timer of the simulation backend, its callback runs on the process of an OSInterface_SimTimerService
+ *
+ * The timer is an alarm of the scheduler, so it expires exactly on time in virtual time. As a wait set member, the
+ * timer is ready from an expiration until a wait on the set reports it.
+ *
+ * @note Deleting the timer does not wait for its callback, which may be blocked. The callback must not use the timer
+ * once it could have been deleted.
+ */
+class OSInterface_SimTimer final : public OSInterface_Timer, public OSInterface_SimWaitable, public OSInterface_SimAlarm
+{
+public:
+    OSInterface_SimTimer(OSInterface_SimTimerService& service, uint32_t period, Mode mode, OSInterfaceProcess callback,
+                         void* callbackArg, const char* timerName);
+
+    OSInterface_SimTimer(const OSInterface_SimTimer&)            = delete;
+    OSInterface_SimTimer& operator=(const OSInterface_SimTimer&) = delete;
+    OSInterface_SimTimer(OSInterface_SimTimer&&)                 = delete;
+    OSInterface_SimTimer& operator=(OSInterface_SimTimer&&)      = delete;
+
+    ~OSInterface_SimTimer() override;
+
+    bool start() override;
+    bool startFromISR() override;
+    bool stop() override;
+    bool stopFromISR() override;
+    [[nodiscard]] bool isRunning() const override;
+    bool setPeriod(uint32_t newPeriod_ms) override;
+    bool setPeriodFromISR(uint32_t newPeriod_ms) override;
+    [[nodiscard]] uint32_t getPeriod() const override;
+    [[nodiscard]] Mode     getMode() const override;
+    [[nodiscard]] uint32_t getTimeout() const override;
+    [[nodiscard]] uint32_t getTimeoutTime() const override;
+    [[nodiscard]] uint64_t getTimeoutTime64() const override;
+    bool                   pollReady() override;
+
+    /**
+     * @return const char* Name given at creation time (can be nullptr)
+     */
+    [[nodiscard]] const char* getName() const;
+
+protected:
+    void ring() override;
+
+private:
+    friend class OSInterface_SimTimerService;
+
+    void expire();
+
+    OSInterface_SimTimerService& service;
+    const Mode                   mode;
+    const OSInterfaceProcess     callback;
+    void* const                  callbackArg;
+    const char* const            name;
+    uint32_t                     period_ms;
+    uint64_t                     expiry_ns{0};
+    bool                         expired{false}; // Not yet reported to the wait set
+    bool                         due{false};     // In the list of the service
+};
+
+/**
+ * @brief Process running the callbacks of every OSInterface_SimTimer of an OSInterface_Sim instance
+ *
+ * Timers that ring are appended to a list, which the process empties in order. Callbacks run one at a time, so
+ * periodic callbacks never overlap. A periodic timer is re-armed when it rings, one period after its previous
+ * deadline, so a late callback does not shift the following expirations.
+ *
+ * @note The process is started by the first timer that is armed.
+ * @note A running periodic timer always has a pending alarm, so the virtual time keeps advancing while every other
+ * process is blocked without a timeout: such a deadlock is not detected.
+ */
+class OSInterface_SimTimerService
+{
+public:
+    explicit OSInterface_SimTimerService(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimTimerService(const OSInterface_SimTimerService&)            = delete;
+    OSInterface_SimTimerService& operator=(const OSInterface_SimTimerService&) = delete;
+    OSInterface_SimTimerService(OSInterface_SimTimerService&&)                 = delete;
+    OSInterface_SimTimerService& operator=(OSInterface_SimTimerService&&)      = delete;
+
+    /**
+     * @note Every timer must be deleted, and the process terminated (OSInterface_SimScheduler::terminate() or deleting
+     * the scheduler), before the service.
+     */
+    ~OSInterface_SimTimerService() = default;
+
+    /**
+     * @return OSInterface_SimScheduler& Scheduler of the timers
+     */
+    OSInterface_SimScheduler& getScheduler()
+    {
+        return scheduler;
+    }
+
+    /**
+     * @brief (Re)arm a timer so that it expires one period from now
+     *
+     * @param timer Timer to arm
+     * @return true if the timer was armed, false if the process could not be started
+     */
+    bool arm(OSInterface_SimTimer& timer);
+
+    /**
+     * @brief Disarm a timer, dropping its pending callback if it already rang
+     *
+     * @param timer Timer to disarm
+     */
+    void disarm(OSInterface_SimTimer& timer);
+
+private:
+    friend class OSInterface_SimTimer;
+
+    static void run(void* arg);
+
+    void post(OSInterface_SimTimer& timer);
+
+    OSInterface_SimScheduler&         scheduler;
+    OSInterface_SimWaitQueue          wake;
+    std::deque<OSInterface_SimTimer*> dueTimers;
+    bool                              started{false};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMTIMER_H
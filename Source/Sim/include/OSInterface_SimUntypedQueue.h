@@ -0,0 +1,108 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMUNTYPEDQUEUE_H
+#define OSINTERFACE_OSINTERFACE_SIMUNTYPEDQUEUE_H
+
+#include <cstdint>
+#include <memory>
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_SimWaitSet.h"
+#include "OSInterface_UntypedQueue.h"
+
+/**
+ * @brief Bounded ring-buffer queue of the simulation backend
+ *
+ * Every slot carries a state so that slots handed out by the zero-copy API keep their place in the ring while a
+ * process writes or reads them. Every access pattern is served by this queue.
+ */
+class OSInterface_SimUntypedQueue final : public OSInterface_UntypedQueue, public OSInterface_SimWaitable
+{
+public:
+    /**
+     * @brief Create the queue
+     *
+     * @param scheduler Scheduler of the processes using the queue
+     * @param maxMessages Maximum number of messages in the queue
+     * @param messageSize Size of each message in bytes
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_SimUntypedQueue(OSInterface_SimScheduler& scheduler, uint32_t maxMessages, uint32_t messageSize);
+
+    OSInterface_SimUntypedQueue(const OSInterface_SimUntypedQueue&)            = delete;
+    OSInterface_SimUntypedQueue& operator=(const OSInterface_SimUntypedQueue&) = delete;
+    OSInterface_SimUntypedQueue(OSInterface_SimUntypedQueue&&)                 = delete;
+    OSInterface_SimUntypedQueue& operator=(OSInterface_SimUntypedQueue&&)      = delete;
+
+    ~OSInterface_SimUntypedQueue() override = default;
+
+    /**
+     * @return true if the queue storage was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    [[nodiscard]] uint32_t length() override;
+    [[nodiscard]] uint32_t size() override;
+    [[nodiscard]] uint32_t available() override;
+    [[nodiscard]] bool     isEmpty() override;
+    [[nodiscard]] bool     isFull() override;
+    void                   reset() override;
+    bool                   receive(void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   receiveMicros(void* message, uint32_t maxTimeToWait_us) override;
+    bool                   receiveFromISR(void* message) override;
+    bool                   sendToBack(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToBackMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToBackFromISR(const void* message) override;
+    bool                   sendToFront(const void* message, uint32_t maxTimeToWait_ms) override;
+    bool                   sendToFrontMicros(const void* message, uint32_t maxTimeToWait_us) override;
+    bool                   sendToFrontFromISR(const void* message) override;
+    void*                  acquireSendSlot(uint32_t maxTimeToWait_ms) override;
+    void                   commitSend(void* slot) override;
+    const void*            peekReceiveSlot(uint32_t maxTimeToWait_ms) override;
+    void                   releaseReceive(const void* slot) override;
+    uint32_t               sendToBackN(const void* messages, uint32_t count, uint32_t maxTimeToWait_ms) override;
+    uint32_t               sendToBackNFromISR(const void* messages, uint32_t count) override;
+    uint32_t               receiveN(void* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms) override;
+    uint32_t               receiveNFromISR(void* messages, uint32_t maxMessages) override;
+    uint32_t               drain(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    uint32_t               drainFromISR(OSInterfaceQueueDrainCallback callback, void* arg) override;
+    bool                   pollReady() override;
+
+private:
+    using SlotState = enum : uint8_t {
+        FREE,      // Not in the queue
+        WRITING,   // Reserved by acquireSendSlot(), not committed yet
+        READY,     // Holds a message
+        READING,   // Taken by peekReceiveSlot() or drain(), not released yet
+        DISCARDED, // Removed by reset() while an earlier slot was still being written
+    };
+
+    [[nodiscard]] uint8_t* slotAddress(uint32_t slot) const;
+    [[nodiscard]] uint32_t slotIndex(const void* address) const;
+    [[nodiscard]] uint32_t next(uint32_t slot) const;
+
+    void     skipDiscarded();
+    uint8_t* tryTake(SlotState newState);
+    uint8_t* tryPut(SlotState newState, bool toFront);
+    void     setState(const void* address, SlotState newState);
+    bool     tryReceive(void* message);
+    bool     trySend(const void* message, bool toFront);
+    bool     receiveFor(void* message, uint64_t timeout_ns);
+    bool     send(const void* message, uint64_t timeout_ns, bool toFront);
+    uint32_t tryReceiveN(void* messages, uint32_t count);
+    uint32_t trySendN(const void* messages, uint32_t count);
+    void     messagesAdded(uint32_t count);
+    void     slotsFreed(uint32_t count);
+
+    OSInterface_SimScheduler&  scheduler;
+    const uint32_t             maxMessages;
+    const uint32_t             messageSize;
+    std::unique_ptr<uint8_t[]> storage;
+    std::unique_ptr<uint8_t[]> states;
+    OSInterface_SimWaitQueue   notEmpty;
+    OSInterface_SimWaitQueue   notFull;
+    uint32_t                   head{0};    // Next slot to receive
+    uint32_t                   tail{0};    // Next slot to send to the back
+    uint32_t                   pending{0}; // Slots from head to tail
+    uint32_t                   ready{0};   // Slots in the READY state
+    uint32_t                   used{0};    // Slots not in the FREE state
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMUNTYPEDQUEUE_H
@@ -0,0 +1,120 @@
+#ifndef OSINTERFACE_OSINTERFACE_SIMWAITSET_H
+#define OSINTERFACE_OSINTERFACE_SIMWAITSET_H
+
+#include <cstdint>
+#include <vector>
+#include "OSInterface_SimScheduler.h"
+#include "OSInterface_WaitSet.h"
+
+class OSInterface_SimWaitSet;
+
+/**
+ * @brief Base of the simulation objects that can be members of an OSInterface_SimWaitSet
+ *
+ * Objects call notifyWaitSet() whenever they may have become ready.
+ */
+class OSInterface_SimWaitable
+{
+public:
+    OSInterface_SimWaitable() = default;
+
+    OSInterface_SimWaitable(const OSInterface_SimWaitable&)            = delete;
+    OSInterface_SimWaitable& operator=(const OSInterface_SimWaitable&) = delete;
+    OSInterface_SimWaitable(OSInterface_SimWaitable&&)                 = delete;
+    OSInterface_SimWaitable& operator=(OSInterface_SimWaitable&&)      = delete;
+
+    virtual ~OSInterface_SimWaitable() = default;
+
+    /**
+     * @brief Check whether the object is ready
+     *
+     * @return true if the object is ready, false otherwise
+     * @note Edge-triggered objects (timers) clear their ready state when it is reported.
+     */
+    virtual bool pollReady() = 0;
+
+    /**
+     * @brief Make the object a member of a wait set
+     *
+     * @param set Wait set to notify from now on
+     * @return true if attached, false if the object already belongs to a wait set
+     */
+    bool attach(OSInterface_SimWaitSet& set);
+
+    /**
+     * @brief Stop notifying the wait set of the object
+     */
+    void detach();
+
+protected:
+    /**
+     * @brief Wake up the processes waiting on the wait set of the object, if any
+     */
+    void notifyWaitSet();
+
+    /**
+     * @return true if the object is a member of a wait set, false otherwise
+     */
+    [[nodiscard]] bool isInWaitSet() const
+    {
+        return waitSet != nullptr;
+    }
+
+private:
+    OSInterface_SimWaitSet* waitSet{nullptr};
+};
+
+/**
+ * @brief Wait set of the simulation backend
+ *
+ * Members wake up the processes waiting on the set, which then poll every member. Polling starts after the last
+ * reported member so that a busy member cannot starve the others.
+ */
+class OSInterface_SimWaitSet final : public OSInterface_WaitSet
+{
+public:
+    explicit OSInterface_SimWaitSet(OSInterface_SimScheduler& scheduler) : scheduler(scheduler)
+    {
+    }
+
+    OSInterface_SimWaitSet(const OSInterface_SimWaitSet&)            = delete;
+    OSInterface_SimWaitSet& operator=(const OSInterface_SimWaitSet&) = delete;
+    OSInterface_SimWaitSet(OSInterface_SimWaitSet&&)                 = delete;
+    OSInterface_SimWaitSet& operator=(OSInterface_SimWaitSet&&)      = delete;
+
+    ~OSInterface_SimWaitSet() override;
+
+    bool     add(OSInterface_UntypedQueue* queue) override;
+    bool     add(OSInterface_BinarySemaphore* semaphore) override;
+    bool     add(OSInterface_Timer* timer) override;
+    bool     remove(OSInterface_UntypedQueue* queue) override;
+    bool     remove(OSInterface_BinarySemaphore* semaphore) override;
+    bool     remove(OSInterface_Timer* timer) override;
+    uint32_t wait(const void** readyMembers, uint32_t maxMembers, uint32_t maxTimeToWait_ms) override;
+
+    /**
+     * @brief Wake up the processes waiting on the set so that they poll the members again
+     */
+    void notify()
+    {
+        scheduler.wakeAll(waiters);
+    }
+
+private:
+    struct Member
+    {
+        const void*              handle; // Pointer given to add()
+        OSInterface_SimWaitable* waitable;
+    };
+
+    bool     addMember(const void* handle, OSInterface_SimWaitable* waitable);
+    bool     removeMember(const void* handle);
+    uint32_t poll(const void** readyMembers, uint32_t maxMembers);
+
+    OSInterface_SimScheduler& scheduler;
+    OSInterface_SimWaitQueue  waiters;
+    std::vector<Member>       members;
+    size_t                    nextMember{0}; // Member polled first by the next wait()
+};
+
+#endif // OSINTERFACE_OSINTERFACE_SIMWAITSET_H
@@ -4,10 +4,20 @@
 #include <cassert>
 #include <cstdint>
 #include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_CountingSemaphore.h"
+#include "OSInterface_EventGroup.h"
+#include "OSInterface_Job.h"
 #include "OSInterface_Log.h"
+#include "OSInterface_MemoryStats.h"
+#include "OSInterface_MessageBuffer.h"
 #include "OSInterface_Mutex.h"
+#include "OSInterface_Process.h"
+#include "OSInterface_RWLock.h"
+#include "OSInterface_StreamBuffer.h"
 #include "OSInterface_Timer.h"
+#include "OSInterface_UntypedPriorityQueue.h"
 #include "OSInterface_UntypedQueue.h"
+#include "OSInterface_WaitSet.h"
 
 #ifdef NDEBUG
     #define ASSERT_SAFE(expression, condition) expression
@@ -34,6 +44,42 @@ public:
      */
     virtual uint32_t osMillis() = 0;
 
+    /**
+     * @brief Sleep for a given number of microseconds
+     *
+     * @param us Number of microseconds to sleep
+     * @note The actual resolution depends on the implementation, the sleep is never shorter than requested.
+     */
+    virtual void osSleepMicros(uint32_t us) = 0;
+
+    /**
+     * @brief Get the current time in milliseconds, without wrapping around
+     *
+     * @return uint64_t Current time in milliseconds, on the same time base as osMillis()
+     */
+    virtual uint64_t osMillis64() = 0;
+
+    /**
+     * @brief Get the current time in microseconds, without wrapping around
+     *
+     * @return uint64_t Current time in microseconds, on the same time base as osMillis()
+     */
+    virtual uint64_t osMicros64() = 0;
+
+    /**
+     * @brief Get the value of the cheapest monotonic counter available, for instance to measure short durations
+     *
+     * @return uint64_t Current counter value, in ticks of osTicksPerSecond() per second
+     */
+    virtual uint64_t osTicks() = 0;
+
+    /**
+     * @brief Get the frequency of the osTicks() counter
+     *
+     * @return uint64_t Number of ticks per second
+     */
+    virtual uint64_t osTicksPerSecond() = 0;
+
     /**
      * @brief Create a mutex
      *
@@ -44,6 +90,28 @@ public:
      */
     virtual OSInterface_Mutex* osCreateMutex() = 0;
 
+    /**
+     * @brief Create a mutex of a given mode
+     *
+     * @param mode BLOCKING for the same mutex as osCreateMutex(), ADAPTIVE to spin briefly before sleeping
+     * @return OSInterface_Mutex* Pointer to the created mutex
+     * @note The mutex is created in the unlocked state.
+     * @note The mutex needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     * @note Implementations without an adaptive mutex return a blocking one.
+     */
+    virtual OSInterface_Mutex* osCreateMutex(OSInterface_Mutex::Mode mode) = 0;
+
+    /**
+     * @brief Create a reader-writer lock
+     *
+     * @return OSInterface_RWLock* Pointer to the created lock
+     * @note The lock is created unlocked.
+     * @note The lock needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_RWLock* osCreateRWLock() = 0;
+
     /**
      * @brief Create a binary semaphore
      *
@@ -54,6 +122,27 @@ public:
      */
     virtual OSInterface_BinarySemaphore* osCreateBinarySemaphore() = 0;
 
+    /**
+     * @brief Create a counting semaphore
+     *
+     * @param maxCount Maximum count of the semaphore, at least 1
+     * @param initialCount Count of the semaphore at creation, at most maxCount
+     * @return OSInterface_CountingSemaphore* Pointer to the created counting semaphore
+     * @note The semaphore needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_CountingSemaphore* osCreateCountingSemaphore(uint32_t maxCount, uint32_t initialCount) = 0;
+
+    /**
+     * @brief Create an event group
+     *
+     * @return OSInterface_EventGroup* Pointer to the created event group
+     * @note The event group is created with every flag cleared.
+     * @note The event group needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_EventGroup* osCreateEventGroup() = 0;
+
     /**
      * @brief Create a timer
      *
@@ -92,12 +181,74 @@ public:
      */
     virtual OSInterface_UntypedQueue* osCreateUntypedQueue(uint32_t maxMessages, uint32_t messageSize) = 0;
 
+    /**
+     * @brief Create an inter-thread, untyped message queue for a guaranteed producer/consumer pattern. To use typed
+     * messages, use OSInterface::OSInterface_Queue<T>.
+     *
+     * @param maxMessages Maximum number of messages in the queue
+     * @param messageSize Size of each message in bytes
+     * @param accessPattern Producer/consumer pattern the caller guarantees for the lifetime of the queue
+     * @return OSInterface_UntypedQueue* Pointer to the created queue
+     * @note The queue needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     * @note The implementation may return a lock-free queue that relies on the pattern being respected. Such queues
+     * may not support sendToFront() and sendToFrontFromISR().
+     */
+    virtual OSInterface_UntypedQueue* osCreateUntypedQueue(uint32_t maxMessages, uint32_t messageSize,
+                                                           OSInterface_UntypedQueue::AccessPattern accessPattern) = 0;
+
+    /**
+     * @brief Create an inter-thread, untyped message queue whose receivers get the most urgent messages first. To use
+     * typed messages, use OSInterface::OSInterface_PriorityQueue<T>.
+     *
+     * @param maxMessages Maximum number of messages of each priority
+     * @param messageSize Size of each message in bytes
+     * @param priorityLevels Number of priority levels, from 1 to OSInterface_UntypedPriorityQueue::MAX_PRIORITY_LEVELS
+     * @return OSInterface_UntypedPriorityQueue* Pointer to the created queue
+     * @note The queue needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_UntypedPriorityQueue* osCreatePriorityQueue(uint32_t maxMessages, uint32_t messageSize,
+                                                                    uint32_t priorityLevels) = 0;
+
+    /**
+     * @brief Create a thread-safe buffer of variable-length messages
+     *
+     * @param capacity Size of the buffer in bytes, shared by the messages and their 8-byte headers
+     * @return OSInterface_MessageBuffer* Pointer to the created buffer
+     * @note The buffer needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_MessageBuffer* osCreateMessageBuffer(uint32_t capacity) = 0;
+
+    /**
+     * @brief Create a byte stream buffer between one writer and one reader
+     *
+     * @param capacity Size of the buffer in bytes
+     * @param triggerLevel Number of bytes the stream must hold before a blocked receive returns, from 1 to capacity
+     * @return OSInterface_StreamBuffer* Pointer to the created buffer
+     * @note The buffer needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_StreamBuffer* osCreateStreamBuffer(uint32_t capacity, uint32_t triggerLevel) = 0;
+
+    /**
+     * @brief Create a wait set to wait on several queues, semaphores and timers at once
+     *
+     * @return OSInterface_WaitSet* Pointer to the created wait set
+     * @note The wait set is created empty.
+     * @note The wait set needs to be freed with delete.
+     * @note If there are any errors during the creation, nullptr is returned.
+     */
+    virtual OSInterface_WaitSet* osCreateWaitSet() = 0;
+
     /**
      * @brief Allocate memory
      *
      * @param size Size of the memory to allocate
      * @return Void* Pointer to the allocated memory
      * @note If the size is 0, the function will return a null pointer.
+     * @note The memory is suitably aligned for any fundamental type.
      */
     virtual void* osMalloc(uint32_t size) = 0;
 
@@ -109,6 +260,13 @@ public:
      */
     virtual void osFree(void* ptr) = 0;
 
+    /**
+     * @brief Get the statistics of the allocator behind osMalloc() and osFree()
+     *
+     * @param stats Filled with the current statistics
+     */
+    virtual void osGetMemoryStats(OSInterface_MemoryStats& stats) = 0;
+
     /**
      * @brief Run a process in a separate thread
      *
@@ -128,11 +286,42 @@ public:
      */
     virtual void osRunProcess(OSInterfaceProcess process, const char* processName, void* arg) = 0;
 
+    /**
+     * @brief Run a process in a separate thread, placed and scheduled as requested
+     *
+     * @param process Process to run
+     * @param arg Argument to pass to the process
+     * @param attributes CPU affinity, scheduling and stack of the process
+     * @return OSInterface_Process* Handle to join the process
+     * @note The handle needs to be freed with delete, which waits for the process to return.
+     * @note If the process cannot be started as requested (no permission for a real-time policy, a stack that cannot be
+     * locked, a CPU that does not exist...), the error is logged, nullptr is returned and the process is not run.
+     */
+    virtual OSInterface_Process* osRunProcess(OSInterfaceProcess process, void* arg,
+                                              const OSInterface_ProcessAttributes& attributes) = 0;
+
+    /**
+     * @brief Run a short job on a pool of worker threads shared by every job
+     *
+     * @param job Function to run
+     * @param arg Argument to pass to the job
+     * @return OSInterface_Job* Handle to wait for the job to complete
+     * @note The handle needs to be freed with delete, which waits for the job to complete.
+     * @note If there are any errors during the submission, nullptr is returned and the job is not run.
+     * @note Jobs should not block for long, as they hold a worker for their whole duration. Use osRunProcess() for
+     * long-lived processes.
+     */
+    virtual OSInterface_Job* osSubmit(OSInterfaceProcess job, void* arg) = 0;
+
     virtual ~OSInterface() = default;
 
-    template <typename T> class OSInterface_Queue;
+    template <typename T, typename Backend = OSInterface, typename Untyped = void> class OSInterface_Queue;
+    template <typename T, typename Backend = OSInterface> class OSInterface_PriorityQueue;
+    template <typename T> class OSInterface_ObjectPool;
 };
 
+#include "OSInterface_ObjectPool.h"
+#include "OSInterface_PriorityQueue.h"
 #include "OSInterface_Queue.h"
 
 #endif // OSInterface_h
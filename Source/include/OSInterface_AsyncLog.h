@@ -0,0 +1,250 @@
+#ifndef OSINTERFACE_OSINTERFACE_ASYNCLOG_H
+#define OSINTERFACE_OSINTERFACE_ASYNCLOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @brief Formats the tag and arguments of a record, instantiated for each list of argument types
+ */
+using OSInterfaceLogFormatter = int (*)(char* buffer, size_t size, const char* format, const char* tag,
+                                        const uint8_t* arguments);
+
+/**
+ * @brief Log record handed to an OSInterface_LogSink
+ *
+ * Arguments are packed back to back without padding, in the order of the format string. The signature holds one type
+ * code per argument: b/B, h/H, i/I and q/Q for signed/unsigned integers of 1, 2, 4 and 8 bytes, ? for bool, f, d and g
+ * for float, double and long double, P for pointers and s for NUL-terminated strings.
+ */
+struct OSInterface_LogRecord
+{
+    uint64_t                timestamp_ns; // std::chrono::steady_clock, CLOCK_MONOTONIC on Linux
+    uint8_t                 level;        // OSInterfaceLogLevel
+    const char*             tag;
+    const char*             format;       // printf format expecting the tag as first argument
+    const char*             signature;    // Type codes of the arguments, after the tag
+    const uint8_t*          arguments;
+    uint32_t                argumentsSize;
+    OSInterfaceLogFormatter formatter;
+
+    /**
+     * @brief Format the record as text, as snprintf does
+     */
+    int toText(char* buffer, const size_t size) const
+    {
+        return formatter(buffer, size, format, tag, arguments);
+    }
+};
+
+/**
+ * @brief Destination of the records drained by OSInterface_AsyncLog, in place of stdout
+ */
+class OSInterface_LogSink
+{
+public:
+    virtual ~OSInterface_LogSink() = default;
+
+    /**
+     * @brief Write a record
+     *
+     * @param record Record to write, only valid during the call
+     * @note Called by the drain thread, records of all threads come in timestamp order.
+     */
+    virtual void write(const OSInterface_LogRecord& record) = 0;
+
+    /**
+     * @brief Called after each batch of records
+     */
+    virtual void flush() = 0;
+};
+
+/**
+ * @brief Deferred-formatting logger behind the OSInterfaceLog macros when OSInterface_ASYNC_LOG is defined
+ *
+ * A log call only copies a timestamp, the format string pointer and its arguments into a ring buffer owned by the
+ * calling thread, without locking or entering the kernel. A background thread formats the records of every thread in
+ * timestamp order and writes them to stdout in large batches, or hands them to the sink given to setSink(). When the
+ * ring of a thread is full, its records are dropped and counted instead of blocking the thread, and the drain thread
+ * reports how many were dropped.
+ *
+ * @note Format strings and tags must be string literals. Arguments are copied by value, except char pointers which are
+ * always treated as strings and copied with their characters, so %s works with temporary buffers.
+ */
+class OSInterface_AsyncLog
+{
+public:
+    /**
+     * @brief Queue a log record
+     *
+     * @param level Level of the record
+     * @param tag Tag of the record, passed to the format as its first argument
+     * @param format printf format string, must outlive the program (string literal)
+     * @param args Arguments of the format string after the tag
+     */
+    template <typename... Args>
+    static void write(const uint8_t level, const char* tag, const char* format, const Args&... args)
+    {
+        const size_t size = (static_cast<size_t>(0) + ... + encodedSize(args));
+        uint8_t*     data = reserve(size);
+        if (data == nullptr)
+        {
+            return; // Dropped and counted
+        }
+        [[maybe_unused]] uint8_t* position = data; // Unused without arguments
+        (encode(position, args), ...);
+        commit(data, level, tag, format, signature<std::decay_t<Args>...>, &formatArguments<std::decay_t<Args>...>);
+    }
+
+    /**
+     * @brief Wait until every record queued before the call has been written
+     */
+    static void flush();
+
+    /**
+     * @brief Get the number of records dropped because the ring of their thread was full
+     *
+     * @return uint64_t Records dropped since the program started
+     */
+    static uint64_t droppedRecords();
+
+    /**
+     * @brief Send the records to a sink instead of stdout
+     *
+     * @param sink Sink to write to, nullptr to write to stdout again
+     * @note Once this returns the previous sink is no longer used and can be deleted.
+     */
+    static void setSink(OSInterface_LogSink* sink);
+
+private:
+    template <typename T>
+    static constexpr bool isString = std::is_same_v<T, char*> || std::is_same_v<T, const char*>;
+
+    // Strings are decoded as pointers into the record
+    template <typename T> using Decoded = std::conditional_t<isString<T>, const char*, T>;
+
+    template <typename T> static constexpr char typeCode()
+    {
+        if constexpr (isString<T>)
+        {
+            return 's';
+        }
+        else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>)
+        {
+            return 'P';
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return typeCode<std::underlying_type_t<T>>();
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            return '?';
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return sizeof(T) == sizeof(float) ? 'f' : sizeof(T) == sizeof(double) ? 'd' : 'g';
+        }
+        else
+        {
+            static_assert(std::is_integral_v<T> && sizeof(T) <= 8, "Log arguments must be printf arguments");
+            constexpr char codes[2][4] = {{'B', 'H', 'I', 'Q'}, {'b', 'h', 'i', 'q'}};
+            return codes[std::is_signed_v<T>][sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3];
+        }
+    }
+
+    template <typename... Args> static constexpr char signature[] = {typeCode<Args>()..., '\0'};
+
+    template <typename T> static size_t encodedSize(const T& arg)
+    {
+        using Stored = std::decay_t<T>;
+        static_assert(std::is_trivially_copyable_v<Stored>, "Log arguments must be printf arguments");
+        if constexpr (isString<Stored>)
+        {
+            return strlen(stringOf(arg)) + 1;
+        }
+        else
+        {
+            return sizeof(Stored);
+        }
+    }
+
+    template <typename T> static void encode(uint8_t*& position, const T& arg)
+    {
+        using Stored = std::decay_t<T>;
+        if constexpr (isString<Stored>)
+        {
+            const char*  string = stringOf(arg);
+            const size_t length = strlen(string) + 1;
+            memcpy(position, string, length);
+            position += length;
+        }
+        else
+        {
+            const Stored value = arg;
+            memcpy(position, &value, sizeof(value));
+            position += sizeof(value);
+        }
+    }
+
+    template <typename T> static T decode(const uint8_t*& position)
+    {
+        if constexpr (isString<T>)
+        {
+            const auto* string = reinterpret_cast<const char*>(position);
+            position += strlen(string) + 1;
+            return string;
+        }
+        else
+        {
+            T value;
+            memcpy(&value, position, sizeof(value));
+            position += sizeof(value);
+            return value;
+        }
+    }
+
+    static const char* stringOf(const char* string)
+    {
+        return string != nullptr ? string : "(null)";
+    }
+
+// The macros check the format against the arguments at the call site
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+    template <typename... Args>
+    static int formatArguments(char* buffer, const size_t size, const char* format, const char* tag,
+                               [[maybe_unused]] const uint8_t* arguments) // Unused without arguments
+    {
+        // A braced list evaluates the decoders from left to right
+        const std::tuple<Decoded<Args>...> values{decode<Decoded<Args>>(arguments)...};
+        return std::apply([buffer, size, format, tag](const auto&... args)
+                          { return snprintf(buffer, size, format, tag, args...); },
+                          values);
+    }
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+    /**
+     * @brief Reserve space for a record in the ring of the calling thread
+     *
+     * @param size Bytes of encoded arguments
+     * @return uint8_t* Where to encode the arguments, nullptr if the record was dropped
+     */
+    static uint8_t* reserve(size_t size);
+
+    /**
+     * @brief Publish the record reserved last by the calling thread
+     */
+    static void commit(uint8_t* arguments, uint8_t level, const char* tag, const char* format, const char* signature,
+                       OSInterfaceLogFormatter formatter);
+};
+
+#endif // OSINTERFACE_OSINTERFACE_ASYNCLOG_H
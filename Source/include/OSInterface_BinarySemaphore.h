@@ -26,6 +26,27 @@ public:
      * @return True if the semaphore was acquired, false if the timeout was reached.
      */
     virtual bool wait(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait for the semaphore to be available, with a timeout in microseconds
+     *
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return True if the semaphore was acquired, false if the timeout was reached.
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool waitMicros(const uint32_t maxTimeToWait_us)
+    {
+        return wait(maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+    /**
+     * @brief Name the semaphore in the instrumentation reports
+     *
+     * @param name Name of the semaphore, must outlive it (string literal)
+     * @note Does nothing unless the implementation is instrumented (OSInterface_INSTRUMENTATION).
+     */
+    virtual void setName(const char* /*name*/)
+    {
+    }
 };
 
 #endif // OSINTERFACE_OSINTERFACE_BINARYSEMAPHORE_H
@@ -0,0 +1,96 @@
+#ifndef OSINTERFACE_OSINTERFACE_COUNTINGSEMAPHORE_H
+#define OSINTERFACE_OSINTERFACE_COUNTINGSEMAPHORE_H
+
+#include <cstdint>
+
+/**
+ * @brief Semaphore counting available resources, from 0 up to a maximum count given at creation
+ *
+ * The N variants signal or take several counts in a single operation, instead of one call (and possibly one wake-up)
+ * per count.
+ */
+class OSInterface_CountingSemaphore
+{
+public:
+    virtual ~OSInterface_CountingSemaphore() = default;
+
+    /**
+     * @brief Add one count to the semaphore
+     *
+     * @return true if the count was added, false if the semaphore is already at its maximum count
+     */
+    virtual bool signal() = 0;
+
+    /**
+     * @brief Add several counts to the semaphore at once
+     *
+     * @param count Number of counts to add
+     * @return uint32_t Number of counts added, less than count if the maximum count was reached
+     */
+    virtual uint32_t signalN(uint32_t count) = 0;
+
+    /**
+     * @brief A version of `signal()` that can be called from an interrupt service routine
+     */
+    virtual bool signalFromISR() = 0;
+
+    /**
+     * @brief A version of `signalN()` that can be called from an interrupt service routine
+     */
+    virtual uint32_t signalNFromISR(uint32_t count) = 0;
+
+    /**
+     * @brief Wait for a count to be available and take it
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if a count was taken, false if the timeout was reached
+     */
+    virtual bool wait(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait for a count to be available and take it, with a timeout in microseconds
+     *
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if a count was taken, false if the timeout was reached
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool waitMicros(const uint32_t maxTimeToWait_us)
+    {
+        return wait(maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+
+    /**
+     * @brief Wait for several counts to be available and take them all at once
+     *
+     * @param count Number of counts to take
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if the counts were taken, false if the timeout was reached or count is above the maximum count
+     * @note Counts are never partially taken, so a waiter for many counts does not hold back the others.
+     */
+    virtual bool waitN(uint32_t count, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Take a count if one is available, without waiting. Can be called from an interrupt service routine.
+     *
+     * @return true if a count was taken, false otherwise
+     */
+    virtual bool waitFromISR() = 0;
+
+    /**
+     * @brief Take several counts if they are all available, without waiting. Can be called from an interrupt service
+     * routine.
+     *
+     * @param count Number of counts to take
+     * @return true if the counts were taken, false otherwise
+     */
+    virtual bool waitNFromISR(uint32_t count) = 0;
+
+    /**
+     * @brief Get the number of counts available
+     *
+     * @return uint32_t Current count, which may change as soon as this returns
+     */
+    virtual uint32_t getCount() = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_COUNTINGSEMAPHORE_H
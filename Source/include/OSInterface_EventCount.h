@@ -0,0 +1,74 @@
+#ifndef OSINTERFACE_OSINTERFACE_EVENTCOUNT_H
+#define OSINTERFACE_OSINTERFACE_EVENTCOUNT_H
+
+#include <cstdint>
+#include "OSInterface.h"
+
+/**
+ * @brief Wait primitive with inline storage, on which threads retry a non-blocking operation until it succeeds
+ *
+ * Objects that must not allocate, such as OSInterface_StaticQueue, block on event counts: a waiter retries its
+ * operation every time it is notified, and the threads that make the operation possible notify once they did. The
+ * backends whose waits need no allocated object specialize this class (OSInterface_Linux with a futex, OSInterface_Sim
+ * with a wait queue of its scheduler), so that waiting and notifying are direct calls. This generic version, used with
+ * the virtual OSInterface, has no such primitive to block on: it retries the operation every millisecond, and
+ * notifying does nothing.
+ *
+ * @tparam Backend Implementation the waits go through
+ */
+template <typename Backend> class OSInterface_EventCount
+{
+public:
+    /**
+     * @param osInterface Reference to the OSInterface to sleep with, must outlive the event count
+     */
+    constexpr explicit OSInterface_EventCount(Backend& osInterface) : osInterface(&osInterface)
+    {
+    }
+
+    OSInterface_EventCount(const OSInterface_EventCount&)            = delete;
+    OSInterface_EventCount& operator=(const OSInterface_EventCount&) = delete;
+    OSInterface_EventCount(OSInterface_EventCount&&)                 = delete;
+    OSInterface_EventCount& operator=(OSInterface_EventCount&&)      = delete;
+
+    ~OSInterface_EventCount() = default;
+
+    /**
+     * @brief Retry a non-blocking operation until it succeeds or the timeout expires
+     *
+     * @param tryOperation Callable returning true once the operation succeeded
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if the operation succeeded, false if the timeout was reached
+     */
+    template <typename Operation> bool await(Operation&& tryOperation, const uint32_t maxTimeToWait_ms)
+    {
+        if (tryOperation())
+        {
+            return true;
+        }
+        const uint32_t start = osInterface->osMillis();
+        while (osInterface->osMillis() - start < maxTimeToWait_ms)
+        {
+            osInterface->osSleep(1);
+            if (tryOperation())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Wake up one waiter, if any, once its operation may succeed
+     *
+     * @note Can be called from an interrupt service routine.
+     */
+    void notifyOne()
+    {
+    }
+
+private:
+    Backend* osInterface;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_EVENTCOUNT_H
@@ -0,0 +1,78 @@
+#ifndef OSINTERFACE_OSINTERFACE_EVENTGROUP_H
+#define OSINTERFACE_OSINTERFACE_EVENTGROUP_H
+
+#include <cstdint>
+
+/**
+ * @brief Word of 32 event flags that threads can wait on, for any or all of a set of flags
+ *
+ * The flags are created cleared. Setting flags wakes every waiter whose condition may have become true.
+ */
+class OSInterface_EventGroup
+{
+public:
+    using WaitMode = enum { WAIT_ANY, WAIT_ALL };
+
+    virtual ~OSInterface_EventGroup() = default;
+
+    /**
+     * @brief Set flags
+     *
+     * @param bits Flags to set
+     * @return uint32_t Flags right after they were set
+     */
+    virtual uint32_t setBits(uint32_t bits) = 0;
+
+    /**
+     * @brief A version of `setBits()` that can be called from an interrupt service routine
+     */
+    virtual uint32_t setBitsFromISR(uint32_t bits) = 0;
+
+    /**
+     * @brief Clear flags
+     *
+     * @param bits Flags to clear
+     * @return uint32_t Flags before they were cleared
+     */
+    virtual uint32_t clearBits(uint32_t bits) = 0;
+
+    /**
+     * @brief A version of `clearBits()` that can be called from an interrupt service routine
+     */
+    virtual uint32_t clearBitsFromISR(uint32_t bits) = 0;
+
+    /**
+     * @brief Get the flags
+     *
+     * @return uint32_t Current flags, which may change as soon as this returns
+     */
+    virtual uint32_t getBits() = 0;
+
+    /**
+     * @brief Wait until any or all of a set of flags are set
+     *
+     * @param bits Flags to wait for
+     * @param mode WAIT_ANY to return once one of the flags is set, WAIT_ALL once all of them are
+     * @param clearOnExit If true, the flags waited for are cleared when the condition is met, atomically with
+     * checking it, so that a single waiter consumes them
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return uint32_t Flags when the condition was met (before clearing them), or when the timeout was reached. Test
+     * the returned flags against the ones waited for to tell the two apart.
+     * @note Waiting for no flag returns immediately.
+     */
+    virtual uint32_t waitBits(uint32_t bits, WaitMode mode, bool clearOnExit, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait until any or all of a set of flags are set, with a timeout in microseconds
+     *
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     * @see waitBits()
+     */
+    virtual uint32_t waitBitsMicros(const uint32_t bits, const WaitMode mode, const bool clearOnExit,
+                                    const uint32_t maxTimeToWait_us)
+    {
+        return waitBits(bits, mode, clearOnExit, maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+};
+
+#endif // OSINTERFACE_OSINTERFACE_EVENTGROUP_H
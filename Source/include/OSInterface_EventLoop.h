@@ -0,0 +1,336 @@
+#ifndef OSINTERFACE_OSINTERFACE_EVENTLOOP_H
+#define OSINTERFACE_OSINTERFACE_EVENTLOOP_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "OSInterface.h"
+
+class OSInterface_EventLoop;
+
+/**
+ * @brief Coroutine run by an OSInterface_EventLoop
+ *
+ * A function returning OSInterface_Task is a coroutine that does not start when called: it starts once handed to
+ * OSInterface_EventLoop::spawn(), and then runs on the thread of the loop. Its co_await expressions are the awaitables
+ * of this file (OSInterfaceReceiveAsync(), OSInterfaceWaitAsync(), OSInterfaceSleepAsync()), which suspend the task
+ * without blocking the thread, so that a single loop thread serves every task.
+ *
+ * @note A task cannot co_await another task. Exceptions escaping a task terminate the program.
+ */
+class OSInterface_Task
+{
+public:
+    struct promise_type
+    {
+        OSInterface_EventLoop* loop{nullptr};
+
+        OSInterface_Task get_return_object()
+        {
+            return OSInterface_Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        /**
+         * @brief Called instead of get_return_object() when the frame could not be allocated
+         */
+        static OSInterface_Task get_return_object_on_allocation_failure()
+        {
+            return OSInterface_Task(nullptr);
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        // The loop destroys the frame once it sees the task is done
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+
+    OSInterface_Task(const OSInterface_Task&)            = delete;
+    OSInterface_Task& operator=(const OSInterface_Task&) = delete;
+
+    OSInterface_Task(OSInterface_Task&& other) noexcept : handle(other.handle)
+    {
+        other.handle = nullptr;
+    }
+
+    OSInterface_Task& operator=(OSInterface_Task&&) = delete;
+
+    /**
+     * @note Destroys the coroutine if it was not handed to a loop.
+     */
+    ~OSInterface_Task()
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+    }
+
+private:
+    friend class OSInterface_EventLoop;
+
+    explicit OSInterface_Task(const std::coroutine_handle<promise_type> handle) : handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief Awaitable of an OSInterface_Task, co_await gives true if the awaited event happened, false on timeout
+ *
+ * It first tries to complete without suspending (a message is already queued, the semaphore is signaled...). If it
+ * cannot, the task is suspended and its loop resumes it once the object is ready or the timeout expired.
+ */
+class OSInterface_Awaiter
+{
+public:
+    using Kind = enum { QUEUE, SEMAPHORE, TIMER, SLEEP };
+
+    OSInterface_Awaiter(const Kind kind, void* object, void* message, const uint32_t timeout_ms) :
+        kind(kind), object(object), message(message), timeout_ms(timeout_ms)
+    {
+    }
+
+    OSInterface_Awaiter(const OSInterface_Awaiter&)            = delete;
+    OSInterface_Awaiter& operator=(const OSInterface_Awaiter&) = delete;
+    OSInterface_Awaiter(OSInterface_Awaiter&&)                 = delete;
+    OSInterface_Awaiter& operator=(OSInterface_Awaiter&&)      = delete;
+
+    ~OSInterface_Awaiter() = default;
+
+    bool await_ready()
+    {
+        if (kind == SLEEP)
+        {
+            return false;
+        }
+        result = attempt();
+        return result || timeout_ms == 0;
+    }
+
+    bool await_suspend(std::coroutine_handle<OSInterface_Task::promise_type> task);
+
+    [[nodiscard]] bool await_resume() const
+    {
+        return result;
+    }
+
+private:
+    friend class OSInterface_EventLoop;
+
+    /**
+     * @brief Take what is awaited if it is available
+     *
+     * @return true if the awaited event happened, false otherwise
+     */
+    bool attempt();
+
+    using Deadlines = std::multimap<uint64_t, OSInterface_Awaiter*>; // Of the suspended awaiters of a loop, in ms
+
+    const Kind              kind;
+    void* const             object; // Queue, semaphore or timer, nullptr for SLEEP
+    void* const             message;
+    const uint32_t          timeout_ms;
+    bool                    result{false};
+    std::coroutine_handle<> task;
+    Deadlines::iterator     deadline; // Valid while hasDeadline is true
+    bool                    hasDeadline{false};
+};
+
+/**
+ * @brief Single thread running many OSInterface_Task coroutines
+ *
+ * The suspended tasks cost a coroutine frame each instead of a thread and its stack. The loop adds the objects they
+ * wait for to an OSInterface_WaitSet, and its thread sleeps on it until one of them is ready or the earliest timeout
+ * expires, so tasks are resumed through the wakeup mechanism of the backend rather than by polling. Objects are only
+ * members of the wait set while a task waits for them.
+ *
+ * @note spawn() and run() must be called from a single thread, or from the tasks themselves. stop() can be called
+ * from any thread.
+ * @note The objects awaited must have been created by the same OSInterface as the loop, and must not be members of
+ * another wait set while a task waits for them.
+ */
+class OSInterface_EventLoop
+{
+public:
+    /**
+     * @brief Create the loop
+     *
+     * @param os Implementation to create the wait set with and to read the time from
+     * @note Check isValid() after construction, the wait set creation may fail.
+     */
+    explicit OSInterface_EventLoop(OSInterface& os);
+
+    OSInterface_EventLoop(const OSInterface_EventLoop&)            = delete;
+    OSInterface_EventLoop& operator=(const OSInterface_EventLoop&) = delete;
+    OSInterface_EventLoop(OSInterface_EventLoop&&)                 = delete;
+    OSInterface_EventLoop& operator=(OSInterface_EventLoop&&)      = delete;
+
+    /**
+     * @note Destroys the tasks that have not returned, at their current suspension point.
+     */
+    ~OSInterface_EventLoop();
+
+    /**
+     * @return true if the wait set of the loop was created, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    /**
+     * @brief Hand a task to the loop, which starts it the next time it runs
+     *
+     * @param task Task to run, owned by the loop from now on
+     * @return true if the task was added, false if its frame could not be allocated
+     */
+    bool spawn(OSInterface_Task&& task);
+
+    /**
+     * @brief Run the tasks until every one of them returned or stop() is called
+     *
+     * @note Returns at once if the loop is not valid.
+     */
+    void run();
+
+    /**
+     * @brief Make run() return, the tasks stay suspended until it is called again
+     *
+     * @note Callable from any thread, and before run() to make its next call return at once.
+     */
+    void stop();
+
+    /**
+     * @return uint32_t Number of tasks that have not returned yet
+     */
+    [[nodiscard]] uint32_t taskCount() const;
+
+private:
+    friend class OSInterface_Awaiter;
+
+    static constexpr uint32_t READY_BATCH = 16; // Ready members read from the wait set at once
+
+    struct Member
+    {
+        OSInterface_Awaiter::Kind        kind;
+        void*                            object;
+        std::deque<OSInterface_Awaiter*> waiters; // In the order they started waiting
+    };
+
+    bool     suspend(OSInterface_Awaiter& awaiter, std::coroutine_handle<> task);
+    void     serve(const void* object);
+    void     complete(OSInterface_Awaiter& awaiter, bool result);
+    void     expireDeadlines();
+    void     resumeRunnable();
+    bool     addToWaitSet(const Member& member);
+    void     removeFromWaitSet(const Member& member);
+    uint32_t timeUntilNextDeadline();
+
+    OSInterface&                 os;
+    OSInterface_WaitSet*         waitSet;
+    OSInterface_BinarySemaphore* wakeup; // Signaled by stop()
+    std::atomic<bool>            stopRequested{false};
+
+    std::unordered_set<void*>               tasks; // Frame addresses of the tasks that have not returned
+    std::vector<std::coroutine_handle<>>    runnable;
+    std::vector<std::coroutine_handle<>>    resuming;
+    std::unordered_map<const void*, Member> members; // Of the wait set, by the pointer given to add()
+    OSInterface_Awaiter::Deadlines          deadlines;
+};
+
+/**
+ * @brief Receive a message from a queue without blocking the loop
+ *
+ * @param queue Queue to receive from
+ * @param message Buffer receiving the message, of the message size of the queue
+ * @param maxTimeToWait_ms Maximum time to wait in milliseconds, UINT32_MAX to wait without timeout
+ * @return OSInterface_Awaiter co_await gives true if a message was received, false if the timeout was reached
+ */
+inline OSInterface_Awaiter OSInterfaceReceiveAsync(OSInterface_UntypedQueue& queue, void* message,
+                                                   const uint32_t maxTimeToWait_ms = UINT32_MAX)
+{
+    return {OSInterface_Awaiter::QUEUE, &queue, message, maxTimeToWait_ms};
+}
+
+/**
+ * @brief Receive a message from a typed queue without blocking the loop
+ *
+ * @see OSInterfaceReceiveAsync(OSInterface_UntypedQueue&, void*, uint32_t)
+ */
+template <typename T, typename Backend, typename Untyped>
+OSInterface_Awaiter OSInterfaceReceiveAsync(OSInterface::OSInterface_Queue<T, Backend, Untyped>& queue, T& message,
+                                            const uint32_t maxTimeToWait_ms = UINT32_MAX)
+{
+    return {OSInterface_Awaiter::QUEUE, static_cast<OSInterface_UntypedQueue*>(queue.getUntypedQueue()), &message,
+            maxTimeToWait_ms};
+}
+
+/**
+ * @brief Receive a message from a typed priority queue without blocking the loop
+ *
+ * @see OSInterfaceReceiveAsync(OSInterface_UntypedQueue&, void*, uint32_t)
+ */
+template <typename T, typename Backend>
+OSInterface_Awaiter OSInterfaceReceiveAsync(OSInterface::OSInterface_PriorityQueue<T, Backend>& queue, T& message,
+                                            const uint32_t maxTimeToWait_ms = UINT32_MAX)
+{
+    return {OSInterface_Awaiter::QUEUE, static_cast<OSInterface_UntypedQueue*>(queue.getUntypedQueue()), &message,
+            maxTimeToWait_ms};
+}
+
+/**
+ * @brief Take a binary semaphore without blocking the loop
+ *
+ * @param semaphore Semaphore to take
+ * @param maxTimeToWait_ms Maximum time to wait in milliseconds, UINT32_MAX to wait without timeout
+ * @return OSInterface_Awaiter co_await gives true if the semaphore was taken, false if the timeout was reached
+ */
+inline OSInterface_Awaiter OSInterfaceWaitAsync(OSInterface_BinarySemaphore& semaphore,
+                                                const uint32_t maxTimeToWait_ms = UINT32_MAX)
+{
+    return {OSInterface_Awaiter::SEMAPHORE, &semaphore, nullptr, maxTimeToWait_ms};
+}
+
+/**
+ * @brief Wait for the next expiration of a timer without blocking the loop
+ *
+ * @param timer Running timer, every task waiting for it is resumed when it expires
+ * @param maxTimeToWait_ms Maximum time to wait in milliseconds, UINT32_MAX to wait without timeout
+ * @return OSInterface_Awaiter co_await gives true if the timer expired, false if the timeout was reached
+ */
+inline OSInterface_Awaiter OSInterfaceWaitAsync(OSInterface_Timer& timer, const uint32_t maxTimeToWait_ms = UINT32_MAX)
+{
+    return {OSInterface_Awaiter::TIMER, &timer, nullptr, maxTimeToWait_ms};
+}
+
+/**
+ * @brief Sleep without blocking the loop
+ *
+ * @param ms Time to sleep in milliseconds, 0 only lets the other runnable tasks run first
+ * @return OSInterface_Awaiter co_await gives true
+ */
+inline OSInterface_Awaiter OSInterfaceSleepAsync(const uint32_t ms)
+{
+    return {OSInterface_Awaiter::SLEEP, nullptr, nullptr, ms};
+}
+
+#endif // OSINTERFACE_OSINTERFACE_EVENTLOOP_H
@@ -0,0 +1,71 @@
+#ifndef OSINTERFACE_OSINTERFACE_FLIGHTRECORD_H
+#define OSINTERFACE_OSINTERFACE_FLIGHTRECORD_H
+
+#include <cstdint>
+
+/**
+ * @file
+ * @brief Layout of the binary flight-recorder log files, shared by the recorders and the decoder
+ *
+ * A file is a OSInterface_FlightRecordFile header, followed by a string table of stringTableSize bytes and a circular
+ * record area of recordAreaSize bytes. All integers are little-endian, as written by the recording host.
+ *
+ * The string table is append-only. Each entry is a OSInterface_FlightRecordString followed by its bytes: the tag for a
+ * tag entry, or the format string, a NUL and the argument signature (see OSInterface_LogRecord) for a message entry,
+ * then a NUL. Tags and messages are numbered from 0 in the order of their entries.
+ *
+ * Records are a OSInterface_FlightRecordHeader followed by the packed arguments, padded to a multiple of 4 bytes. The
+ * valid records lie between the tail and the head, two positions that only grow, taken modulo recordAreaSize. A
+ * record never wraps around the end of the area: a header with a size of 0 means the next record is at the start of
+ * the area.
+ *
+ * The recorder advances the tail before overwriting old records and the head once a record is complete, so the file
+ * stays consistent if the process crashes at any point.
+ */
+
+static constexpr char     OSInterface_FLIGHT_RECORD_MAGIC[8] = {'O', 'S', 'I', 'F', 'L', 'I', 'T', 'E'};
+static constexpr uint32_t OSInterface_FLIGHT_RECORD_VERSION  = 1;
+
+struct OSInterface_FlightRecordFile
+{
+    char     magic[8]; // OSInterface_FLIGHT_RECORD_MAGIC
+    uint32_t version;  // OSInterface_FLIGHT_RECORD_VERSION
+    uint32_t headerSize;
+    uint32_t stringTableSize;
+    uint32_t recordAreaSize;
+    uint8_t  pointerSize;    // Bytes of a P argument
+    uint8_t  longDoubleSize; // Bytes of a g argument
+    uint8_t  reserved[6];
+    uint64_t startRealtime_ns;  // CLOCK_REALTIME when the file was created
+    uint64_t startMonotonic_ns; // Record timestamp when the file was created
+
+    // Updated while recording
+    uint64_t stringTableUsed;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t droppedRecords; // Records lost before reaching the file
+};
+
+struct OSInterface_FlightRecordString
+{
+    uint16_t kind; // OSInterface_FLIGHT_RECORD_TAG or OSInterface_FLIGHT_RECORD_MESSAGE
+    uint16_t length;
+};
+
+static constexpr uint16_t OSInterface_FLIGHT_RECORD_TAG     = 1;
+static constexpr uint16_t OSInterface_FLIGHT_RECORD_MESSAGE = 2;
+
+struct OSInterface_FlightRecordHeader
+{
+    uint16_t size;    // Bytes of the record, header and padding included, 0 to skip to the start of the area
+    uint8_t  level;   // OSInterfaceLogLevel
+    uint8_t  padding; // Bytes after the arguments
+    uint16_t tag;
+    uint16_t message;
+    uint64_t timestamp_ns;
+};
+
+static_assert(sizeof(OSInterface_FlightRecordFile) == 80, "The file header layout must not depend on the compiler");
+static_assert(sizeof(OSInterface_FlightRecordHeader) == 16, "The record layout must not depend on the compiler");
+
+#endif // OSINTERFACE_OSINTERFACE_FLIGHTRECORD_H
@@ -0,0 +1,210 @@
+#ifndef OSINTERFACE_OSINTERFACE_INSTRUMENTATION_H
+#define OSINTERFACE_OSINTERFACE_INSTRUMENTATION_H
+
+#ifdef OSInterface_INSTRUMENTATION
+
+    #include <atomic>
+    #include <bit>
+    #include <cstdint>
+    #include <cstdio>
+
+/**
+ * @brief Log-scale histogram of durations
+ *
+ * Bucket 0 counts durations of 0 ns and bucket i durations from 2^(i-1) up to 2^i - 1 ns. The last bucket also counts
+ * every longer duration.
+ */
+class OSInterface_Histogram
+{
+public:
+    static constexpr uint32_t BUCKETS = 40; // Up to about 9 minutes
+
+    void record(const uint64_t duration_ns)
+    {
+        const auto bucket = static_cast<uint32_t>(std::bit_width(duration_ns));
+        buckets[bucket < BUCKETS ? bucket : BUCKETS - 1].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t count(const uint32_t bucket) const
+    {
+        return buckets[bucket].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return uint64_t Longest duration counted by a bucket, in nanoseconds
+     */
+    static uint64_t upperBound(const uint32_t bucket)
+    {
+        return bucket == 0 ? 0 : (static_cast<uint64_t>(1) << bucket) - 1;
+    }
+
+    /**
+     * @brief Get an upper bound of a percentile of the durations
+     *
+     * @param percent Percentile to get, 100 for the longest duration
+     * @return uint64_t Upper bound of the bucket holding the percentile, in nanoseconds. 0 if nothing was recorded.
+     */
+    [[nodiscard]] uint64_t percentile(uint32_t percent) const;
+
+    /**
+     * @return uint64_t Number of durations recorded
+     */
+    [[nodiscard]] uint64_t total() const;
+
+private:
+    std::atomic<uint64_t> buckets[BUCKETS]{};
+};
+
+/**
+ * @brief Statistics of the calls that found an object unavailable
+ */
+struct OSInterface_WaitStats
+{
+    std::atomic<uint64_t> contentions{0}; // Calls that found the object unavailable
+    std::atomic<uint64_t> waits{0};       // Contended calls with a timeout, which may have slept
+    std::atomic<uint64_t> timeouts{0};    // Calls that gave up, zero-timeout polls included
+    OSInterface_Histogram waitTime;       // Time spent by the calls with a timeout
+
+    /**
+     * @brief Record a call that found the object unavailable, once it returns
+     *
+     * @param timeout_ns Timeout of the call
+     * @param duration_ns Time spent in the call
+     * @param succeeded true if the call eventually got the object, false if it gave up
+     */
+    void record(const uint64_t timeout_ns, const uint64_t duration_ns, const bool succeeded)
+    {
+        contentions.fetch_add(1, std::memory_order_relaxed);
+        if (timeout_ns != 0)
+        {
+            waits.fetch_add(1, std::memory_order_relaxed);
+            waitTime.record(duration_ns);
+        }
+        if (!succeeded)
+        {
+            timeouts.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Statistics of an instrumented mutex, semaphore or queue, and its entry in the global registry
+ *
+ * Objects created through an OSInterface factory are added to the registry. Each field is only updated by the kinds
+ * of objects it applies to.
+ */
+class OSInterface_InstrumentationStats
+{
+public:
+    using Kind = enum { MUTEX, BINARY_SEMAPHORE, QUEUE };
+
+    explicit OSInterface_InstrumentationStats(const Kind kind) : kind(kind)
+    {
+    }
+
+    OSInterface_InstrumentationStats(const OSInterface_InstrumentationStats&)            = delete;
+    OSInterface_InstrumentationStats& operator=(const OSInterface_InstrumentationStats&) = delete;
+    OSInterface_InstrumentationStats(OSInterface_InstrumentationStats&&)                 = delete;
+    OSInterface_InstrumentationStats& operator=(OSInterface_InstrumentationStats&&)      = delete;
+
+    ~OSInterface_InstrumentationStats();
+
+    /**
+     * @brief Add the object to the registry, if not already there
+     */
+    void publish();
+
+    /**
+     * @brief Name the object and add it to the registry
+     *
+     * @param name Name of the object, must outlive it (string literal)
+     */
+    void setName(const char* name);
+
+    [[nodiscard]] Kind getKind() const
+    {
+        return kind;
+    }
+
+    /**
+     * @return const char* Name of the object, nullptr if it was never named
+     * @note Only stable while the registry is locked, as in OSInterface_Instrumentation::forEach() visitors.
+     */
+    [[nodiscard]] const char* getName() const
+    {
+        return name;
+    }
+
+    /**
+     * @brief Raise the high-water mark of a queue
+     */
+    void recordLength(const uint32_t length)
+    {
+        uint32_t current = highWaterMark.load(std::memory_order_relaxed);
+        while (length > current &&
+               !highWaterMark.compare_exchange_weak(current, length, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::atomic<uint64_t> acquisitions{0};  // Mutexes and semaphores: successful locks and takes
+    OSInterface_WaitStats wait;             // Mutexes and semaphores: contended calls. Queues: receives on empty.
+    OSInterface_WaitStats sendWait;         // Queues: sends on full
+    OSInterface_Histogram holdTime;         // Mutexes: time from lock to unlock
+    std::atomic<uint32_t> highWaterMark{0}; // Queues: most messages queued at once
+
+private:
+    friend class OSInterface_Instrumentation;
+
+    const Kind  kind;
+    const char* name{nullptr};
+
+    // Guarded by the registry lock
+    bool                              published{false};
+    OSInterface_InstrumentationStats* previous{nullptr};
+    OSInterface_InstrumentationStats* next{nullptr};
+};
+
+using OSInterfaceInstrumentationVisitor = void (*)(const OSInterface_InstrumentationStats& stats, void* arg);
+
+/**
+ * @brief Registry of the instrumented objects, available when OSInterface_INSTRUMENTATION is defined
+ *
+ * Mutexes, binary semaphores and queues count their contended calls and timeouts and keep log-scale histograms of
+ * their wait times (and hold times for mutexes, high-water marks for queues). Without OSInterface_INSTRUMENTATION,
+ * none of this is compiled and the objects pay nothing.
+ */
+class OSInterface_Instrumentation
+{
+public:
+    /**
+     * @brief Print the statistics of every registered object, one line each
+     *
+     * @param out Stream to print to
+     */
+    static void dump(FILE* out);
+
+    /**
+     * @brief Print the statistics to stdout, as an OSInterfaceProcess for a periodic OSInterface_Timer
+     *
+     * @param arg Unused
+     */
+    static void dumpProcess(void* arg);
+
+    /**
+     * @brief Call a visitor with the statistics of every registered object, with the registry locked
+     *
+     * @note The visitor must not create or delete instrumented objects.
+     */
+    static void forEach(OSInterfaceInstrumentationVisitor visitor, void* arg);
+
+private:
+    friend class OSInterface_InstrumentationStats;
+
+    static void add(OSInterface_InstrumentationStats& stats);
+    static void remove(OSInterface_InstrumentationStats& stats);
+};
+
+#endif // OSInterface_INSTRUMENTATION
+
+#endif // OSINTERFACE_OSINTERFACE_INSTRUMENTATION_H
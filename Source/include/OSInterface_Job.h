@@ -0,0 +1,33 @@
+#ifndef OSINTERFACE_OSINTERFACE_JOB_H
+#define OSINTERFACE_OSINTERFACE_JOB_H
+
+#include <cstdint>
+
+/**
+ * @brief Completion handle of a job submitted with OSInterface::osSubmit()
+ */
+class OSInterface_Job
+{
+public:
+    /**
+     * @note Deleting a job waits for it to complete, so it must not be deleted from the job itself.
+     */
+    virtual ~OSInterface_Job() = default;
+
+    /**
+     * @brief Wait for the job to complete
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return True if the job has completed, false if the timeout was reached.
+     */
+    virtual bool wait(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Check if the job has completed
+     *
+     * @return True if the job has completed, false otherwise.
+     */
+    [[nodiscard]] virtual bool isDone() = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_JOB_H
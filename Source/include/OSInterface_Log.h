@@ -15,71 +15,133 @@
 
 #include <cstdio>
 
-#ifndef OSInterfaceLogVerbose
-    #define OSInterfaceLogVerbose(tag, format, ...)                                                                    \
-        do                                                                                                             \
+// Most verbose level compiled in (numeric value of OSInterfaceLogLevel), calls above it compile to nothing
+#ifndef OSInterface_LOG_COMPILED_LEVEL
+    #define OSInterface_LOG_COMPILED_LEVEL 5
+#endif
+
+// Level of the tags whose level was never set (numeric value of OSInterfaceLogLevel)
+#ifndef OSInterface_LOG_DEFAULT_LEVEL
+    #define OSInterface_LOG_DEFAULT_LEVEL 3
+#endif
+
+// Writes a record of a level, whose format takes the tag as first argument
+#ifndef OSInterfaceLogWrite
+    #ifdef OSInterface_ASYNC_LOG
+        #include "OSInterface_AsyncLog.h"
+        // printf is never called, it only keeps the compiler checking the format against the arguments
+        #define OSInterfaceLogWrite(level, tag, format, ...)                                                           \
+            do                                                                                                         \
+            {                                                                                                          \
+                if (false)                                                                                             \
+                {                                                                                                      \
+                    printf(format, tag, ##__VA_ARGS__);                                                                \
+                }                                                                                                      \
+                OSInterface_AsyncLog::write(level, tag, format, ##__VA_ARGS__);                                        \
+            }                                                                                                          \
+            while (0)
+    #else
+        #define OSInterfaceLogWrite(level, tag, format, ...)                                                           \
+            do                                                                                                         \
+            {                                                                                                          \
+                printf(format, tag, ##__VA_ARGS__);                                                                    \
+                fflush(stdout);                                                                                        \
+            }                                                                                                          \
+            while (0)
+    #endif
+#endif
+
+#ifndef OSInterfaceLogFlush
+    #ifdef OSInterface_ASYNC_LOG
+        #define OSInterfaceLogFlush() OSInterface_AsyncLog::flush()
+    #else
+        #define OSInterfaceLogFlush() fflush(stdout)
+    #endif
+#endif
+
+// The arguments are only evaluated if the level is enabled for the tag
+#define OSInterfaceLogAtLevel(level, tag, format, ...)                                                                 \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (OSInterfaceGetLogLevel(tag) >= (level))                                                                    \
         {                                                                                                              \
-            printf("Verbose - %s: " format "\n", tag, ##__VA_ARGS__);                                                  \
-            fflush(stdout);                                                                                            \
+            OSInterfaceLogWrite(level, tag, format, ##__VA_ARGS__);                                                    \
         }                                                                                                              \
-        while (0)
-#endif
+    }                                                                                                                  \
+    while (0)
 
-#ifndef OSInterfaceLogDebug
-    #define OSInterfaceLogDebug(tag, format, ...)                                                                      \
-        do                                                                                                             \
+// Calls compiled out still check their format, but never evaluate their arguments
+#define OSInterfaceLogCompiledOut(format, ...)                                                                         \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (false)                                                                                                     \
         {                                                                                                              \
-            printf("Debug - %s: " format "\n", tag, ##__VA_ARGS__);                                                    \
-            fflush(stdout);                                                                                            \
+            printf(format, ##__VA_ARGS__);                                                                             \
         }                                                                                                              \
-        while (0)
+    }                                                                                                                  \
+    while (0)
+
+#ifndef OSInterfaceLogVerbose
+    #if OSInterface_LOG_COMPILED_LEVEL >= 5
+        #define OSInterfaceLogVerbose(tag, format, ...)                                                                \
+            OSInterfaceLogAtLevel(OSInterface_LOG_VERBOSE, tag, "Verbose - %s: " format "\n", ##__VA_ARGS__)
+    #else
+        #define OSInterfaceLogVerbose(tag, format, ...)                                                                \
+            OSInterfaceLogCompiledOut("Verbose - %s: " format "\n", tag, ##__VA_ARGS__)
+    #endif
+#endif
+
+#ifndef OSInterfaceLogDebug
+    #if OSInterface_LOG_COMPILED_LEVEL >= 4
+        #define OSInterfaceLogDebug(tag, format, ...)                                                                  \
+            OSInterfaceLogAtLevel(OSInterface_LOG_DEBUG, tag, "Debug - %s: " format "\n", ##__VA_ARGS__)
+    #else
+        #define OSInterfaceLogDebug(tag, format, ...)                                                                  \
+            OSInterfaceLogCompiledOut("Debug - %s: " format "\n", tag, ##__VA_ARGS__)
+    #endif
 #endif
 
 #ifndef OSInterfaceLogInfo
-    #define OSInterfaceLogInfo(tag, format, ...)                                                                       \
-        do                                                                                                             \
-        {                                                                                                              \
-            printf("Info - %s: " format "\n", tag, ##__VA_ARGS__);                                                     \
-            fflush(stdout);                                                                                            \
-        }                                                                                                              \
-        while (0)
+    #if OSInterface_LOG_COMPILED_LEVEL >= 3
+        #define OSInterfaceLogInfo(tag, format, ...)                                                                   \
+            OSInterfaceLogAtLevel(OSInterface_LOG_INFO, tag, "Info - %s: " format "\n", ##__VA_ARGS__)
+    #else
+        #define OSInterfaceLogInfo(tag, format, ...)                                                                   \
+            OSInterfaceLogCompiledOut("Info - %s: " format "\n", tag, ##__VA_ARGS__)
+    #endif
 #endif
 
 #ifndef OSInterfaceLogWarning
-    #define OSInterfaceLogWarning(tag, format, ...)                                                                    \
-        do                                                                                                             \
-        {                                                                                                              \
-            printf("Warning " AT " - %s: " format "\n", tag, ##__VA_ARGS__);                                           \
-            fflush(stdout);                                                                                            \
-        }                                                                                                              \
-        while (0)
+    #if OSInterface_LOG_COMPILED_LEVEL >= 2
+        #define OSInterfaceLogWarning(tag, format, ...)                                                                \
+            OSInterfaceLogAtLevel(OSInterface_LOG_WARN, tag, "Warning " AT " - %s: " format "\n", ##__VA_ARGS__)
+    #else
+        #define OSInterfaceLogWarning(tag, format, ...)                                                                \
+            OSInterfaceLogCompiledOut("Warning " AT " - %s: " format "\n", tag, ##__VA_ARGS__)
+    #endif
 #endif
 
 #ifndef OSInterfaceLogError
-    #define OSInterfaceLogError(tag, format, ...)                                                                      \
-        do                                                                                                             \
-        {                                                                                                              \
-            printf("Error: " AT " - %s: " format "\n", tag, ##__VA_ARGS__);                                            \
-            fflush(stdout);                                                                                            \
-        }                                                                                                              \
-        while (0)
+    #if OSInterface_LOG_COMPILED_LEVEL >= 1
+        #define OSInterfaceLogError(tag, format, ...)                                                                  \
+            OSInterfaceLogAtLevel(OSInterface_LOG_ERROR, tag, "Error: " AT " - %s: " format "\n", ##__VA_ARGS__)
+    #else
+        #define OSInterfaceLogError(tag, format, ...)                                                                  \
+            OSInterfaceLogCompiledOut("Error: " AT " - %s: " format "\n", tag, ##__VA_ARGS__)
+    #endif
 #endif
 
 #ifndef OSInterfaceSetLogLevel
-    #define OSInterfaceSetLogLevel(tag, level)                                                                         \
-        do                                                                                                             \
-        {                                                                                                              \
-            printf("Mock: Set log level of tag '%s' to '%s'\n", tag, OSInterfaceLogLevelToString(level));              \
-            fflush(stdout);                                                                                            \
-        }                                                                                                              \
-        while (0)
+    #define OSInterfaceSetLogLevel(tag, level) OSInterfaceLogSetTagLevel(tag, level)
 #endif
 
 #ifndef OSInterfaceGetLogLevel
-    #define OSInterfaceGetLogLevel(tag) OSInterface_LOG_INFO
+    #define OSInterfaceGetLogLevel(tag) OSInterfaceLogGetTagLevel(tag)
 #endif
 
-using OSInterfaceLogLevel = enum {
+// Named so that the functions below have external linkage
+enum OSInterfaceLogLevel
+{
     OSInterface_LOG_NONE  = 0, /*!< No log output */
     OSInterface_LOG_ERROR = 1, /*!< Critical errors, software module cannot recover on its own */
     OSInterface_LOG_WARN  = 2, /*!< Error conditions from which recovery measures have been taken */
@@ -93,4 +155,25 @@ using OSInterfaceLogLevel = enum {
 
 const char* OSInterfaceLogLevelToString(OSInterfaceLogLevel level);
 
+/**
+ * @brief Set the level of a tag
+ *
+ * @param tag Tag to configure, "*" for the tags whose level was never set
+ * @param level Most verbose level logged for the tag
+ * @return true if the level was set, false if the table of tags is full
+ * @note Tags are compared by content, so every pointer to the same string shares its level.
+ * @note Tags are kept by pointer, they must be string literals or otherwise live until the program ends.
+ */
+bool OSInterfaceLogSetTagLevel(const char* tag, OSInterfaceLogLevel level);
+
+/**
+ * @brief Get the level of a tag
+ *
+ * @param tag Tag to look up
+ * @return OSInterfaceLogLevel Most verbose level logged for the tag
+ * @note Called by every log call: after the first call with a given pointer, this is a lock-free lookup of the
+ * pointer in a hash table.
+ */
+OSInterfaceLogLevel OSInterfaceLogGetTagLevel(const char* tag);
+
 #endif // OSINTERFACE_OSINTERFACE_LOG_H
@@ -0,0 +1,330 @@
+#ifndef OSINTERFACE_OSINTERFACE_MAILBOX_H
+#define OSINTERFACE_OSINTERFACE_MAILBOX_H
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "OSInterface.h"
+
+/**
+ * @brief Latest-value mailbox: writers overwrite the value, readers copy the most recent one
+ *
+ * The value is kept in SLOTS copies, each guarded by its own sequence number (a seqlock). A writer takes a ticket,
+ * fills a copy that is neither the latest nor being filled by another writer, and publishes it unless a writer that
+ * started after it published first: the value of the write that started last always wins, even when an ISR write
+ * interrupts a thread write. A reader copies the latest value without taking any lock, and copies again only if that
+ * copy was reused meanwhile, so that neither side ever waits for the other. The version of a value is the ticket of its
+ * write, that readers use to tell whether the value changed.
+ *
+ * Writers only touch the event group of the mailbox when a reader is blocked in readNewer(), so an idle mailbox costs
+ * a few atomic operations per write.
+ *
+ * @warning Methods of this class MUST NOT be called if the constructor failed (result is false).
+ *
+ * @tparam T The type of the value, must be trivially copyable. It is copied word by word on every read and write.
+ * @tparam Backend Implementation creating the event group of the mailbox (see OSInterface_Queue)
+ */
+template <typename T, typename Backend = OSInterface> class OSInterface_Mailbox
+{
+    static_assert(std::is_trivially_copyable_v<T>, "The value is copied word by word");
+    static_assert(std::is_default_constructible_v<T>, "The mailbox holds T{} until the first write");
+
+    using EventGroup = std::remove_pointer_t<decltype(std::declval<Backend&>().osCreateEventGroup())>;
+
+public:
+    /**
+     * @brief Maximum number of threads blocked in readNewer() on the event group at once. Others poll every
+     * millisecond.
+     */
+    static constexpr uint32_t MAX_BLOCKED_READERS = 32;
+
+    /**
+     * @brief Number of copies of the value: the latest one, and one per write in progress
+     */
+    static constexpr uint32_t SLOTS = 4;
+
+    /**
+     * @brief Maximum number of writes in progress at once, for instance a thread, an ISR and a nested ISR
+     */
+    static constexpr uint32_t MAX_CONCURRENT_WRITES = SLOTS - 1;
+
+    /**
+     * @brief Create a mailbox holding T{} as version 0
+     *
+     * @param osInterface Reference to the OSInterface to create the event group with
+     * @param result Reference to store the result of the mailbox creation. True if the mailbox was created
+     * successfully, false otherwise. MUST be checked before calling any other methods on this object.
+     */
+    OSInterface_Mailbox(Backend& osInterface, bool& result) :
+        osInterface(osInterface), events(osInterface.osCreateEventGroup())
+    {
+        result = events != nullptr;
+        store(slots[0], T{});
+    }
+
+    OSInterface_Mailbox(const OSInterface_Mailbox&)            = delete;
+    OSInterface_Mailbox& operator=(const OSInterface_Mailbox&) = delete;
+    OSInterface_Mailbox(OSInterface_Mailbox&&)                 = delete;
+    OSInterface_Mailbox& operator=(OSInterface_Mailbox&&)      = delete;
+
+    /**
+     * @note No thread may be blocked in readNewer().
+     */
+    ~OSInterface_Mailbox()
+    {
+        delete events;
+    }
+
+    /**
+     * @brief Replace the value, without ever waiting
+     *
+     * @param value New value
+     * @return true if the value was published, false if a write that started later published first, or if more than
+     * MAX_CONCURRENT_WRITES writes were in progress. The caller can ignore the result in the first case, since a newer
+     * value replaced its own.
+     */
+    bool write(const T& value)
+    {
+        if (!publish(value))
+        {
+            return false;
+        }
+        const uint32_t readers = blockedReaders.load(std::memory_order_seq_cst);
+        if (readers != 0)
+        {
+            events->setBits(readers);
+        }
+        return true;
+    }
+
+    /**
+     * @brief A version of `write()` that can be called from an interrupt service routine
+     *
+     * @see write()
+     */
+    bool writeFromISR(const T& value)
+    {
+        if (!publish(value))
+        {
+            return false;
+        }
+        const uint32_t readers = blockedReaders.load(std::memory_order_seq_cst);
+        if (readers != 0)
+        {
+            events->setBitsFromISR(readers);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copy the latest value, without taking any lock
+     *
+     * @param value Reference to store the value
+     * @return uint32_t Version of the value copied
+     * @note Writers never fill the latest copy, so a reader that interrupts a writer, for instance from an ISR, gets
+     * the latest value at once. A reader only copies again when the copy it read was reused by a later write.
+     */
+    uint32_t read(T& value) const
+    {
+        uintptr_t words[WORDS];
+        for (;;)
+        {
+            const uint32_t current = latest.load(std::memory_order_acquire);
+            const Slot&    slot    = slots[current & SLOT_MASK];
+            const uint32_t start   = slot.sequence.load(std::memory_order_acquire);
+            if ((start & 1) != 0)
+            {
+                continue; // Already reused by a later write, latest moved on
+            }
+            for (uint32_t i = 0; i < WORDS; i++)
+            {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == start)
+            {
+                std::memcpy(&value, words, sizeof(T));
+                return current >> SLOT_BITS;
+            }
+        }
+    }
+
+    /**
+     * @brief Wait until the value is newer than a version the caller already has, then copy it
+     *
+     * @param value Reference to store the value
+     * @param version Version the caller has, for instance returned by read(). Updated with the version copied.
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds, UINT32_MAX to wait forever
+     * @return true if a newer value was copied, false if the timeout was reached
+     * @note Only the latest value is copied. Compare the versions to count the writes missed in between.
+     */
+    bool readNewer(T& value, uint32_t& version, const uint32_t maxTimeToWait_ms)
+    {
+        if (currentVersion() == version && !waitNewer(version, maxTimeToWait_ms))
+        {
+            return false;
+        }
+        version = read(value);
+        return true;
+    }
+
+    /**
+     * @return uint32_t Version of the latest value: the number of writes started before it, wrapping around after 2^30
+     * writes
+     */
+    [[nodiscard]] uint32_t currentVersion() const
+    {
+        return latest.load(std::memory_order_acquire) >> SLOT_BITS;
+    }
+
+private:
+    static constexpr uint32_t WORDS       = (sizeof(T) + sizeof(uintptr_t) - 1) / sizeof(uintptr_t);
+    static constexpr uint32_t SLOT_BITS   = std::bit_width(SLOTS - 1);
+    static constexpr uint32_t SLOT_MASK   = (UINT32_C(1) << SLOT_BITS) - 1;
+    static constexpr uint32_t ALL_SLOTS   = (UINT32_C(1) << SLOTS) - 1;
+    static constexpr uint32_t TICKET_MASK = UINT32_MAX >> SLOT_BITS;
+
+    struct Slot
+    {
+        std::atomic<uint32_t>  sequence{0}; // Odd while a writer fills the copy
+        std::atomic<uintptr_t> words[WORDS]{};
+    };
+
+    static void store(Slot& slot, const T& value)
+    {
+        uintptr_t words[WORDS]{};
+        std::memcpy(words, &value, sizeof(T));
+        const uint32_t start = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(start + 1, std::memory_order_relaxed);
+        // Orders the odd sequence number before the stores, for the readers that see one of them
+        std::atomic_thread_fence(std::memory_order_release);
+        for (uint32_t i = 0; i < WORDS; i++)
+        {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(start + 2, std::memory_order_release);
+    }
+
+    /**
+     * @return Index of a copy reserved for the caller, that is not the latest one, or SLOTS if every copy is in use
+     */
+    uint32_t reserveSlot()
+    {
+        uint32_t writing = writers.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            const uint32_t candidates =
+                ALL_SLOTS & ~writing & ~(UINT32_C(1) << (latest.load(std::memory_order_relaxed) & SLOT_MASK));
+            if (candidates == 0)
+            {
+                return SLOTS;
+            }
+            const auto slot = static_cast<uint32_t>(std::countr_zero(candidates));
+            if (!writers.compare_exchange_weak(writing, writing | (UINT32_C(1) << slot), std::memory_order_acquire))
+            {
+                continue;
+            }
+            // Only a reserved copy can become the latest, so once reserved it can only stop being the latest one
+            if ((latest.load(std::memory_order_relaxed) & SLOT_MASK) != slot)
+            {
+                return slot;
+            }
+            writing = writers.fetch_and(~(UINT32_C(1) << slot), std::memory_order_relaxed) & ~(UINT32_C(1) << slot);
+        }
+    }
+
+    bool publish(const T& value)
+    {
+        // The ticket orders the writes by start, the write that started last wins whatever the order they finish in
+        const uint32_t ticket = (tickets.fetch_add(1, std::memory_order_relaxed) + 1) & TICKET_MASK;
+        const uint32_t slot   = reserveSlot();
+        if (slot == SLOTS)
+        {
+            return false;
+        }
+        store(slots[slot], value);
+        uint32_t current   = latest.load(std::memory_order_relaxed);
+        bool     published = false;
+        // Newer if less than half the ticket range ahead of the latest one, so that tickets can wrap around
+        while (((ticket - (current >> SLOT_BITS)) & TICKET_MASK) - 1 < TICKET_MASK / 2)
+        {
+            // Sequentially consistent, so that either the writer sees a blocked reader or the reader sees the new
+            // version
+            if (latest.compare_exchange_weak(current, (ticket << SLOT_BITS) | slot, std::memory_order_seq_cst))
+            {
+                published = true;
+                break;
+            }
+        }
+        writers.fetch_and(~(UINT32_C(1) << slot), std::memory_order_release);
+        return published;
+    }
+
+    /**
+     * @return true once the version differs from the one given, false if the timeout was reached first
+     */
+    bool waitNewer(const uint32_t version, const uint32_t maxTimeToWait_ms)
+    {
+        const uint64_t deadline =
+            maxTimeToWait_ms == UINT32_MAX ? UINT64_MAX : osInterface.osMillis64() + maxTimeToWait_ms;
+
+        // Each blocked reader has its own flag, set by the writers and only cleared by that reader, so that no wakeup
+        // is lost between checking the version and waiting
+        uint32_t bit;
+        uint32_t taken = blockedReaders.load(std::memory_order_relaxed);
+        do
+        {
+            const auto first = static_cast<uint32_t>(std::countr_one(taken)); // First flag no reader has
+            bit              = first < MAX_BLOCKED_READERS ? UINT32_C(1) << first : 0;
+        } while (bit != 0 && !blockedReaders.compare_exchange_weak(taken, taken | bit, std::memory_order_seq_cst));
+        if (bit != 0)
+        {
+            events->clearBits(bit);
+        }
+
+        bool newer = false;
+        for (;;)
+        {
+            if (latest.load(std::memory_order_seq_cst) >> SLOT_BITS != version)
+            {
+                newer = true;
+                break;
+            }
+            const uint64_t now = osInterface.osMillis64();
+            if (now >= deadline)
+            {
+                break;
+            }
+            const uint64_t remaining = deadline == UINT64_MAX ? UINT32_MAX : deadline - now;
+            if (bit != 0)
+            {
+                events->waitBits(bit, OSInterface_EventGroup::WAIT_ANY, true,
+                                 remaining < UINT32_MAX ? static_cast<uint32_t>(remaining) : UINT32_MAX);
+            }
+            else
+            {
+                osInterface.osSleep(1);
+            }
+        }
+
+        if (bit != 0)
+        {
+            blockedReaders.fetch_and(~bit, std::memory_order_relaxed);
+        }
+        return newer;
+    }
+
+    Backend&    osInterface;
+    EventGroup* events;
+
+    std::atomic<uint32_t>             latest{0};  // Version of the latest value, then index of its copy
+    std::atomic<uint32_t>             tickets{0}; // Number of writes started
+    std::atomic<uint32_t>             writers{0}; // One bit per copy reserved by a write in progress
+    Slot                              slots[SLOTS];
+    alignas(64) std::atomic<uint32_t> blockedReaders{0}; // One bit per reader blocked on the event group
+};
+
+#endif // OSINTERFACE_OSINTERFACE_MAILBOX_H
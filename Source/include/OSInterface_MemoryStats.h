@@ -0,0 +1,31 @@
+#ifndef OSINTERFACE_OSINTERFACE_MEMORYSTATS_H
+#define OSINTERFACE_OSINTERFACE_MEMORYSTATS_H
+
+#include <cstdint>
+
+/**
+ * @brief Snapshot of the allocator behind OSInterface::osMalloc()
+ *
+ * Backends that serve small blocks from fixed-size pools report one entry per size class, blocks too large for any
+ * class are only counted in bytesInUse. Counters are read without stopping other threads, so a snapshot taken while
+ * they allocate is only consistent per counter.
+ */
+struct OSInterface_MemoryStats
+{
+    static constexpr uint32_t MAX_SIZE_CLASSES = 16;
+
+    struct SizeClass
+    {
+        uint32_t blockSize;   // Bytes per block, including the allocator's own header
+        uint32_t blocks;      // Blocks taken from the system heap for this class, never given back
+        uint32_t blocksInUse; // Blocks currently allocated
+    };
+
+    uint64_t  bytesInUse;        // Bytes of every block currently allocated, including the headers
+    uint64_t  peakBytesInUse;    // Highest bytesInUse since the start
+    uint64_t  failedAllocations; // Allocations that returned nullptr because memory was exhausted
+    uint32_t  sizeClassCount;    // Number of valid entries in sizeClasses
+    SizeClass sizeClasses[MAX_SIZE_CLASSES];
+};
+
+#endif // OSINTERFACE_OSINTERFACE_MEMORYSTATS_H
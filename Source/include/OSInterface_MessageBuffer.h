@@ -0,0 +1,156 @@
+#ifndef OSINTERFACE_OSINTERFACE_MESSAGEBUFFER_H
+#define OSINTERFACE_OSINTERFACE_MESSAGEBUFFER_H
+
+#include <cstdint>
+
+/**
+ * @brief Thread-safe FIFO of variable-length messages stored back to back in a byte ring
+ *
+ * Unlike OSInterface_UntypedQueue, whose slots all have the size of the largest message, a message only takes its own
+ * length plus a small header, and only its own bytes are copied. Every message is stored contiguously, so it can also
+ * be written and read in place.
+ */
+class OSInterface_MessageBuffer
+{
+public:
+    virtual ~OSInterface_MessageBuffer() = default;
+
+    /**
+     * @brief Get the size of the buffer
+     *
+     * @return uint32_t Bytes of the ring, headers included
+     */
+    [[nodiscard]] virtual uint32_t size() = 0;
+
+    /**
+     * @brief Get the free space of the buffer
+     *
+     * @return uint32_t Bytes of the ring not taken by messages or their headers
+     * @note A message needs its length rounded up to 8 bytes plus an 8-byte header, and a message that does not fit
+     * before the end of the ring also needs the bytes left up to the end.
+     */
+    [[nodiscard]] virtual uint32_t available() = 0;
+
+    /**
+     * @brief Get the length of the longest message the buffer can hold, once empty
+     *
+     * @return uint32_t Maximum message length in bytes
+     */
+    [[nodiscard]] virtual uint32_t maxMessageLength() = 0;
+
+    /**
+     * @brief Get the length of the next message to receive
+     *
+     * @return uint32_t Length of the message in bytes, 0 if the buffer is empty
+     */
+    [[nodiscard]] virtual uint32_t nextLength() = 0;
+
+    /**
+     * @brief Check if the buffer is empty
+     *
+     * @return True if there is no message to receive, false otherwise
+     */
+    [[nodiscard]] virtual bool isEmpty() = 0;
+
+    /**
+     * @brief Discard every message in the buffer
+     *
+     * @note Messages that are being written or read in place are not affected.
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief Copy a message into the buffer
+     *
+     * @param message Pointer to the message
+     * @param length Length of the message in bytes, from 1 to maxMessageLength()
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room
+     * @return True if the message was sent, false if the timeout was reached or the length is invalid
+     */
+    virtual bool send(const void* message, uint32_t length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `send()` that can be called from an interrupt service routine
+     *
+     * @param message Pointer to the message
+     * @param length Length of the message in bytes, from 1 to maxMessageLength()
+     * @return True if the message was sent, false if there was no room or the length is invalid
+     */
+    virtual bool sendFromISR(const void* message, uint32_t length) = 0;
+
+    /**
+     * @brief Copy the oldest message out of the buffer
+     *
+     * @param buffer Destination of the message
+     * @param bufferSize Size of the destination in bytes
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for a message
+     * @return uint32_t Length of the message received, 0 if the timeout was reached
+     * @note If the message is longer than bufferSize, 0 is returned immediately and the message stays in the buffer
+     * (see nextLength()).
+     */
+    virtual uint32_t receive(void* buffer, uint32_t bufferSize, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `receive()` that can be called from an interrupt service routine
+     *
+     * @param buffer Destination of the message
+     * @param bufferSize Size of the destination in bytes
+     * @return uint32_t Length of the message received, 0 if there was none or it is longer than bufferSize
+     */
+    virtual uint32_t receiveFromISR(void* buffer, uint32_t bufferSize) = 0;
+
+    /**
+     * @brief Reserve room for a message so that it can be written directly into the buffer
+     *
+     * @param length Length of the message in bytes, from 1 to maxMessageLength()
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room
+     * @return void* Pointer to the length bytes of the message, aligned to 8 bytes. nullptr if the timeout was
+     * reached or the length is invalid.
+     * @note The message only becomes visible to receivers once commitSend() is called. Every reserved message MUST be
+     * committed, and receivers will not get past an uncommitted message.
+     */
+    virtual void* acquireSend(uint32_t length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `acquireSend()` that can be called from an interrupt service routine
+     *
+     * @param length Length of the message in bytes, from 1 to maxMessageLength()
+     * @return void* Pointer to the length bytes of the message, nullptr if there was no room or the length is invalid
+     */
+    virtual void* acquireSendFromISR(uint32_t length) = 0;
+
+    /**
+     * @brief Publish a message written in place into room returned by acquireSend()
+     *
+     * @param message Pointer returned by acquireSend()
+     */
+    virtual void commitSend(void* message) = 0;
+
+    /**
+     * @brief Take the oldest message so that it can be read directly from the buffer
+     *
+     * @param length Set to the length of the message in bytes
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for a message
+     * @return const void* Pointer to the message, nullptr if the timeout was reached
+     * @note The message is removed from the buffer, but its bytes are not reused until releaseReceive() is called.
+     * Every taken message MUST be released.
+     */
+    virtual const void* peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `peekReceive()` that can be called from an interrupt service routine
+     *
+     * @param length Set to the length of the message in bytes
+     * @return const void* Pointer to the message, nullptr if there was none
+     */
+    virtual const void* peekReceiveFromISR(uint32_t& length) = 0;
+
+    /**
+     * @brief Give back a message returned by peekReceive() once it has been consumed
+     *
+     * @param message Pointer returned by peekReceive()
+     */
+    virtual void releaseReceive(const void* message) = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_MESSAGEBUFFER_H
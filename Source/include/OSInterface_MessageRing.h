@@ -0,0 +1,128 @@
+#ifndef OSINTERFACE_OSINTERFACE_MESSAGERING_H
+#define OSINTERFACE_OSINTERFACE_MESSAGERING_H
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Storage of the OSInterface_MessageBuffer implementations, without any locking
+ *
+ * Every message is an 8-byte header (length and state) followed by its bytes, padded to 8 bytes. A message that does
+ * not fit before the end of the ring goes to its start, and the bytes it skipped are taken by a padding entry, so that
+ * every message is contiguous. Entries keep their place in the ring until they are released, the head only moves past
+ * released entries, so messages can be written and read in place and in any order.
+ */
+class OSInterface_MessageRing
+{
+public:
+    static constexpr uint32_t HEADER_SIZE = 8;
+
+    /**
+     * @param capacity Size of the ring in bytes, rounded down to a multiple of HEADER_SIZE
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    explicit OSInterface_MessageRing(uint32_t capacity);
+
+    OSInterface_MessageRing(const OSInterface_MessageRing&)            = delete;
+    OSInterface_MessageRing& operator=(const OSInterface_MessageRing&) = delete;
+    OSInterface_MessageRing(OSInterface_MessageRing&&)                 = delete;
+    OSInterface_MessageRing& operator=(OSInterface_MessageRing&&)      = delete;
+
+    ~OSInterface_MessageRing() = default;
+
+    /**
+     * @return true if the storage was allocated and can hold a message, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return storage != nullptr && capacity > HEADER_SIZE;
+    }
+
+    [[nodiscard]] uint32_t size() const
+    {
+        return capacity;
+    }
+
+    [[nodiscard]] uint32_t available() const
+    {
+        return capacity - used;
+    }
+
+    [[nodiscard]] uint32_t maxMessageLength() const
+    {
+        return capacity - HEADER_SIZE;
+    }
+
+    [[nodiscard]] bool isEmpty() const
+    {
+        return ready == 0;
+    }
+
+    /**
+     * @brief Take room for a message at the end of the ring
+     *
+     * @param length Length of the message in bytes
+     * @param committed true if the message is written before the ring is used again, false if commit() will publish it
+     * @return uint8_t* Pointer to the bytes of the message, nullptr if there is no room or the length is invalid
+     */
+    uint8_t* reserve(uint32_t length, bool committed);
+
+    /**
+     * @brief Publish a message reserved with committed set to false
+     */
+    void commit(void* message);
+
+    /**
+     * @brief Get the oldest published message that is not being read
+     *
+     * @param length Set to the length of the message in bytes
+     * @return uint8_t* Pointer to the bytes of the message, nullptr if there is none before an unpublished message
+     */
+    const uint8_t* front(uint32_t& length) const;
+
+    /**
+     * @brief Remove a message returned by front() from the messages to receive, without freeing its bytes
+     */
+    void take(const void* message);
+
+    /**
+     * @brief Free the bytes of a message returned by front(), removing it from the messages to receive if needed
+     */
+    void release(const void* message);
+
+    /**
+     * @brief Release every published message that is not being read
+     */
+    void reset();
+
+private:
+    using EntryState = enum : uint32_t {
+        READY,   // Published, not received yet
+        WRITING, // Reserved, not published yet
+        READING, // Taken, not released yet
+        RELEASED // Received, discarded or padding
+    };
+
+    struct Header
+    {
+        uint32_t   length;
+        EntryState state;
+    };
+
+    static_assert(sizeof(Header) == HEADER_SIZE, "The header must keep the messages aligned to HEADER_SIZE");
+
+    [[nodiscard]] static uint32_t entrySize(uint32_t length);
+    [[nodiscard]] Header*         headerAt(uint32_t offset) const;
+    [[nodiscard]] static Header*  headerOf(const void* message);
+
+    void skipReleased();
+
+    const uint32_t              capacity;
+    std::unique_ptr<uint64_t[]> storage; // uint64_t keeps the headers and the messages aligned
+    uint32_t                    head{0}; // Offset of the oldest entry
+    uint32_t                    tail{0}; // Offset of the next entry
+    uint32_t                    used{0}; // Bytes from head to tail
+    uint32_t                    ready{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_MESSAGERING_H
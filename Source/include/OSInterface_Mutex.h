@@ -6,6 +6,12 @@
 class OSInterface_Mutex
 {
 public:
+    /**
+     * BLOCKING mutexes put waiters to sleep right away. ADAPTIVE mutexes first spin for a short while, which is faster
+     * when the mutex only guards very short critical sections and the owner runs on another core.
+     */
+    using Mode = enum { BLOCKING, ADAPTIVE };
+
     virtual ~OSInterface_Mutex() = default;
 
     /**
@@ -22,6 +28,81 @@ public:
      * @return True if the mutex was acquired, false if the timeout was reached.
      */
     virtual bool wait(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait for the mutex to be available, with a timeout in microseconds
+     *
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return True if the mutex was acquired, false if the timeout was reached.
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool waitMicros(const uint32_t maxTimeToWait_us)
+    {
+        return wait(maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+    /**
+     * @brief Name the mutex in the instrumentation reports
+     *
+     * @param name Name of the mutex, must outlive it (string literal)
+     * @note Does nothing unless the implementation is instrumented (OSInterface_INSTRUMENTATION).
+     */
+    virtual void setName(const char* /*name*/)
+    {
+    }
+};
+
+/**
+ * @brief Holds a mutex for the lifetime of the guard
+ *
+ * @tparam Mutex OSInterface_Mutex or one of its implementations, whose calls are then not virtual
+ */
+template <typename Mutex> class OSInterface_MutexGuard
+{
+public:
+    /**
+     * @brief Lock the mutex, waiting as long as needed
+     */
+    explicit OSInterface_MutexGuard(Mutex& mutex) : mutex(mutex), locked(true)
+    {
+        while (!mutex.wait(UINT32_MAX))
+        {
+        }
+    }
+
+    /**
+     * @brief Try to lock the mutex within a timeout
+     *
+     * @note Check isLocked() before entering the critical section.
+     */
+    OSInterface_MutexGuard(Mutex& mutex, const uint32_t maxTimeToWait_ms) :
+        mutex(mutex), locked(mutex.wait(maxTimeToWait_ms))
+    {
+    }
+
+    OSInterface_MutexGuard(const OSInterface_MutexGuard&)            = delete;
+    OSInterface_MutexGuard& operator=(const OSInterface_MutexGuard&) = delete;
+    OSInterface_MutexGuard(OSInterface_MutexGuard&&)                 = delete;
+    OSInterface_MutexGuard& operator=(OSInterface_MutexGuard&&)      = delete;
+
+    ~OSInterface_MutexGuard()
+    {
+        if (locked)
+        {
+            mutex.signal();
+        }
+    }
+
+    /**
+     * @return true if the guard holds the mutex, false if the timeout was reached
+     */
+    [[nodiscard]] bool isLocked() const
+    {
+        return locked;
+    }
+
+private:
+    Mutex&     mutex;
+    const bool locked;
 };
 
 #endif // OSINTERFACE_OSINTERFACE_MUTEX_H
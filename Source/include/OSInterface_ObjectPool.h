@@ -0,0 +1,111 @@
+#ifndef OSINTERFACE_OSINTERFACE_OBJECTPOOL_H
+#define OSINTERFACE_OSINTERFACE_OBJECTPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "OSInterface.h"
+
+/**
+ * @brief Typed pool for frequently recycled objects
+ *
+ * Objects are constructed in blocks from OSInterface::osMalloc(). Backends serving small blocks from fixed-size pools
+ * recycle a destroyed object's block for the next object of the same size, without fragmenting the system heap.
+ *
+ * @note Every object must be destroyed by the pool that created it, before the pool is deleted.
+ *
+ * @tparam T The type of objects in the pool
+ */
+template <typename T> class OSInterface::OSInterface_ObjectPool
+{
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "osMalloc() only guarantees fundamental alignment");
+
+    /**
+     * @brief Create an object pool
+     *
+     * @param osInterface Reference to the OSInterface allocating the objects
+     */
+    explicit OSInterface_ObjectPool(OSInterface& osInterface) : osInterface(osInterface)
+    {
+    }
+
+    OSInterface_ObjectPool(const OSInterface_ObjectPool&)            = delete;
+    OSInterface_ObjectPool& operator=(const OSInterface_ObjectPool&) = delete;
+    OSInterface_ObjectPool(OSInterface_ObjectPool&&)                 = delete;
+    OSInterface_ObjectPool& operator=(OSInterface_ObjectPool&&)      = delete;
+
+    ~OSInterface_ObjectPool()
+    {
+        assert(objectsInUse.load(std::memory_order_relaxed) == 0);
+    }
+
+    /**
+     * @brief Construct an object
+     *
+     * @param args Arguments to pass to the constructor of T
+     * @return T* Pointer to the object, nullptr if no memory is available
+     * @note If the constructor throws, the block goes back to the allocator before the exception propagates.
+     */
+    template <typename... Args> [[nodiscard]] T* create(Args&&... args)
+    {
+        BlockGuard block{osInterface, osInterface.osMalloc(sizeof(T))};
+        if (block.memory == nullptr)
+        {
+            return nullptr;
+        }
+        T* object    = new (block.memory) T(std::forward<Args>(args)...);
+        block.memory = nullptr;
+        objectsInUse.fetch_add(1, std::memory_order_relaxed);
+        return object;
+    }
+
+    /**
+     * @brief Destroy an object created by this pool
+     *
+     * @param object Object to destroy
+     * @note If object is null, the function will do nothing.
+     */
+    void destroy(T* object)
+    {
+        if (object == nullptr)
+        {
+            return;
+        }
+        object->~T();
+        osInterface.osFree(object);
+        objectsInUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of objects created by this pool and not destroyed yet
+     *
+     * @return uint32_t Number of live objects
+     */
+    [[nodiscard]] uint32_t inUse() const
+    {
+        return objectsInUse.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief Frees a block on scope exit unless it was handed over
+     */
+    struct BlockGuard
+    {
+        OSInterface& osInterface;
+        void*        memory;
+
+        ~BlockGuard()
+        {
+            osInterface.osFree(memory);
+        }
+    };
+
+    OSInterface&          osInterface;
+    std::atomic<uint32_t> objectsInUse{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_OBJECTPOOL_H
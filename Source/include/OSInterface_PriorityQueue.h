@@ -0,0 +1,337 @@
+#ifndef OSINTERFACE_OSINTERFACE_PRIORITYQUEUE_H
+#define OSINTERFACE_OSINTERFACE_PRIORITYQUEUE_H
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "OSInterface.h"
+#include "OSInterface_UntypedPriorityQueue.h"
+
+/**
+ * @brief Template wrapper for inter-process, thread-safe priority queues
+ *
+ * Messages are received highest priority first, and in the order they were sent within a priority. Each priority has
+ * its own maxMessages slots, so that a flood of messages of one priority never blocks the senders of another.
+ *
+ * @warning Methods of this class MUST NOT be called if the constructor failed (result is false).
+ *          Calling methods on a queue that failed to construct will result in undefined behavior.
+ *          Always check the result parameter from the constructor before using the queue.
+ *
+ * @tparam T The type of messages to store in the queue
+ * @tparam Backend Implementation creating the queue. By default any OSInterface, and every call goes through the
+ * virtual OSInterface_UntypedPriorityQueue interface. With a final implementation such as OSInterface_Linux, the queue
+ * is its concrete class and the calls are direct (see OSInterface_Static.h).
+ */
+template <typename T, typename Backend> class OSInterface::OSInterface_PriorityQueue
+{
+public:
+    /**
+     * @brief Class of the queue holding the messages, as returned by the factory of the backend
+     */
+    using UntypedQueue = std::remove_pointer_t<decltype(std::declval<Backend&>().osCreatePriorityQueue(0U, 0U, 0U))>;
+
+    /**
+     * @brief Create an inter-thread, thread-safe priority queue
+     *
+     * @param osInterface Reference to the OSInterface to use for creating the queue
+     * @param maxMessages Maximum number of messages of each priority
+     * @param priorityLevels Number of priority levels, from 1 to OSInterface_UntypedPriorityQueue::MAX_PRIORITY_LEVELS
+     * @param result Reference to store the result of the queue creation. True if the queue was created successfully,
+     * false otherwise. MUST be checked before calling any other methods on this object.
+     */
+    OSInterface_PriorityQueue(Backend& osInterface, uint32_t maxMessages, uint32_t priorityLevels, bool& result) :
+        queue(osInterface.osCreatePriorityQueue(maxMessages, sizeof(T), priorityLevels))
+    {
+        result = (queue != nullptr);
+    }
+
+    // Delete copy constructor and copy assignment operator to prevent double-delete issues
+    OSInterface_PriorityQueue(const OSInterface_PriorityQueue&)            = delete;
+    OSInterface_PriorityQueue& operator=(const OSInterface_PriorityQueue&) = delete;
+
+    // Delete move constructor and move assignment operator to prevent ownership transfer issues
+    OSInterface_PriorityQueue(OSInterface_PriorityQueue&&)            = delete;
+    OSInterface_PriorityQueue& operator=(OSInterface_PriorityQueue&&) = delete;
+
+    ~OSInterface_PriorityQueue()
+    {
+        delete queue;
+    }
+
+    /**
+     * @brief Get the number of priority levels
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return uint32_t Number of priority levels, 0 being the lowest priority
+     */
+    [[nodiscard]] uint32_t priorityLevels()
+    {
+        return queue->priorityLevels();
+    }
+
+    /**
+     * @brief Get the number of messages currently in the queue, all priorities included
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return uint32_t Number of messages in the queue
+     */
+    [[nodiscard]] uint32_t length()
+    {
+        return queue->length();
+    }
+
+    /**
+     * @brief Get the number of messages of one priority currently in the queue
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param priority Priority level
+     * @return uint32_t Number of messages of that priority, 0 if the priority is out of range
+     */
+    [[nodiscard]] uint32_t length(uint32_t priority)
+    {
+        return queue->length(priority);
+    }
+
+    /**
+     * @brief Get the number of slots in the queue, all priorities included
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return uint32_t Number of slots in the queue
+     */
+    [[nodiscard]] uint32_t size()
+    {
+        return queue->size();
+    }
+
+    /**
+     * @brief Get the number of empty slots in the queue, all priorities included
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return uint32_t Number of empty slots in the queue
+     */
+    [[nodiscard]] uint32_t available()
+    {
+        return queue->available();
+    }
+
+    /**
+     * @brief Check if the queue is empty
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return true if the queue is empty, false otherwise
+     */
+    [[nodiscard]] bool isEmpty()
+    {
+        return queue->isEmpty();
+    }
+
+    /**
+     * @brief Check if every priority of the queue is full
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return true if the queue is full, false otherwise
+     */
+    [[nodiscard]] bool isFull()
+    {
+        return queue->isFull();
+    }
+
+    /**
+     * @brief Reset the queue, removing all messages
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     */
+    void reset()
+    {
+        queue->reset();
+    }
+
+    /**
+     * @brief Receive the oldest message of the highest priority in the queue
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Reference to store the received message
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if a message was received, false if the timeout was reached
+     */
+    bool receive(T& message, uint32_t maxTimeToWait_ms)
+    {
+        return queue->receive(&message, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Receive the oldest message of the highest priority in the queue, with a timeout in microseconds
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Reference to store the received message
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if a message was received, false if the timeout was reached
+     */
+    bool receiveMicros(T& message, uint32_t maxTimeToWait_us)
+    {
+        return queue->receiveMicros(&message, maxTimeToWait_us);
+    }
+
+    /**
+     * @brief Receive the oldest message of the highest priority in the queue from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Reference to store the received message
+     * @return true if a message was received, false otherwise
+     */
+    bool receiveFromISR(T& message)
+    {
+        return queue->receiveFromISR(&message);
+    }
+
+    /**
+     * @brief Send a message with a priority
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param priority Priority level, from 0 (lowest) to priorityLevels() - 1
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room in that priority
+     * @return true if the message was sent, false if the timeout was reached or the priority is out of range
+     */
+    bool send(const T& message, uint32_t priority, uint32_t maxTimeToWait_ms)
+    {
+        return queue->send(&message, priority, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Send a message with a priority, with a timeout in microseconds
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param priority Priority level, from 0 (lowest) to priorityLevels() - 1
+     * @param maxTimeToWait_us Maximum time to wait in microseconds for room in that priority
+     * @return true if the message was sent, false if the timeout was reached or the priority is out of range
+     */
+    bool sendMicros(const T& message, uint32_t priority, uint32_t maxTimeToWait_us)
+    {
+        return queue->sendMicros(&message, priority, maxTimeToWait_us);
+    }
+
+    /**
+     * @brief Send a message with a priority from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param priority Priority level, from 0 (lowest) to priorityLevels() - 1
+     * @return true if the message was sent, false if that priority is full or out of range
+     */
+    bool sendFromISR(const T& message, uint32_t priority)
+    {
+        return queue->sendFromISR(&message, priority);
+    }
+
+    /**
+     * @brief Send a message ahead of every other, at the front of the highest priority
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room in the highest priority
+     * @return true if the message was sent, false if the timeout was reached
+     */
+    bool sendToFront(const T& message, uint32_t maxTimeToWait_ms)
+    {
+        return queue->sendToFront(&message, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Send a message ahead of every other from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @return true if the message was sent, false if the highest priority is full
+     */
+    bool sendToFrontFromISR(const T& message)
+    {
+        return queue->sendToFrontFromISR(&message);
+    }
+
+    /**
+     * @brief Take the oldest message of the highest priority so that it can be read in place
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return const T* The message, or nullptr if the timeout was reached. It MUST be passed to releaseReceive().
+     */
+    const T* peekReceiveSlot(uint32_t maxTimeToWait_ms)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "In-place access requires a trivially copyable message type");
+        return static_cast<const T*>(queue->peekReceiveSlot(maxTimeToWait_ms));
+    }
+
+    /**
+     * @brief Give back a slot returned by peekReceiveSlot() once the message has been consumed
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param slot Slot returned by peekReceiveSlot()
+     */
+    void releaseReceive(const T* slot)
+    {
+        queue->releaseReceive(slot);
+    }
+
+    /**
+     * @brief Receive several messages from the queue, highest priority first
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Buffer for up to maxMessages messages
+     * @param maxMessages Maximum number of messages to receive
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the first message
+     * @return uint32_t Number of messages received. 0 if the timeout was reached.
+     */
+    uint32_t receiveN(T* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms)
+    {
+        return queue->receiveN(messages, maxMessages, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Receive several messages from the queue, highest priority first, from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Buffer for up to maxMessages messages
+     * @param maxMessages Maximum number of messages to receive
+     * @return uint32_t Number of messages received
+     */
+    uint32_t receiveNFromISR(T* messages, uint32_t maxMessages)
+    {
+        return queue->receiveNFromISR(messages, maxMessages);
+    }
+
+    /**
+     * @brief Receive every message currently in the queue, handing each one to a visitor in place
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param visitor Callable invoked as visitor(const T&), highest priority first, for every drained message. It must
+     * not call methods of this queue.
+     * @return uint32_t Number of messages drained
+     */
+    template <typename Visitor> uint32_t drain(Visitor visitor)
+    {
+        return queue->drain(&visit<Visitor>, &visitor);
+    }
+
+    /**
+     * @brief Get the untyped queue holding the messages, for instance to add it to an OSInterface_WaitSet
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return UntypedQueue* The underlying queue, owned by this object
+     */
+    [[nodiscard]] UntypedQueue* getUntypedQueue()
+    {
+        return queue;
+    }
+
+private:
+    template <typename Visitor> static void visit(const void* message, void* visitor)
+    {
+        (*static_cast<Visitor*>(visitor))(*static_cast<const T*>(message));
+    }
+
+    UntypedQueue* queue;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_PRIORITYQUEUE_H
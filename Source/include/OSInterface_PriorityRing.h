@@ -0,0 +1,138 @@
+#ifndef OSINTERFACE_OSINTERFACE_PRIORITYRING_H
+#define OSINTERFACE_OSINTERFACE_PRIORITYRING_H
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Storage of the OSInterface_UntypedPriorityQueue implementations, without any locking
+ *
+ * Every level owns maxMessages slots, a stack of its free slots and a ring of the indexes of its queued slots. Queuing
+ * moves an index rather than a message, so a slot keeps its bytes from the moment it is reserved until it is released,
+ * and messages can be written and read in place. Bit n of a bitmap is set while level n has queued slots, so the
+ * highest level to take from is found with a single bit scan.
+ */
+class OSInterface_PriorityRing
+{
+public:
+    static constexpr uint32_t MAX_LEVELS = 32;
+
+    /**
+     * @param levels Number of priority levels, from 1 to MAX_LEVELS
+     * @param maxMessages Number of slots of each level
+     * @param messageSize Size of each slot in bytes
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    OSInterface_PriorityRing(uint32_t levels, uint32_t maxMessages, uint32_t messageSize);
+
+    OSInterface_PriorityRing(const OSInterface_PriorityRing&)            = delete;
+    OSInterface_PriorityRing& operator=(const OSInterface_PriorityRing&) = delete;
+    OSInterface_PriorityRing(OSInterface_PriorityRing&&)                 = delete;
+    OSInterface_PriorityRing& operator=(OSInterface_PriorityRing&&)      = delete;
+
+    ~OSInterface_PriorityRing() = default;
+
+    /**
+     * @return true if the storage was allocated and the parameters are valid, false otherwise
+     */
+    [[nodiscard]] bool isValid() const;
+
+    [[nodiscard]] uint32_t levelCount() const
+    {
+        return levels;
+    }
+
+    [[nodiscard]] uint32_t messageLength() const
+    {
+        return messageSize;
+    }
+
+    /**
+     * @return uint32_t Slots of every level
+     */
+    [[nodiscard]] uint32_t size() const
+    {
+        return levels * maxMessages;
+    }
+
+    /**
+     * @return uint32_t Free slots of every level
+     */
+    [[nodiscard]] uint32_t available() const
+    {
+        return freeTotal;
+    }
+
+    /**
+     * @return uint32_t Queued slots of every level
+     */
+    [[nodiscard]] uint32_t length() const
+    {
+        return queuedTotal;
+    }
+
+    /**
+     * @return uint32_t Queued slots of a level
+     */
+    [[nodiscard]] uint32_t length(uint32_t level) const;
+
+    /**
+     * @return uint32_t Level of a slot returned by reserve() or take()
+     */
+    [[nodiscard]] uint32_t levelOf(const void* slot) const;
+
+    /**
+     * @brief Take a free slot of a level
+     *
+     * @return uint8_t* The slot, to pass to queue() or release(), nullptr if the level has no free slot
+     */
+    uint8_t* reserve(uint32_t level);
+
+    /**
+     * @brief Queue a slot returned by reserve() at its level
+     *
+     * @param toFront true to queue it ahead of the other slots of the level, false behind them
+     */
+    void queue(void* slot, bool toFront);
+
+    /**
+     * @brief Remove the first slot of the highest level holding any
+     *
+     * @return uint8_t* The slot, to pass to release(), nullptr if no slot is queued
+     */
+    uint8_t* take();
+
+    /**
+     * @brief Give back a slot returned by reserve() or take() to the free slots of its level
+     */
+    void release(const void* slot);
+
+    /**
+     * @brief Release every queued slot, the slots reserved or taken are not affected
+     */
+    void reset();
+
+private:
+    struct Level
+    {
+        uint32_t head{0};      // Position of the first queued slot in the ring of the level
+        uint32_t queued{0};    // Slots in the ring of the level
+        uint32_t freeCount{0}; // Slots in the free stack of the level
+    };
+
+    [[nodiscard]] uint8_t* slotAddress(uint32_t slot) const;
+    [[nodiscard]] uint32_t slotIndex(const void* address) const;
+
+    const uint32_t              levels;
+    const uint32_t              maxMessages;
+    const uint32_t              messageSize;
+    std::unique_ptr<uint8_t[]>  storage;
+    std::unique_ptr<uint32_t[]> rings;       // maxMessages slot indexes per level
+    std::unique_ptr<uint32_t[]> freeSlots;   // maxMessages slot indexes per level
+    std::unique_ptr<Level[]>    levelState;  // One per level
+    uint32_t                    nonEmpty{0}; // Bit n set while level n has queued slots
+    uint32_t                    queuedTotal{0};
+    uint32_t                    freeTotal{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_PRIORITYRING_H
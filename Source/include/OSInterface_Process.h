@@ -0,0 +1,61 @@
+#ifndef OSINTERFACE_OSINTERFACE_PROCESS_H
+#define OSINTERFACE_OSINTERFACE_PROCESS_H
+
+#include <cstdint>
+
+/**
+ * @brief How and where a process started with OSInterface::osRunProcess() runs
+ *
+ * Default-constructed attributes ask for nothing in particular: the process runs on any CPU, with the scheduling of
+ * its creator and the default stack of the platform. Backends that cannot honor an attribute ignore it, unless its
+ * documentation says otherwise.
+ */
+struct OSInterface_ProcessAttributes
+{
+    using Policy = enum {
+        INHERIT,  // Scheduling policy and priority of the creating process
+        NORMAL,   // Time-sharing (SCHED_OTHER on Linux), priority is ignored
+        REAL_TIME // Fixed priority, first in first out among equal priorities (SCHED_FIFO on Linux)
+    };
+
+    const char* name{nullptr};      // Name of the process, can be nullptr
+    uint64_t    affinityMask{0};    // Bit n allows the process to run on CPU n, 0 allows every CPU
+    Policy      policy{INHERIT};    // Scheduling policy
+    int32_t     priority{0};        // REAL_TIME priority, higher runs first (1 to 99 on Linux)
+    uint32_t    stackSize{0};       // Stack size in bytes, 0 for the default of the platform
+    bool        lockedStack{false}; // Pre-fault the stack and lock it in memory, so that it never causes page faults
+};
+
+/**
+ * @brief Handle of a process started with OSInterface::osRunProcess() and attributes
+ */
+class OSInterface_Process
+{
+public:
+    /**
+     * @note Deleting a handle waits for its process to return, so it must not be deleted from the process itself.
+     */
+    virtual ~OSInterface_Process() = default;
+
+    /**
+     * @brief Wait for the process to return
+     */
+    virtual void join() = 0;
+
+    /**
+     * @brief Wait for the process to return, within a timeout
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return True if the process has returned, false if the timeout was reached.
+     */
+    virtual bool join(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Check if the process has returned
+     *
+     * @return True if the process has returned, false otherwise.
+     */
+    [[nodiscard]] virtual bool isDone() = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_PROCESS_H
@@ -1,7 +1,10 @@
 #ifndef OSINTERFACE_OSINTERFACE_QUEUE_H
 #define OSINTERFACE_OSINTERFACE_QUEUE_H
 
+#include <concepts>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 #include "OSInterface.h"
 #include "OSInterface_UntypedQueue.h"
 
@@ -13,10 +16,34 @@
  *          Always check the result parameter from the constructor before using the queue.
  *
  * @tparam T The type of messages to store in the queue
+ * @tparam Backend Implementation creating the queue. By default any OSInterface, and every call goes through the
+ * virtual OSInterface_UntypedQueue interface. With a final implementation such as OSInterface_Linux, the queue is its
+ * concrete class and the calls are direct (see OSInterface_Static.h).
+ * @tparam Untyped Class of the queue holding the messages, void for the one osCreateUntypedQueue() returns. A backend
+ * with several final queue classes creates the others with osCreateUntypedQueue<Untyped>(), such as
+ * OSInterface_Linux for the lock-free queues of its access patterns: `OSInterface_Queue<T, OSInterface_Linux,
+ * OSInterface_LinuxSPSCQueue>` calls the single-producer single-consumer queue directly.
  */
-template <typename T> class OSInterface::OSInterface_Queue
+template <typename T, typename Backend, typename Untyped> class OSInterface::OSInterface_Queue
 {
 public:
+    /**
+     * @brief Class of the queue holding the messages, as returned by the factory of the backend
+     */
+    using UntypedQueue = std::conditional_t<
+        std::is_void_v<Untyped>,
+        std::remove_pointer_t<decltype(std::declval<Backend&>().osCreateUntypedQueue(0U, 0U))>, Untyped>;
+
+    /**
+     * @brief Whether the backend returns the queues created for an access pattern as UntypedQueue. It does with
+     * OSInterface and OSInterface_Sim, but not with OSInterface_Linux, whose lock-free queues are other classes: name
+     * the class as Untyped instead.
+     */
+    static constexpr bool HAS_ACCESS_PATTERNS = std::convertible_to<
+        decltype(std::declval<Backend&>().osCreateUntypedQueue(
+            0U, 0U, std::declval<OSInterface_UntypedQueue::AccessPattern>())),
+        UntypedQueue*>;
+
     /**
      * @brief Create an inter-thread, thread-safe message queue
      *
@@ -25,8 +52,26 @@ public:
      * @param result Reference to store the result of the queue creation. True if the queue was created successfully,
      * false otherwise. MUST be checked before calling any other methods on this object.
      */
-    OSInterface_Queue(OSInterface& osInterface, uint32_t maxMessages, bool& result) :
-        queue(osInterface.osCreateUntypedQueue(maxMessages, sizeof(T)))
+    OSInterface_Queue(Backend& osInterface, uint32_t maxMessages, bool& result) :
+        queue(create(osInterface, maxMessages))
+    {
+        result = (queue != nullptr);
+    }
+
+    /**
+     * @brief Create an inter-thread message queue for a guaranteed producer/consumer pattern
+     *
+     * @param osInterface Reference to the OSInterface to use for creating the queue
+     * @param maxMessages Maximum number of messages in the queue
+     * @param accessPattern Producer/consumer pattern the caller guarantees for the lifetime of the queue
+     * @param result Reference to store the result of the queue creation. True if the queue was created successfully,
+     * false otherwise. MUST be checked before calling any other methods on this object.
+     * @note Only available if HAS_ACCESS_PATTERNS is true.
+     */
+    OSInterface_Queue(Backend& osInterface, uint32_t maxMessages,
+                      OSInterface_UntypedQueue::AccessPattern accessPattern, bool& result)
+        requires HAS_ACCESS_PATTERNS
+        : queue(osInterface.osCreateUntypedQueue(maxMessages, sizeof(T), accessPattern))
     {
         result = (queue != nullptr);
     }
@@ -122,6 +167,19 @@ public:
         return queue->receive(&message, maxTimeToWait_ms);
     }
 
+    /**
+     * @brief Receive a message from the queue, with a timeout in microseconds
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Reference to store the received message
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if a message was received, false if the timeout was reached
+     */
+    bool receiveMicros(T& message, uint32_t maxTimeToWait_us)
+    {
+        return queue->receiveMicros(&message, maxTimeToWait_us);
+    }
+
     /**
      * @brief Receive a message from the queue from an ISR
      *
@@ -147,6 +205,19 @@ public:
         return queue->sendToBack(&message, maxTimeToWait_ms);
     }
 
+    /**
+     * @brief Send a message to the back of the queue, with a timeout in microseconds
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if the message was sent, false if the timeout was reached
+     */
+    bool sendToBackMicros(const T& message, uint32_t maxTimeToWait_us)
+    {
+        return queue->sendToBackMicros(&message, maxTimeToWait_us);
+    }
+
     /**
      * @brief Send a message to the back of the queue from an ISR
      *
@@ -172,6 +243,19 @@ public:
         return queue->sendToFront(&message, maxTimeToWait_ms);
     }
 
+    /**
+     * @brief Send a message to the front of the queue, with a timeout in microseconds
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param message Message to send
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if the message was sent, false if the timeout was reached
+     */
+    bool sendToFrontMicros(const T& message, uint32_t maxTimeToWait_us)
+    {
+        return queue->sendToFrontMicros(&message, maxTimeToWait_us);
+    }
+
     /**
      * @brief Send a message to the front of the queue from an ISR
      *
@@ -184,8 +268,164 @@ public:
         return queue->sendToFrontFromISR(&message);
     }
 
+    /**
+     * @brief Reserve the slot at the back of the queue so that a message can be constructed in place
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return T* The reserved slot, or nullptr if the timeout was reached. It MUST be passed to commitSend().
+     */
+    T* acquireSendSlot(uint32_t maxTimeToWait_ms)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "In-place access requires a trivially copyable message type");
+        return static_cast<T*>(queue->acquireSendSlot(maxTimeToWait_ms));
+    }
+
+    /**
+     * @brief Publish a message written in place into a slot returned by acquireSendSlot()
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param slot Slot returned by acquireSendSlot()
+     */
+    void commitSend(T* slot)
+    {
+        queue->commitSend(slot);
+    }
+
+    /**
+     * @brief Take the message at the front of the queue so that it can be read in place
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return const T* The message, or nullptr if the timeout was reached. It MUST be passed to releaseReceive().
+     */
+    const T* peekReceiveSlot(uint32_t maxTimeToWait_ms)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "In-place access requires a trivially copyable message type");
+        return static_cast<const T*>(queue->peekReceiveSlot(maxTimeToWait_ms));
+    }
+
+    /**
+     * @brief Give back a slot returned by peekReceiveSlot() once the message has been consumed
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param slot Slot returned by peekReceiveSlot()
+     */
+    void releaseReceive(const T* slot)
+    {
+        queue->releaseReceive(slot);
+    }
+
+    /**
+     * @brief Send several messages to the back of the queue
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Array of count messages
+     * @param count Number of messages to send
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room for the first message
+     * @return uint32_t Number of messages sent, in order, from the start of the array. 0 if the timeout was reached.
+     */
+    uint32_t sendToBackN(const T* messages, uint32_t count, uint32_t maxTimeToWait_ms)
+    {
+        return queue->sendToBackN(messages, count, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Send several messages to the back of the queue from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Array of count messages
+     * @param count Number of messages to send
+     * @return uint32_t Number of messages sent, in order, from the start of the array
+     */
+    uint32_t sendToBackNFromISR(const T* messages, uint32_t count)
+    {
+        return queue->sendToBackNFromISR(messages, count);
+    }
+
+    /**
+     * @brief Receive several messages from the queue
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Buffer for up to maxMessages messages
+     * @param maxMessages Maximum number of messages to receive
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the first message
+     * @return uint32_t Number of messages received. 0 if the timeout was reached.
+     */
+    uint32_t receiveN(T* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms)
+    {
+        return queue->receiveN(messages, maxMessages, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Receive several messages from the queue from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param messages Buffer for up to maxMessages messages
+     * @param maxMessages Maximum number of messages to receive
+     * @return uint32_t Number of messages received
+     */
+    uint32_t receiveNFromISR(T* messages, uint32_t maxMessages)
+    {
+        return queue->receiveNFromISR(messages, maxMessages);
+    }
+
+    /**
+     * @brief Receive every message currently in the queue, handing each one to a visitor in place
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param visitor Callable invoked as visitor(const T&), in order, for every drained message. It must not call
+     * methods of this queue.
+     * @return uint32_t Number of messages drained
+     */
+    template <typename Visitor> uint32_t drain(Visitor visitor)
+    {
+        return queue->drain(&visit<Visitor>, &visitor);
+    }
+
+    /**
+     * @brief Receive every message currently in the queue, handing each one to a visitor in place, from an ISR
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @param visitor Callable invoked as visitor(const T&), in order, for every drained message. It must not call
+     * methods of this queue.
+     * @return uint32_t Number of messages drained
+     */
+    template <typename Visitor> uint32_t drainFromISR(Visitor visitor)
+    {
+        return queue->drainFromISR(&visit<Visitor>, &visitor);
+    }
+
+    /**
+     * @brief Get the untyped queue holding the messages, for instance to add it to an OSInterface_WaitSet
+     *
+     * @pre Queue must have been successfully constructed (constructor result was true)
+     * @return UntypedQueue* The underlying queue, owned by this object
+     */
+    [[nodiscard]] UntypedQueue* getUntypedQueue()
+    {
+        return queue;
+    }
+
 private:
-    OSInterface_UntypedQueue* queue;
+    static UntypedQueue* create(Backend& osInterface, const uint32_t maxMessages)
+    {
+        if constexpr (std::is_void_v<Untyped>)
+        {
+            return osInterface.osCreateUntypedQueue(maxMessages, sizeof(T));
+        }
+        else
+        {
+            return osInterface.template osCreateUntypedQueue<Untyped>(maxMessages, sizeof(T));
+        }
+    }
+
+    template <typename Visitor> static void visit(const void* message, void* visitor)
+    {
+        (*static_cast<Visitor*>(visitor))(*static_cast<const T*>(message));
+    }
+
+    UntypedQueue* queue;
 };
 
 #endif // OSINTERFACE_OSINTERFACE_QUEUE_H
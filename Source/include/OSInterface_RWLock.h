@@ -0,0 +1,177 @@
+#ifndef OSINTERFACE_OSINTERFACE_RWLOCK_H
+#define OSINTERFACE_OSINTERFACE_RWLOCK_H
+
+#include <cstdint>
+
+/**
+ * @brief Reader-writer lock: any number of readers, or a single writer, hold it at once
+ *
+ * A waiting writer keeps new readers out, so a steady stream of readers cannot starve writers.
+ *
+ * @note The lock is not recursive, and a read lock must be released by the thread that took it.
+ */
+class OSInterface_RWLock
+{
+public:
+    virtual ~OSInterface_RWLock() = default;
+
+    /**
+     * @brief Wait for the lock to be available for reading
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return True if the lock was acquired for reading, false if the timeout was reached.
+     */
+    virtual bool waitRead(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait for the lock to be available for reading, with a timeout in microseconds
+     *
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return True if the lock was acquired for reading, false if the timeout was reached.
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool waitReadMicros(const uint32_t maxTimeToWait_us)
+    {
+        return waitRead(maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+
+    /**
+     * @brief Release the lock taken with waitRead()
+     */
+    virtual void signalRead() = 0;
+
+    /**
+     * @brief Wait for the lock to be available for writing
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return True if the lock was acquired for writing, false if the timeout was reached.
+     */
+    virtual bool waitWrite(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Wait for the lock to be available for writing, with a timeout in microseconds
+     *
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return True if the lock was acquired for writing, false if the timeout was reached.
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool waitWriteMicros(const uint32_t maxTimeToWait_us)
+    {
+        return waitWrite(maxTimeToWait_us / 1000 + (maxTimeToWait_us % 1000 != 0 ? 1 : 0));
+    }
+
+    /**
+     * @brief Release the lock taken with waitWrite()
+     */
+    virtual void signalWrite() = 0;
+};
+
+/**
+ * @brief Holds a reader-writer lock for reading for the lifetime of the guard
+ *
+ * @tparam RWLock OSInterface_RWLock or one of its implementations, whose calls are then not virtual
+ */
+template <typename RWLock> class OSInterface_ReadGuard
+{
+public:
+    /**
+     * @brief Lock for reading, waiting as long as needed
+     */
+    explicit OSInterface_ReadGuard(RWLock& lock) : lock(lock), locked(true)
+    {
+        while (!lock.waitRead(UINT32_MAX))
+        {
+        }
+    }
+
+    /**
+     * @brief Try to lock for reading within a timeout
+     *
+     * @note Check isLocked() before entering the critical section.
+     */
+    OSInterface_ReadGuard(RWLock& lock, const uint32_t maxTimeToWait_ms) :
+        lock(lock), locked(lock.waitRead(maxTimeToWait_ms))
+    {
+    }
+
+    OSInterface_ReadGuard(const OSInterface_ReadGuard&)            = delete;
+    OSInterface_ReadGuard& operator=(const OSInterface_ReadGuard&) = delete;
+    OSInterface_ReadGuard(OSInterface_ReadGuard&&)                 = delete;
+    OSInterface_ReadGuard& operator=(OSInterface_ReadGuard&&)      = delete;
+
+    ~OSInterface_ReadGuard()
+    {
+        if (locked)
+        {
+            lock.signalRead();
+        }
+    }
+
+    /**
+     * @return true if the guard holds the lock, false if the timeout was reached
+     */
+    [[nodiscard]] bool isLocked() const
+    {
+        return locked;
+    }
+
+private:
+    RWLock&    lock;
+    const bool locked;
+};
+
+/**
+ * @brief Holds a reader-writer lock for writing for the lifetime of the guard
+ *
+ * @tparam RWLock OSInterface_RWLock or one of its implementations, whose calls are then not virtual
+ */
+template <typename RWLock> class OSInterface_WriteGuard
+{
+public:
+    /**
+     * @brief Lock for writing, waiting as long as needed
+     */
+    explicit OSInterface_WriteGuard(RWLock& lock) : lock(lock), locked(true)
+    {
+        while (!lock.waitWrite(UINT32_MAX))
+        {
+        }
+    }
+
+    /**
+     * @brief Try to lock for writing within a timeout
+     *
+     * @note Check isLocked() before entering the critical section.
+     */
+    OSInterface_WriteGuard(RWLock& lock, const uint32_t maxTimeToWait_ms) :
+        lock(lock), locked(lock.waitWrite(maxTimeToWait_ms))
+    {
+    }
+
+    OSInterface_WriteGuard(const OSInterface_WriteGuard&)            = delete;
+    OSInterface_WriteGuard& operator=(const OSInterface_WriteGuard&) = delete;
+    OSInterface_WriteGuard(OSInterface_WriteGuard&&)                 = delete;
+    OSInterface_WriteGuard& operator=(OSInterface_WriteGuard&&)      = delete;
+
+    ~OSInterface_WriteGuard()
+    {
+        if (locked)
+        {
+            lock.signalWrite();
+        }
+    }
+
+    /**
+     * @return true if the guard holds the lock, false if the timeout was reached
+     */
+    [[nodiscard]] bool isLocked() const
+    {
+        return locked;
+    }
+
+private:
+    RWLock&    lock;
+    const bool locked;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_RWLOCK_H
@@ -0,0 +1,102 @@
+#ifndef OSINTERFACE_OSINTERFACE_STATIC_H
+#define OSINTERFACE_OSINTERFACE_STATIC_H
+
+#include <concepts>
+#include <type_traits>
+#include "OSInterface.h"
+
+/**
+ * @file
+ * @brief Compile-time selection of the OSInterface implementation
+ *
+ * Through the OSInterface API, every operation is an indirect call that the compiler cannot inline, however short the
+ * operation is. The implementations of this library are final classes whose factories return their own final classes
+ * (OSInterface_Linux::osCreateMutex() returns an OSInterface_LinuxMutex*...), so code that knows the implementation at
+ * compile time calls the primitives directly and inlines their fast paths, with the same source as the virtual API:
+ *
+ * - Templates take the implementation as a parameter and name the primitives with OSInterface_Types, such as
+ *   `typename OSInterface_Types<Backend>::Mutex`. OSInterfaceStaticBackend checks that the calls will not be virtual.
+ * - Other code uses OSInterface_DefaultBackend, the implementation chosen with the OSInterface_STATIC_BACKEND CMake
+ *   cache variable (Linux or Sim), or OSInterface itself when none is.
+ *
+ * With OSInterface as the backend, every type is the interface and the calls are virtual, so a module can be built
+ * either way.
+ */
+
+/**
+ * @brief Any implementation of OSInterface, or OSInterface itself
+ */
+template <typename Backend>
+concept OSInterfaceBackend = std::derived_from<Backend, OSInterface>;
+
+/**
+ * @brief Classes of the objects created by the factories of an OSInterface implementation
+ *
+ * @tparam Backend OSInterface or one of its implementations
+ */
+template <OSInterfaceBackend Backend> class OSInterface_Types
+{
+    static Backend& backend(); // Never defined, only names the results of the factories
+
+public:
+    using Mutex                = std::remove_pointer_t<decltype(backend().osCreateMutex())>;
+    using RWLock               = std::remove_pointer_t<decltype(backend().osCreateRWLock())>;
+    using BinarySemaphore      = std::remove_pointer_t<decltype(backend().osCreateBinarySemaphore())>;
+    using CountingSemaphore    = std::remove_pointer_t<decltype(backend().osCreateCountingSemaphore(1U, 0U))>;
+    using EventGroup           = std::remove_pointer_t<decltype(backend().osCreateEventGroup())>;
+    using Timer                = std::remove_pointer_t<decltype(backend().osCreateTimer(1U, OSInterface_Timer::ONE_SHOT,
+                                                                                        nullptr, nullptr, nullptr))>;
+    using UntypedQueue         = std::remove_pointer_t<decltype(backend().osCreateUntypedQueue(1U, 1U))>;
+    using UntypedPriorityQueue = std::remove_pointer_t<decltype(backend().osCreatePriorityQueue(1U, 1U, 1U))>;
+    using MessageBuffer        = std::remove_pointer_t<decltype(backend().osCreateMessageBuffer(1U))>;
+    using StreamBuffer         = std::remove_pointer_t<decltype(backend().osCreateStreamBuffer(1U, 0U))>;
+    using WaitSet              = std::remove_pointer_t<decltype(backend().osCreateWaitSet())>;
+    using Job                  = std::remove_pointer_t<decltype(backend().osSubmit(nullptr, nullptr))>;
+    using Process              = std::remove_pointer_t<decltype(backend().osRunProcess(
+        nullptr, nullptr, OSInterface_ProcessAttributes{}))>;
+
+    /**
+     * @brief Typed queue of the backend, see OSInterface::OSInterface_Queue
+     */
+    template <typename T> using Queue = OSInterface::OSInterface_Queue<T, Backend>;
+
+    /**
+     * @brief Typed priority queue of the backend, see OSInterface::OSInterface_PriorityQueue
+     */
+    template <typename T> using PriorityQueue = OSInterface::OSInterface_PriorityQueue<T, Backend>;
+};
+
+/**
+ * @brief Implementation of OSInterface whose own calls and the calls on the objects it creates are not virtual
+ *
+ * The implementation and the classes returned by its factories must be final, so that the compiler knows which
+ * methods are called.
+ */
+template <typename Backend>
+concept OSInterfaceStaticBackend =
+    OSInterfaceBackend<Backend> && std::is_final_v<Backend> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::Mutex> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::RWLock> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::BinarySemaphore> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::CountingSemaphore> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::EventGroup> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::Timer> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::UntypedQueue> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::UntypedPriorityQueue> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::MessageBuffer> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::StreamBuffer> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::WaitSet> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::Job> &&
+    std::is_final_v<typename OSInterface_Types<Backend>::Process>;
+
+#if defined(OSInterface_STATIC_BACKEND_LINUX)
+    #include "OSInterface_Linux.h"
+using OSInterface_DefaultBackend = OSInterface_Linux;
+#elif defined(OSInterface_STATIC_BACKEND_SIM)
+    #include "OSInterface_Sim.h"
+using OSInterface_DefaultBackend = OSInterface_Sim;
+#else
+using OSInterface_DefaultBackend = OSInterface;
+#endif
+
+#endif // OSINTERFACE_OSINTERFACE_STATIC_H
@@ -0,0 +1,251 @@
+#ifndef OSINTERFACE_OSINTERFACE_STATICQUEUE_H
+#define OSINTERFACE_OSINTERFACE_STATICQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "OSInterface.h"
+#include "OSInterface_EventCount.h"
+
+/**
+ * @brief Fixed-capacity, heap-free message queue with inline storage
+ *
+ * Unlike OSInterface::OSInterface_Queue<T>, the storage lives inside the object and every method is non-virtual, so
+ * the queue can be placed in static memory, constructed at compile time and cannot fail. It is a lock-free bounded
+ * MPMC ring: every slot carries a sequence number that tells senders and receivers whether it is free or holds a
+ * message, and the capacity is a power of two so that wrapping an index is a mask.
+ *
+ * Calls with a timeout first try the operation, and only then block on one of the two event counts of the queue, that
+ * senders and receivers notify once they made room or queued a message. The event counts of OSInterface_Linux and
+ * OSInterface_Sim are inline too, so that with those backends blocking and notifying are direct calls and a blocked
+ * caller wakes up as soon as its operation can succeed. With the virtual OSInterface, blocked callers retry every
+ * millisecond (see OSInterface_EventCount).
+ *
+ * @note The FromISR variants never block.
+ *
+ * @tparam T The type of messages to store in the queue, must be trivially copyable and default constructible
+ * @tparam N Number of slots, must be a power of two
+ * @tparam Backend Implementation the calls with a timeout wait through
+ */
+template <typename T, uint32_t N, typename Backend = OSInterface> class OSInterface_StaticQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "The capacity must be a power of two");
+    static_assert(N < (UINT32_C(1) << 31), "The capacity must leave room to tell a full queue from an empty one");
+    static_assert(std::is_trivially_copyable_v<T>, "Messages are copied in and out of the queue storage");
+    static_assert(std::is_default_constructible_v<T>, "The queue storage is initialized at construction");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "The queue must be usable from an ISR");
+
+public:
+    /**
+     * @brief Create an empty queue
+     *
+     * @param osInterface Reference to the OSInterface used to wait in calls with a timeout, must outlive the queue
+     */
+    constexpr explicit OSInterface_StaticQueue(Backend& osInterface) :
+        OSInterface_StaticQueue(osInterface, std::make_integer_sequence<uint32_t, N>())
+    {
+    }
+
+    OSInterface_StaticQueue(const OSInterface_StaticQueue&)            = delete;
+    OSInterface_StaticQueue& operator=(const OSInterface_StaticQueue&) = delete;
+    OSInterface_StaticQueue(OSInterface_StaticQueue&&)                 = delete;
+    OSInterface_StaticQueue& operator=(OSInterface_StaticQueue&&)      = delete;
+
+    ~OSInterface_StaticQueue() = default;
+
+    /**
+     * @brief Get the number of messages currently in the queue
+     *
+     * @return uint32_t Number of messages in the queue
+     * @note Messages that are being sent or received concurrently may or may not be counted.
+     */
+    [[nodiscard]] uint32_t length() const
+    {
+        const uint32_t dequeued = dequeuePosition.load(std::memory_order_acquire);
+        const uint32_t enqueued = enqueuePosition.load(std::memory_order_acquire);
+        const uint32_t queued   = enqueued - dequeued;
+        // The positions are read one after the other, a receiver may have moved past the loaded enqueue position
+        return static_cast<int32_t>(queued) < 0 ? 0 : (queued > N ? N : queued);
+    }
+
+    /**
+     * @brief Get the number of slots in the queue
+     *
+     * @return uint32_t Number of slots in the queue
+     */
+    [[nodiscard]] static constexpr uint32_t size()
+    {
+        return N;
+    }
+
+    /**
+     * @brief Get the number of empty slots in the queue
+     *
+     * @return uint32_t Number of empty slots in the queue
+     */
+    [[nodiscard]] uint32_t available() const
+    {
+        return N - length();
+    }
+
+    /**
+     * @brief Check if the queue is empty
+     *
+     * @return true if the queue is empty, false otherwise
+     */
+    [[nodiscard]] bool isEmpty() const
+    {
+        return length() == 0;
+    }
+
+    /**
+     * @brief Check if the queue is full
+     *
+     * @return true if the queue is full, false otherwise
+     */
+    [[nodiscard]] bool isFull() const
+    {
+        return length() == N;
+    }
+
+    /**
+     * @brief Reset the queue, removing all messages
+     *
+     * @note This receives and discards messages until the queue is empty, it must not race with other receivers.
+     */
+    void reset()
+    {
+        T discarded;
+        while (tryReceive(discarded))
+        {
+        }
+    }
+
+    /**
+     * @brief Receive a message from the queue
+     *
+     * @param message Reference to store the received message
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if a message was received, false if the timeout was reached
+     */
+    bool receive(T& message, const uint32_t maxTimeToWait_ms)
+    {
+        return notEmpty.await([this, &message] { return tryReceive(message); }, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Receive a message from the queue from an ISR
+     *
+     * @param message Reference to store the received message
+     * @return true if a message was received, false otherwise
+     */
+    bool receiveFromISR(T& message)
+    {
+        return tryReceive(message);
+    }
+
+    /**
+     * @brief Send a message to the back of the queue
+     *
+     * @param message Message to send
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return true if the message was sent, false if the timeout was reached
+     */
+    bool sendToBack(const T& message, const uint32_t maxTimeToWait_ms)
+    {
+        return notFull.await([this, &message] { return trySend(message); }, maxTimeToWait_ms);
+    }
+
+    /**
+     * @brief Send a message to the back of the queue from an ISR
+     *
+     * @param message Message to send
+     * @return true if the message was sent, false otherwise
+     */
+    bool sendToBackFromISR(const T& message)
+    {
+        return trySend(message);
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence; // Equal to the send position when free, one past it when holding a message
+        T                     message;
+    };
+
+    template <uint32_t... Indexes>
+    constexpr OSInterface_StaticQueue(Backend& osInterface, std::integer_sequence<uint32_t, Indexes...>) :
+        slots{Slot{Indexes, T{}}...}, notEmpty(osInterface), notFull(osInterface)
+    {
+    }
+
+    static constexpr uint32_t MASK = N - 1;
+
+    bool tryReceive(T& message)
+    {
+        uint32_t position = dequeuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot&          slot       = slots[position & MASK];
+            const uint32_t sequence   = slot.sequence.load(std::memory_order_acquire);
+            const auto     difference = static_cast<int32_t>(sequence - (position + 1));
+            if (difference == 0)
+            {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    message = slot.message;
+                    slot.sequence.store(position + N, std::memory_order_release);
+                    notFull.notifyOne();
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Empty
+            }
+            else
+            {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool trySend(const T& message)
+    {
+        uint32_t position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot&          slot       = slots[position & MASK];
+            const uint32_t sequence   = slot.sequence.load(std::memory_order_acquire);
+            const auto     difference = static_cast<int32_t>(sequence - position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.message = message;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    notEmpty.notifyOne();
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Full
+            }
+            else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    Slot                            slots[N];
+    std::atomic<uint32_t>           enqueuePosition{0};
+    std::atomic<uint32_t>           dequeuePosition{0};
+    OSInterface_EventCount<Backend> notEmpty; // Notified after every send
+    OSInterface_EventCount<Backend> notFull;  // Notified after every receive
+};
+
+#endif // OSINTERFACE_OSINTERFACE_STATICQUEUE_H
@@ -0,0 +1,146 @@
+#ifndef OSINTERFACE_OSINTERFACE_STREAMBUFFER_H
+#define OSINTERFACE_OSINTERFACE_STREAMBUFFER_H
+
+#include <cstdint>
+
+/**
+ * @brief Byte stream between one writer and one reader, stored in a byte ring
+ *
+ * The stream has no message boundaries: a receive returns whatever bytes were sent, up to the size of its buffer.
+ * Receivers are only woken up once the stream holds at least the trigger level, so that a writer sending a few bytes
+ * at a time does not wake up the reader for each of them.
+ *
+ * @note Only one thread (or ISR) may send, and only one may receive, at any given time.
+ */
+class OSInterface_StreamBuffer
+{
+public:
+    virtual ~OSInterface_StreamBuffer() = default;
+
+    /**
+     * @brief Get the size of the buffer
+     *
+     * @return uint32_t Maximum number of bytes in the stream
+     */
+    [[nodiscard]] virtual uint32_t size() = 0;
+
+    /**
+     * @brief Get the number of bytes in the stream
+     *
+     * @return uint32_t Bytes sent but not yet received
+     */
+    [[nodiscard]] virtual uint32_t length() = 0;
+
+    /**
+     * @brief Get the free space of the buffer
+     *
+     * @return uint32_t Number of bytes that can be sent without waiting
+     */
+    [[nodiscard]] virtual uint32_t available() = 0;
+
+    /**
+     * @brief Set the number of bytes the stream must hold before a blocked receive returns
+     *
+     * @param triggerLevel Number of bytes, from 1 to size(). 0 is treated as 1.
+     * @return True if the level was set, false if it is larger than the buffer
+     */
+    virtual bool setTriggerLevel(uint32_t triggerLevel) = 0;
+
+    /**
+     * @brief Discard every byte in the stream
+     *
+     * @note Must not be called while the writer or the reader holds a view of the buffer.
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief Copy bytes into the stream
+     *
+     * @param data Bytes to send
+     * @param length Number of bytes to send
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room for every byte
+     * @return uint32_t Number of bytes sent, less than length if the timeout was reached
+     */
+    virtual uint32_t send(const void* data, uint32_t length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `send()` that can be called from an interrupt service routine
+     *
+     * @param data Bytes to send
+     * @param length Number of bytes to send
+     * @return uint32_t Number of bytes sent, as many as there was room for
+     */
+    virtual uint32_t sendFromISR(const void* data, uint32_t length) = 0;
+
+    /**
+     * @brief Copy bytes out of the stream
+     *
+     * @param buffer Destination of the bytes
+     * @param maxLength Maximum number of bytes to receive
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the stream to reach the trigger level
+     * @return uint32_t Number of bytes received. If the timeout was reached, the bytes the stream holds (possibly
+     * none) are received anyway.
+     */
+    virtual uint32_t receive(void* buffer, uint32_t maxLength, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `receive()` that can be called from an interrupt service routine
+     *
+     * @param buffer Destination of the bytes
+     * @param maxLength Maximum number of bytes to receive
+     * @return uint32_t Number of bytes received, whatever the trigger level
+     */
+    virtual uint32_t receiveFromISR(void* buffer, uint32_t maxLength) = 0;
+
+    /**
+     * @brief Get the free bytes following the end of the stream, to write them in place
+     *
+     * @param length Set to the number of contiguous free bytes
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for at least one free byte
+     * @return void* Pointer to the free bytes, nullptr if the timeout was reached
+     * @note The free space may wrap around the end of the ring, the rest is returned by the next call.
+     */
+    virtual void* acquireSend(uint32_t& length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `acquireSend()` that can be called from an interrupt service routine
+     *
+     * @param length Set to the number of contiguous free bytes
+     * @return void* Pointer to the free bytes, nullptr if the buffer is full
+     */
+    virtual void* acquireSendFromISR(uint32_t& length) = 0;
+
+    /**
+     * @brief Append bytes written in place at the pointer returned by acquireSend()
+     *
+     * @param written Number of bytes written, at most the length returned by acquireSend()
+     */
+    virtual void commitSend(uint32_t written) = 0;
+
+    /**
+     * @brief Get the oldest bytes of the stream, to read them in place
+     *
+     * @param length Set to the number of contiguous bytes
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the stream to reach the trigger level
+     * @return const void* Pointer to the bytes, nullptr if the stream is empty once the timeout was reached
+     * @note The bytes may wrap around the end of the ring, the rest is returned by the next call.
+     */
+    virtual const void* peekReceive(uint32_t& length, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `peekReceive()` that can be called from an interrupt service routine
+     *
+     * @param length Set to the number of contiguous bytes
+     * @return const void* Pointer to the bytes, nullptr if the stream is empty
+     */
+    virtual const void* peekReceiveFromISR(uint32_t& length) = 0;
+
+    /**
+     * @brief Remove bytes read in place at the pointer returned by peekReceive()
+     *
+     * @param consumed Number of bytes consumed, at most the length returned by peekReceive()
+     */
+    virtual void releaseReceive(uint32_t consumed) = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_STREAMBUFFER_H
@@ -0,0 +1,97 @@
+#ifndef OSINTERFACE_OSINTERFACE_STREAMRING_H
+#define OSINTERFACE_OSINTERFACE_STREAMRING_H
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Storage of the OSInterface_StreamBuffer implementations, without any locking
+ */
+class OSInterface_StreamRing
+{
+public:
+    /**
+     * @param capacity Size of the ring in bytes
+     * @note Check isValid() after construction, the storage allocation may fail.
+     */
+    explicit OSInterface_StreamRing(uint32_t capacity);
+
+    OSInterface_StreamRing(const OSInterface_StreamRing&)            = delete;
+    OSInterface_StreamRing& operator=(const OSInterface_StreamRing&) = delete;
+    OSInterface_StreamRing(OSInterface_StreamRing&&)                 = delete;
+    OSInterface_StreamRing& operator=(OSInterface_StreamRing&&)      = delete;
+
+    ~OSInterface_StreamRing() = default;
+
+    /**
+     * @return true if the storage was allocated, false otherwise
+     */
+    [[nodiscard]] bool isValid() const
+    {
+        return storage != nullptr && capacity > 0;
+    }
+
+    [[nodiscard]] uint32_t size() const
+    {
+        return capacity;
+    }
+
+    [[nodiscard]] uint32_t length() const
+    {
+        return used;
+    }
+
+    [[nodiscard]] uint32_t available() const
+    {
+        return capacity - used;
+    }
+
+    /**
+     * @brief Append as many bytes as there is room for
+     *
+     * @return uint32_t Number of bytes appended
+     */
+    uint32_t write(const void* data, uint32_t length);
+
+    /**
+     * @brief Remove up to maxLength bytes from the front
+     *
+     * @return uint32_t Number of bytes removed
+     */
+    uint32_t read(void* data, uint32_t maxLength);
+
+    /**
+     * @brief Get the contiguous free bytes at the end of the stream
+     *
+     * @param length Set to the number of bytes, 0 if the ring is full
+     * @note The view stays in place until commitWrite(), whatever is consumed meanwhile.
+     */
+    uint8_t* writeView(uint32_t& length) const;
+
+    /**
+     * @brief Append bytes written into the view returned by writeView()
+     */
+    void commitWrite(uint32_t written);
+
+    /**
+     * @brief Get the contiguous bytes at the front of the stream
+     *
+     * @param length Set to the number of bytes, 0 if the ring is empty
+     */
+    const uint8_t* readView(uint32_t& length) const;
+
+    /**
+     * @brief Remove bytes read from the view returned by readView()
+     */
+    void consume(uint32_t consumed);
+
+    void reset();
+
+private:
+    const uint32_t             capacity;
+    std::unique_ptr<uint8_t[]> storage;
+    uint32_t                   head{0}; // Offset of the first byte
+    uint32_t                   used{0};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_STREAMRING_H
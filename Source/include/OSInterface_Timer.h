@@ -103,6 +103,15 @@ public:
      * running, this value is undefined.
      */
     [[nodiscard]] virtual uint32_t getTimeoutTime() const = 0;
+
+    /**
+     * @brief Get the absolute time when the timer will expire, without wrapping around
+     *
+     * @return uint64_t Absolute time in milliseconds when the timer will expire.
+     * @note This is the absolute time (as returned by osMillis64()) when the timer will expire. If the timer is not
+     * running, this value is undefined.
+     */
+    [[nodiscard]] virtual uint64_t getTimeoutTime64() const = 0;
 };
 
 #endif // OSINTERFACE_OSINTERFACE_TIMER_H
@@ -0,0 +1,461 @@
+#ifndef OSINTERFACE_OSINTERFACE_TOPIC_H
+#define OSINTERFACE_OSINTERFACE_TOPIC_H
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "OSInterface.h"
+
+/**
+ * @brief Publish/subscribe channel delivering every message to every subscriber without copying it
+ *
+ * Messages live in a pool of buffers allocated at construction. A publisher writes a message once into a buffer taken
+ * from the pool (loan() then publish(), or publish(const T&) which copies it in), and the topic keeps the last depth
+ * messages in a ring. Each subscriber only has a cursor into that ring: receiving hands out a pointer to the buffer
+ * and counts a reference to it, and the buffer goes back to the pool once the ring dropped it and every subscriber
+ * released it. Publishing therefore costs the same whatever the number of subscribers, apart from signaling the ones
+ * blocked in receive().
+ *
+ * What happens when a subscriber falls more than depth messages behind is chosen per subscriber (see Policy).
+ *
+ * @warning Methods of this class MUST NOT be called if the constructor failed (result is false).
+ *
+ * @tparam T The type of messages, must be default constructible. Buffers are reused without being destroyed, so a
+ * loaned buffer holds an older message that the publisher overwrites.
+ * @tparam Backend Implementation creating the mutex and semaphores of the topic (see OSInterface_Queue)
+ */
+template <typename T, typename Backend = OSInterface> class OSInterface_Topic
+{
+    static_assert(std::is_default_constructible_v<T>, "The buffers are constructed with the topic");
+
+    using Mutex           = std::remove_pointer_t<decltype(std::declval<Backend&>().osCreateMutex(
+        std::declval<OSInterface_Mutex::Mode>()))>;
+    using BinarySemaphore = std::remove_pointer_t<decltype(std::declval<Backend&>().osCreateBinarySemaphore())>;
+
+public:
+    /**
+     * What a subscriber does when the publishers get more than depth messages ahead of it
+     */
+    using Policy = enum {
+        DROP_OLDEST,   // Lose the messages pushed out of the ring and resume with the oldest one still in it
+        BLOCK,         // Make the publishers wait until the subscriber received the oldest message of the ring
+        SKIP_TO_LATEST // Always receive the newest message, skipping every older one not received yet
+    };
+
+    class Subscriber;
+
+    /**
+     * @brief Create a topic
+     *
+     * @param osInterface Reference to the OSInterface to create the mutex and semaphores with
+     * @param depth Number of most recent messages kept for the subscribers, at least 1
+     * @param maxHeld Maximum number of messages held at once by the subscribers (received and not released yet) and
+     * the publishers (loaned and not published yet). A loan() waits while there are that many.
+     * @param result Reference to store the result of the topic creation. True if the topic was created successfully,
+     * false otherwise. MUST be checked before calling any other methods on this object.
+     */
+    OSInterface_Topic(Backend& osInterface, const uint32_t depth, const uint32_t maxHeld, bool& result) :
+        osInterface(osInterface), depth(depth), bufferCount(depth + maxHeld),
+        mutex(osInterface.osCreateMutex(OSInterface_Mutex::ADAPTIVE)), freed(osInterface.osCreateBinarySemaphore()),
+        read(osInterface.osCreateBinarySemaphore()), buffers(new(std::nothrow) T[bufferCount]),
+        references(new(std::nothrow) uint32_t[bufferCount]), freeBuffers(new(std::nothrow) uint32_t[bufferCount]),
+        ring(new(std::nothrow) Entry[depth > 0 ? depth : 1])
+    {
+        result = depth > 0 && maxHeld > 0 && bufferCount > depth && mutex != nullptr && freed != nullptr &&
+                 read != nullptr && buffers != nullptr && references != nullptr && freeBuffers != nullptr &&
+                 ring != nullptr;
+        if (!result)
+        {
+            return;
+        }
+        for (uint32_t i = 0; i < bufferCount; i++)
+        {
+            references[i]  = 0;
+            freeBuffers[i] = i;
+        }
+        freeCount = bufferCount;
+    }
+
+    OSInterface_Topic(const OSInterface_Topic&)            = delete;
+    OSInterface_Topic& operator=(const OSInterface_Topic&) = delete;
+    OSInterface_Topic(OSInterface_Topic&&)                 = delete;
+    OSInterface_Topic& operator=(OSInterface_Topic&&)      = delete;
+
+    /**
+     * @note Every subscriber must have been deleted before.
+     */
+    ~OSInterface_Topic()
+    {
+        assert(subscriberCount == 0);
+        delete mutex;
+        delete freed;
+        delete read;
+    }
+
+    /**
+     * @brief Add a subscriber, which receives the messages published from now on
+     *
+     * @param policy What the subscriber does when it falls behind
+     * @return Subscriber* The subscriber, to delete to unsubscribe, nullptr if its semaphore could not be created
+     */
+    [[nodiscard]] Subscriber* subscribe(const Policy policy)
+    {
+        BinarySemaphore* semaphore = osInterface.osCreateBinarySemaphore();
+        if (semaphore == nullptr)
+        {
+            return nullptr;
+        }
+        auto* subscriber = new (std::nothrow) Subscriber(*this, policy, semaphore);
+        if (subscriber == nullptr)
+        {
+            delete semaphore;
+            return nullptr;
+        }
+        OSInterface_MutexGuard guard(*mutex);
+        subscriber->cursor = published;
+        subscriberCount++;
+        if (policy == BLOCK)
+        {
+            blockingCount++;
+        }
+        return subscriber;
+    }
+
+    /**
+     * @brief Take a buffer from the pool to write a message in place
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for a buffer to be released
+     * @return T* The buffer, or nullptr if the timeout was reached. It MUST be passed to publish().
+     */
+    [[nodiscard]] T* loan(const uint32_t maxTimeToWait_ms)
+    {
+        const uint64_t         deadline = deadlineOf(maxTimeToWait_ms);
+        OSInterface_MutexGuard guard(*mutex);
+        while (freeCount == 0)
+        {
+            if (!waitUnlocked(*freed, loanersWaiting, deadline))
+            {
+                return nullptr;
+            }
+        }
+        const uint32_t index = freeBuffers[--freeCount];
+        references[index]    = 1;
+        if (freeCount > 0 && loanersWaiting > 0)
+        {
+            freed->signal();
+        }
+        return &buffers[index];
+    }
+
+    /**
+     * @brief Publish a message written into a buffer returned by loan()
+     *
+     * @param message Buffer returned by loan(), given back to the topic even if the message is not published
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the BLOCK subscribers to make room
+     * @return true if the message was published, false if the timeout was reached
+     */
+    bool publish(T* message, const uint32_t maxTimeToWait_ms)
+    {
+        const uint32_t         index    = static_cast<uint32_t>(message - buffers.get());
+        const uint64_t         deadline = deadlineOf(maxTimeToWait_ms);
+        OSInterface_MutexGuard guard(*mutex);
+        while (!hasRoom())
+        {
+            if (!waitUnlocked(*read, publishersWaiting, deadline))
+            {
+                dropReference(index);
+                return false;
+            }
+        }
+        // The reference of the publisher becomes the one of the ring
+        Entry& entry = ring[published % depth];
+        if (published >= depth)
+        {
+            dropReference(entry.buffer);
+        }
+        entry.buffer = index;
+        entry.unread = blockingCount;
+        published++;
+        while (waiting != nullptr)
+        {
+            Subscriber* subscriber = waiting;
+            waiting                = subscriber->nextWaiting;
+            subscriber->isWaiting  = false;
+            subscriber->semaphore->signal();
+        }
+        if (publishersWaiting > 0 && hasRoom())
+        {
+            read->signal();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copy a message into a buffer of the pool and publish it
+     *
+     * @param message Message to publish
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds, for a buffer and then for room in the ring
+     * @return true if the message was published, false if the timeout was reached
+     */
+    bool publish(const T& message, const uint32_t maxTimeToWait_ms)
+    {
+        const uint64_t deadline = deadlineOf(maxTimeToWait_ms);
+        T*             buffer   = loan(maxTimeToWait_ms);
+        if (buffer == nullptr)
+        {
+            return false;
+        }
+        *buffer = message;
+        return publish(buffer, remainingUntil(deadline));
+    }
+
+    /**
+     * @brief Get the number of messages published since the topic was created
+     *
+     * @return uint64_t Number of messages published
+     */
+    [[nodiscard]] uint64_t publishedCount()
+    {
+        OSInterface_MutexGuard guard(*mutex);
+        return published;
+    }
+
+private:
+    static constexpr uint64_t NO_DEADLINE = UINT64_MAX;
+
+    struct Entry
+    {
+        uint32_t buffer{0};
+        uint32_t unread{0}; // Number of BLOCK subscribers that have not received the message yet
+    };
+
+    uint64_t deadlineOf(const uint32_t maxTimeToWait_ms)
+    {
+        return maxTimeToWait_ms == UINT32_MAX ? NO_DEADLINE : osInterface.osMillis64() + maxTimeToWait_ms;
+    }
+
+    uint32_t remainingUntil(const uint64_t deadline)
+    {
+        if (deadline == NO_DEADLINE)
+        {
+            return UINT32_MAX;
+        }
+        const uint64_t now = osInterface.osMillis64();
+        return deadline <= now ? 0 : static_cast<uint32_t>(deadline - now);
+    }
+
+    /**
+     * @brief Release the mutex, wait for a semaphore and take the mutex again
+     *
+     * @param waiters Number of threads waiting for the semaphore, which its signalers check
+     * @return false if the deadline was reached before waiting, true otherwise (the condition must be checked again)
+     */
+    bool waitUnlocked(BinarySemaphore& semaphore, uint32_t& waiters, const uint64_t deadline)
+    {
+        const uint32_t remaining = remainingUntil(deadline);
+        if (remaining == 0)
+        {
+            return false;
+        }
+        waiters++;
+        mutex->signal();
+        semaphore.wait(remaining);
+        while (!mutex->wait(UINT32_MAX))
+        {
+        }
+        waiters--;
+        return true;
+    }
+
+    /**
+     * @return true if the next message can be published without overwriting one a BLOCK subscriber has not received
+     */
+    [[nodiscard]] bool hasRoom() const
+    {
+        return published < depth || ring[published % depth].unread == 0;
+    }
+
+    void dropReference(const uint32_t index)
+    {
+        if (--references[index] > 0)
+        {
+            return;
+        }
+        freeBuffers[freeCount++] = index;
+        if (loanersWaiting > 0)
+        {
+            freed->signal();
+        }
+    }
+
+    Backend&       osInterface;
+    const uint32_t depth;
+    const uint32_t bufferCount;
+
+    Mutex*           mutex;
+    BinarySemaphore* freed; // Signaled when a buffer goes back to the pool
+    BinarySemaphore* read;  // Signaled when the oldest message of the ring was received by every BLOCK subscriber
+
+    // Guarded by the mutex
+    std::unique_ptr<T[]>        buffers;
+    std::unique_ptr<uint32_t[]> references; // Per buffer: the ring, the subscribers holding it or its publisher
+    std::unique_ptr<uint32_t[]> freeBuffers;
+    uint32_t                    freeCount{0};
+    std::unique_ptr<Entry[]>    ring; // Message n is in entry n % depth while n >= published - depth
+    uint64_t                    published{0};
+    uint32_t                    subscriberCount{0};
+    uint32_t                    blockingCount{0};
+    uint32_t                    loanersWaiting{0};
+    uint32_t                    publishersWaiting{0};
+    Subscriber*                 waiting{nullptr}; // Subscribers blocked in receive(), signaled by the next publish()
+};
+
+/**
+ * @brief Cursor of one consumer into an OSInterface_Topic
+ *
+ * @note A subscriber is used by one thread at a time. It must be deleted before its topic, and after it released
+ * every message it received.
+ */
+template <typename T, typename Backend> class OSInterface_Topic<T, Backend>::Subscriber
+{
+public:
+    Subscriber(const Subscriber&)            = delete;
+    Subscriber& operator=(const Subscriber&) = delete;
+    Subscriber(Subscriber&&)                 = delete;
+    Subscriber& operator=(Subscriber&&)      = delete;
+
+    /**
+     * @note Unsubscribes, which lets the publishers overwrite the messages this subscriber had not received.
+     */
+    ~Subscriber()
+    {
+        {
+            OSInterface_MutexGuard guard(*topic.mutex);
+            if (policy == BLOCK)
+            {
+                for (uint64_t n = cursor; n < topic.published; n++)
+                {
+                    topic.ring[n % topic.depth].unread--;
+                }
+                topic.blockingCount--;
+                if (topic.publishersWaiting > 0 && topic.hasRoom())
+                {
+                    topic.read->signal();
+                }
+            }
+            topic.subscriberCount--;
+        }
+        delete semaphore;
+    }
+
+    /**
+     * @brief Receive the next message, in place
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return const T* The message, or nullptr if the timeout was reached. It MUST be passed to release().
+     */
+    [[nodiscard]] const T* receive(const uint32_t maxTimeToWait_ms)
+    {
+        const uint64_t         deadline = topic.deadlineOf(maxTimeToWait_ms);
+        OSInterface_MutexGuard guard(*topic.mutex);
+        while (cursor == topic.published)
+        {
+            const uint32_t remaining = topic.remainingUntil(deadline);
+            if (remaining == 0)
+            {
+                return nullptr;
+            }
+            isWaiting     = true;
+            nextWaiting   = topic.waiting;
+            topic.waiting = this;
+            topic.mutex->signal();
+            semaphore->wait(remaining);
+            while (!topic.mutex->wait(UINT32_MAX))
+            {
+            }
+            if (isWaiting)
+            {
+                // Not signaled by a publish(), take it out of the list
+                Subscriber** link = &topic.waiting;
+                while (*link != this)
+                {
+                    link = &(*link)->nextWaiting;
+                }
+                *link     = nextWaiting;
+                isWaiting = false;
+            }
+        }
+        const uint64_t oldest = topic.published > topic.depth ? topic.published - topic.depth : 0;
+        const uint64_t first  = policy == SKIP_TO_LATEST ? topic.published - 1 : oldest;
+        if (cursor < first)
+        {
+            // A BLOCK subscriber never falls behind the ring
+            missed += first - cursor;
+            cursor = first;
+        }
+        Entry& entry = topic.ring[cursor % topic.depth];
+        cursor++;
+        if (policy == BLOCK && --entry.unread == 0 && topic.publishersWaiting > 0 && topic.hasRoom())
+        {
+            topic.read->signal();
+        }
+        topic.references[entry.buffer]++;
+        return &topic.buffers[entry.buffer];
+    }
+
+    /**
+     * @brief Give back a message returned by receive() once it has been consumed
+     *
+     * @param message Message returned by receive()
+     */
+    void release(const T* message)
+    {
+        OSInterface_MutexGuard guard(*topic.mutex);
+        topic.dropReference(static_cast<uint32_t>(message - topic.buffers.get()));
+    }
+
+    /**
+     * @brief Get the number of messages this subscriber did not receive because it fell behind
+     *
+     * @return uint64_t Number of messages dropped (DROP_OLDEST) or skipped (SKIP_TO_LATEST), always 0 with BLOCK
+     */
+    [[nodiscard]] uint64_t missedCount()
+    {
+        OSInterface_MutexGuard guard(*topic.mutex);
+        return missed;
+    }
+
+    /**
+     * @brief Get the number of messages published and not received yet, including those it will miss
+     *
+     * @return uint64_t Number of pending messages
+     */
+    [[nodiscard]] uint64_t pendingCount()
+    {
+        OSInterface_MutexGuard guard(*topic.mutex);
+        return topic.published - cursor;
+    }
+
+private:
+    friend class OSInterface_Topic;
+
+    Subscriber(OSInterface_Topic& topic, const Policy policy, BinarySemaphore* semaphore) :
+        topic(topic), policy(policy), semaphore(semaphore)
+    {
+    }
+
+    OSInterface_Topic&     topic;
+    const Policy           policy;
+    BinarySemaphore* const semaphore; // Signaled by publish() while the subscriber is in the waiting list
+
+    // Guarded by the mutex of the topic
+    uint64_t    cursor{0}; // Number of the next message to receive
+    uint64_t    missed{0};
+    bool        isWaiting{false};
+    Subscriber* nextWaiting{nullptr};
+};
+
+#endif // OSINTERFACE_OSINTERFACE_TOPIC_H
@@ -0,0 +1,75 @@
+#ifndef OSINTERFACE_OSINTERFACE_UNTYPEDPRIORITYQUEUE_H
+#define OSINTERFACE_OSINTERFACE_UNTYPEDPRIORITYQUEUE_H
+
+#include <cstdint>
+#include "OSInterface_UntypedQueue.h"
+
+/**
+ * @brief Message queue whose receivers get the most urgent message first, whatever the number of messages queued
+ *
+ * Every priority level has its own ring of maxMessages slots, and a bitmap of the levels holding messages gives the
+ * highest one in constant time. Messages of a level are received in the order they were sent, after every message of
+ * the levels above. A full level does not keep the other levels from being sent to, so a backlog of routine messages
+ * never delays an urgent one.
+ *
+ * The methods inherited from OSInterface_UntypedQueue keep their meaning, with these priorities:
+ * - sendToBack(), sendToBackN(), acquireSendSlot() and their variants send at priority 0, the lowest.
+ * - sendToFront() and its variants send ahead of every message, at the front of the highest priority.
+ * - receive(), receiveN(), peekReceiveSlot() and drain() take the messages from the highest priority down.
+ * - size(), available(), length() count the slots and messages of every level, isFull() is true once every level is.
+ */
+class OSInterface_UntypedPriorityQueue : public OSInterface_UntypedQueue
+{
+public:
+    static constexpr uint32_t MAX_PRIORITY_LEVELS = 32; // Levels of the bitmap
+
+    ~OSInterface_UntypedPriorityQueue() override = default;
+
+    /**
+     * @brief Get the number of priority levels
+     *
+     * @return uint32_t Number of levels, priorities go from 0 (lowest) to this number minus one (highest)
+     */
+    [[nodiscard]] virtual uint32_t priorityLevels() = 0;
+
+    /**
+     * @brief Get the number of messages queued at a priority
+     *
+     * @param priority Priority level
+     * @return uint32_t Number of messages of that priority, 0 if the priority is invalid
+     */
+    [[nodiscard]] virtual uint32_t length(uint32_t priority) = 0;
+
+    using OSInterface_UntypedQueue::length;
+
+    /**
+     * @brief Send a message at a priority, behind the messages of the same priority
+     *
+     * @param message Pointer to the message
+     * @param priority Priority of the message, from 0 to priorityLevels() - 1
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room at that priority
+     * @return true if the message was sent, false if the timeout was reached or the priority is invalid
+     */
+    virtual bool send(const void* message, uint32_t priority, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Send a message at a priority, with a timeout in microseconds
+     *
+     * @param message Pointer to the message
+     * @param priority Priority of the message, from 0 to priorityLevels() - 1
+     * @param maxTimeToWait_us Maximum time to wait in microseconds for room at that priority
+     * @return true if the message was sent, false if the timeout was reached or the priority is invalid
+     */
+    virtual bool sendMicros(const void* message, uint32_t priority, uint32_t maxTimeToWait_us) = 0;
+
+    /**
+     * @brief A version of `send()` that can be called from an interrupt service routine
+     *
+     * @param message Pointer to the message
+     * @param priority Priority of the message, from 0 to priorityLevels() - 1
+     * @return true if the message was sent, false if that priority is full or invalid
+     */
+    virtual bool sendFromISR(const void* message, uint32_t priority) = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_UNTYPEDPRIORITYQUEUE_H
@@ -3,9 +3,30 @@
 
 #include <cstdint>
 
+/**
+ * @brief Function called by OSInterface_UntypedQueue::drain() for every drained message
+ *
+ * @param message Pointer to the message inside the queue storage, valid only during the call
+ * @param arg Argument given to drain()
+ */
+using OSInterfaceQueueDrainCallback = void (*)(const void* message, void* arg);
+
 class OSInterface_UntypedQueue
 {
 public:
+    /**
+     * @brief Producer/consumer pattern a caller guarantees when creating a queue
+     *
+     * A "single" producer (consumer) means that at most one thread (or ISR) calls the send (receive) methods at any
+     * given time. Implementations may use the guarantee to pick a lock-free queue.
+     */
+    using AccessPattern = enum {
+        MULTI_PRODUCER_MULTI_CONSUMER,
+        MULTI_PRODUCER_SINGLE_CONSUMER,
+        SINGLE_PRODUCER_MULTI_CONSUMER,
+        SINGLE_PRODUCER_SINGLE_CONSUMER
+    };
+
     virtual ~OSInterface_UntypedQueue() = default;
 
     /**
@@ -45,6 +66,9 @@ public:
 
     /**
      * @brief Reset the queue, removing all messages
+     *
+     * @note For queues created with an AccessPattern, reset() counts as a receive and must respect the consumer side
+     * of the pattern.
      */
     virtual void reset() = 0;
 
@@ -58,6 +82,20 @@ public:
      */
     virtual bool receive(void* message, uint32_t maxTimeToWait_ms) = 0;
 
+    /**
+     * @brief Receive a message from the queue, with a timeout in microseconds
+     *
+     * @param message Pointer to buffer to store the received message. The message buffer must be of size messageSize
+     * specified during queue creation.
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if a message was received, false if the timeout was reached
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool receiveMicros(void* message, const uint32_t maxTimeToWait_us)
+    {
+        return receive(message, millisFromMicros(maxTimeToWait_us));
+    }
+
     /**
      * @brief Receive a message from the queue from an ISR
      *
@@ -76,6 +114,19 @@ public:
      */
     virtual bool sendToBack(const void* message, uint32_t maxTimeToWait_ms) = 0;
 
+    /**
+     * @brief Send a message to the back of the queue, with a timeout in microseconds
+     *
+     * @param message Message to send. Must be of size messageSize specified during queue creation.
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if the message was sent, false if the timeout was reached
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     */
+    virtual bool sendToBackMicros(const void* message, const uint32_t maxTimeToWait_us)
+    {
+        return sendToBack(message, millisFromMicros(maxTimeToWait_us));
+    }
+
     /**
      * @brief Send a message to the back of the queue from an ISR
      *
@@ -90,16 +141,149 @@ public:
      * @param message Message to send. Must be of size messageSize specified during queue creation.
      * @param maxTimeToWait_ms Maximum time to wait in milliseconds
      * @return true if the message was sent, false if the timeout was reached
+     * @note Queues created with an AccessPattern may not support sending to the front, in which case false is
+     * returned immediately.
      */
     virtual bool sendToFront(const void* message, uint32_t maxTimeToWait_ms) = 0;
 
+    /**
+     * @brief Send a message to the front of the queue, with a timeout in microseconds
+     *
+     * @param message Message to send. Must be of size messageSize specified during queue creation.
+     * @param maxTimeToWait_us Maximum time to wait in microseconds
+     * @return true if the message was sent, false if the timeout was reached
+     * @note Unless overridden, the timeout is rounded up to whole milliseconds.
+     * @note Queues created with an AccessPattern may not support sending to the front, in which case false is
+     * returned immediately.
+     */
+    virtual bool sendToFrontMicros(const void* message, const uint32_t maxTimeToWait_us)
+    {
+        return sendToFront(message, millisFromMicros(maxTimeToWait_us));
+    }
+
     /**
      * @brief Send a message to the front of the queue from an ISR
      *
      * @param message Message to send. Must be of size messageSize specified during queue creation.
      * @return true if the message was sent, false otherwise
+     * @note Queues created with an AccessPattern may not support sending to the front, in which case false is
+     * returned immediately.
      */
     virtual bool sendToFrontFromISR(const void* message) = 0;
+
+    /**
+     * @brief Reserve the slot at the back of the queue so that a message can be written directly into the queue storage
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return void* Pointer to the messageSize bytes of the reserved slot, or nullptr if the timeout was reached
+     * @note The slot is suitably aligned for any type whose size is messageSize.
+     * @note The message only becomes visible to receivers once commitSend() is called. Every reserved slot MUST be
+     * committed, and receivers will not get past an uncommitted slot.
+     * @note On queues created with a single producer AccessPattern, only one slot can be reserved at a time.
+     */
+    virtual void* acquireSendSlot(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Publish a message written in place into a slot returned by acquireSendSlot()
+     *
+     * @param slot Slot returned by acquireSendSlot()
+     */
+    virtual void commitSend(void* slot) = 0;
+
+    /**
+     * @brief Take the message at the front of the queue so that it can be read directly from the queue storage
+     *
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return const void* Pointer to the messageSize bytes of the message, or nullptr if the timeout was reached
+     * @note The message is removed from the queue, but its slot is not reused until releaseReceive() is called. Every
+     * taken slot MUST be released.
+     * @note On queues created with a single consumer AccessPattern, only one slot can be taken at a time.
+     */
+    virtual const void* peekReceiveSlot(uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief Give back a slot returned by peekReceiveSlot() once the message has been consumed
+     *
+     * @param slot Slot returned by peekReceiveSlot()
+     */
+    virtual void releaseReceive(const void* slot) = 0;
+
+    /**
+     * @brief Send several messages to the back of the queue
+     *
+     * @param messages Array of count messages, each of size messageSize specified during queue creation
+     * @param count Number of messages to send
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for room for the first message
+     * @return uint32_t Number of messages sent, in order, from the start of the array. 0 if the timeout was reached.
+     * @note Once there is room for one message, as many messages as currently fit are sent at once without waiting
+     * any further. Receivers are woken up once per batch.
+     */
+    virtual uint32_t sendToBackN(const void* messages, uint32_t count, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `sendToBackN()` that can be called from an interrupt service routine
+     *
+     * @param messages Array of count messages, each of size messageSize specified during queue creation
+     * @param count Number of messages to send
+     * @return uint32_t Number of messages sent, in order, from the start of the array
+     */
+    virtual uint32_t sendToBackNFromISR(const void* messages, uint32_t count) = 0;
+
+    /**
+     * @brief Receive several messages from the queue
+     *
+     * @param messages Buffer for up to maxMessages messages, each of size messageSize specified during queue creation
+     * @param maxMessages Maximum number of messages to receive
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds for the first message
+     * @return uint32_t Number of messages received. 0 if the timeout was reached.
+     * @note Once one message is available, every message currently queued (up to maxMessages) is received at once
+     * without waiting any further. Senders are woken up once per batch.
+     */
+    virtual uint32_t receiveN(void* messages, uint32_t maxMessages, uint32_t maxTimeToWait_ms) = 0;
+
+    /**
+     * @brief A version of `receiveN()` that can be called from an interrupt service routine
+     *
+     * @param messages Buffer for up to maxMessages messages, each of size messageSize specified during queue creation
+     * @param maxMessages Maximum number of messages to receive
+     * @return uint32_t Number of messages received
+     */
+    virtual uint32_t receiveNFromISR(void* messages, uint32_t maxMessages) = 0;
+
+    /**
+     * @brief Receive every message currently in the queue, handing each one to a callback in place
+     *
+     * @param callback Function called, in order, for every drained message
+     * @param arg Argument to pass to the callback function
+     * @return uint32_t Number of messages drained
+     * @note This function never waits for messages. The callback must not call methods of this queue.
+     */
+    virtual uint32_t drain(OSInterfaceQueueDrainCallback callback, void* arg) = 0;
+
+    /**
+     * @brief A version of `drain()` that can be called from an interrupt service routine
+     *
+     * @param callback Function called, in order, for every drained message
+     * @param arg Argument to pass to the callback function
+     * @return uint32_t Number of messages drained
+     */
+    virtual uint32_t drainFromISR(OSInterfaceQueueDrainCallback callback, void* arg) = 0;
+
+    /**
+     * @brief Name the queue in the instrumentation reports
+     *
+     * @param name Name of the queue, must outlive it (string literal)
+     * @note Does nothing unless the implementation is instrumented (OSInterface_INSTRUMENTATION).
+     */
+    virtual void setName(const char* /*name*/)
+    {
+    }
+
+private:
+    static uint32_t millisFromMicros(const uint32_t us)
+    {
+        return us / 1000 + (us % 1000 != 0 ? 1 : 0);
+    }
 };
 
 #endif // OSINTERFACE_OSINTERFACE_UNTYPEDQUEUE_H
@@ -0,0 +1,86 @@
+#ifndef OSINTERFACE_OSINTERFACE_WAITSET_H
+#define OSINTERFACE_OSINTERFACE_WAITSET_H
+
+#include <cstdint>
+#include "OSInterface_BinarySemaphore.h"
+#include "OSInterface_Timer.h"
+#include "OSInterface_UntypedQueue.h"
+
+/**
+ * @brief Set of queues, semaphores and timers a single thread can wait on at once
+ *
+ * A queue is ready while it holds at least one message and a semaphore while it is signaled. wait() does not consume
+ * them, the caller receives the message (takes the semaphore) itself, usually with a timeout of 0. A timer is ready
+ * once it expired and is reported a single time per wait() that observes the expiration, however many periods elapsed.
+ *
+ * @note An object can be a member of a single wait set at a time, and it must be removed from the set (or the set
+ * deleted) before the object is deleted.
+ * @note Only objects created by the same OSInterface as the wait set can be added to it.
+ */
+class OSInterface_WaitSet
+{
+public:
+    virtual ~OSInterface_WaitSet() = default;
+
+    /**
+     * @brief Add a queue to the set
+     *
+     * @param queue Queue to add
+     * @return true if the queue was added, false if it already belongs to a wait set or is not supported
+     */
+    virtual bool add(OSInterface_UntypedQueue* queue) = 0;
+
+    /**
+     * @brief Add a binary semaphore to the set
+     *
+     * @param semaphore Semaphore to add
+     * @return true if the semaphore was added, false if it already belongs to a wait set or is not supported
+     */
+    virtual bool add(OSInterface_BinarySemaphore* semaphore) = 0;
+
+    /**
+     * @brief Add a timer to the set
+     *
+     * @param timer Timer to add
+     * @return true if the timer was added, false if it already belongs to a wait set or is not supported
+     * @note The timer callback is still invoked on every expiration.
+     */
+    virtual bool add(OSInterface_Timer* timer) = 0;
+
+    /**
+     * @brief Remove a queue from the set
+     *
+     * @param queue Queue to remove
+     * @return true if the queue was removed, false if it is not a member of the set
+     */
+    virtual bool remove(OSInterface_UntypedQueue* queue) = 0;
+
+    /**
+     * @brief Remove a binary semaphore from the set
+     *
+     * @param semaphore Semaphore to remove
+     * @return true if the semaphore was removed, false if it is not a member of the set
+     */
+    virtual bool remove(OSInterface_BinarySemaphore* semaphore) = 0;
+
+    /**
+     * @brief Remove a timer from the set
+     *
+     * @param timer Timer to remove
+     * @return true if the timer was removed, false if it is not a member of the set
+     */
+    virtual bool remove(OSInterface_Timer* timer) = 0;
+
+    /**
+     * @brief Wait until at least one member of the set is ready
+     *
+     * @param readyMembers Array filled with up to maxMembers ready members, as the pointers given to add()
+     * @param maxMembers Size of the readyMembers array
+     * @param maxTimeToWait_ms Maximum time to wait in milliseconds
+     * @return uint32_t Number of ready members written to readyMembers. 0 if the timeout was reached.
+     * @note When more members are ready than fit in the array, the following calls report the others first.
+     */
+    virtual uint32_t wait(const void** readyMembers, uint32_t maxMembers, uint32_t maxTimeToWait_ms) = 0;
+};
+
+#endif // OSINTERFACE_OSINTERFACE_WAITSET_H
@@ -0,0 +1,422 @@
+/**
+ * @file
+ * @brief Prints the records of a flight-recorder log file (see OSInterface_FlightRecord.h) as text
+ *
+ * Usage: OSInterface_LogDecoder <file>
+ *
+ * Each record is formatted with its format string and prefixed with its UTC wall-clock time. The file may be read
+ * while it is being recorded, or after the recording process crashed. It must be decoded on a host with the same
+ * byte order as the recording one.
+ */
+
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+#include "OSInterface_FlightRecord.h"
+
+/**
+ * @brief Argument of a record, with the value converted for each kind of printf conversion
+ */
+struct Argument
+{
+    bool        valid{true};
+    int64_t     signedValue{0};
+    uint64_t    unsignedValue{0};
+    long double floatValue{0};
+    const char* string{nullptr};
+};
+
+struct Message
+{
+    const char* format;
+    const char* signature;
+};
+
+static bool readFile(const char* path, std::vector<uint8_t>& contents)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    uint8_t buffer[64 * 1024];
+    size_t  count = 0;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) != 0)
+    {
+        contents.insert(contents.end(), buffer, buffer + count);
+    }
+    const bool failed = ferror(file) != 0;
+    fclose(file);
+    return !failed;
+}
+
+template <typename T> static T load(const uint8_t* position)
+{
+    T value;
+    memcpy(&value, position, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Decode the arguments of a record from its signature
+ *
+ * @return true if the arguments match the signature, false otherwise
+ */
+static bool decodeArguments(const OSInterface_FlightRecordFile& header, const char* signature, const uint8_t* data,
+                            const size_t size, std::vector<Argument>& arguments)
+{
+    size_t position = 0;
+    for (const char* code = signature; *code != '\0'; code++)
+    {
+        Argument argument;
+        size_t   length = 0;
+        switch (*code)
+        {
+            case 's':
+            {
+                const void* end = memchr(data + position, '\0', size - position);
+                if (end == nullptr)
+                {
+                    return false;
+                }
+                argument.string = reinterpret_cast<const char*>(data + position);
+                length          = static_cast<const uint8_t*>(end) - (data + position) + 1;
+                break;
+            }
+            case 'f':
+                length = sizeof(float);
+                break;
+            case 'd':
+                length = sizeof(double);
+                break;
+            case 'g':
+                length         = header.longDoubleSize;
+                argument.valid = header.longDoubleSize == sizeof(long double);
+                break;
+            case 'P':
+                length = header.pointerSize;
+                break;
+            case '?':
+            case 'b':
+            case 'B':
+                length = 1;
+                break;
+            case 'h':
+            case 'H':
+                length = 2;
+                break;
+            case 'i':
+            case 'I':
+                length = 4;
+                break;
+            case 'q':
+            case 'Q':
+                length = 8;
+                break;
+            default:
+                return false;
+        }
+        if (length > size - position || (length > sizeof(uint64_t) && *code != 's' && *code != 'g'))
+        {
+            return false;
+        }
+
+        const uint8_t* value = data + position;
+        if (*code == 'f')
+        {
+            argument.floatValue = load<float>(value);
+        }
+        else if (*code == 'd')
+        {
+            argument.floatValue = load<double>(value);
+        }
+        else if (*code == 'g' && argument.valid)
+        {
+            argument.floatValue = load<long double>(value);
+        }
+        else if (*code != 's' && *code != 'g')
+        {
+            uint64_t bits = 0;
+            memcpy(&bits, value, length); // Little-endian
+            const unsigned shift   = 64 - 8 * static_cast<unsigned>(length);
+            argument.unsignedValue = bits;
+            argument.signedValue   = static_cast<int64_t>(bits << shift) >> shift;
+        }
+        arguments.push_back(argument);
+        position += length;
+    }
+    return position == size;
+}
+
+// The formats come from the file, the conversions are checked against the arguments
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    #pragma GCC diagnostic ignored "-Wformat-security"
+#endif
+template <typename T>
+static void appendConversion(std::string& text, const std::string& spec, const int* stars, const int starCount,
+                             const T value)
+{
+    const auto print = [&](char* buffer, const size_t size)
+    {
+        switch (starCount)
+        {
+            case 0:
+                return snprintf(buffer, size, spec.c_str(), value);
+            case 1:
+                return snprintf(buffer, size, spec.c_str(), stars[0], value);
+            default:
+                return snprintf(buffer, size, spec.c_str(), stars[0], stars[1], value);
+        }
+    };
+    const int length = print(nullptr, 0);
+    if (length > 0)
+    {
+        const size_t offset = text.size();
+        text.resize(offset + static_cast<size_t>(length) + 1);
+        print(&text[offset], static_cast<size_t>(length) + 1);
+        text.resize(offset + static_cast<size_t>(length));
+    }
+}
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+/**
+ * @brief Format a record as printf would, the length modifiers of the format being replaced to match the arguments
+ */
+static std::string formatRecord(const char* format, const std::vector<Argument>& arguments)
+{
+    std::string text;
+    size_t      next = 0;
+    for (const char* c = format; *c != '\0'; c++)
+    {
+        if (*c != '%')
+        {
+            text += *c;
+            continue;
+        }
+        if (c[1] == '%')
+        {
+            text += '%';
+            c++;
+            continue;
+        }
+
+        std::string spec = "%";
+        int         stars[2];
+        int         starCount = 0;
+        c++;
+        while (*c != '\0' && strchr("-+ #0'", *c) != nullptr)
+        {
+            spec += *c++;
+        }
+        for (int field = 0; field < 2; field++)
+        {
+            if (field == 1)
+            {
+                if (*c != '.')
+                {
+                    break;
+                }
+                spec += *c++;
+            }
+            if (*c == '*')
+            {
+                const Argument* star = next < arguments.size() ? &arguments[next++] : nullptr;
+                stars[starCount++]   = star != nullptr ? static_cast<int>(star->signedValue) : 0;
+                spec += *c++;
+            }
+            while (isdigit(static_cast<unsigned char>(*c)))
+            {
+                spec += *c++;
+            }
+        }
+        while (*c != '\0' && strchr("hlLqjzt", *c) != nullptr)
+        {
+            c++;
+        }
+        if (*c == '\0')
+        {
+            break;
+        }
+
+        const char conversion = *c;
+        if (next == arguments.size() || !arguments[next].valid)
+        {
+            text += "<?>";
+            next += next < arguments.size() ? 1 : 0;
+            continue;
+        }
+        const Argument& argument = arguments[next++];
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+                appendConversion(text, spec + "ll" + conversion, stars, starCount,
+                                 static_cast<long long>(argument.signedValue));
+                break;
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                appendConversion(text, spec + "ll" + conversion, stars, starCount,
+                                 static_cast<unsigned long long>(argument.unsignedValue));
+                break;
+            case 'c':
+                appendConversion(text, spec + conversion, stars, starCount, static_cast<int>(argument.signedValue));
+                break;
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                appendConversion(text, spec + 'L' + conversion, stars, starCount, argument.floatValue);
+                break;
+            case 's':
+                appendConversion(text, spec + conversion, stars, starCount,
+                                 argument.string != nullptr ? argument.string : "<?>");
+                break;
+            case 'p':
+                appendConversion(text, spec + conversion, stars, starCount,
+                                 reinterpret_cast<const void*>(static_cast<uintptr_t>(argument.unsignedValue)));
+                break;
+            default:
+                text += spec + conversion;
+                break;
+        }
+    }
+    return text;
+}
+
+static void printTimestamp(const OSInterface_FlightRecordFile& header, const uint64_t timestamp_ns)
+{
+    const int64_t  elapsed = static_cast<int64_t>(timestamp_ns - header.startMonotonic_ns);
+    const uint64_t now     = header.startRealtime_ns + elapsed;
+    const time_t   seconds = static_cast<time_t>(now / 1000000000);
+    tm             utc{};
+    gmtime_r(&seconds, &utc);
+    char date[32];
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &utc);
+    printf("%s.%06" PRIu64 " ", date, now % 1000000000 / 1000);
+}
+
+int main(const int argc, const char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <file>\n", argv[0]);
+        return 2;
+    }
+    std::vector<uint8_t> contents;
+    if (!readFile(argv[1], contents))
+    {
+        fprintf(stderr, "Could not read '%s'\n", argv[1]);
+        return 1;
+    }
+
+    OSInterface_FlightRecordFile header{};
+    if (contents.size() < sizeof(header))
+    {
+        fprintf(stderr, "'%s' is not a flight-recorder file\n", argv[1]);
+        return 1;
+    }
+    memcpy(&header, contents.data(), sizeof(header));
+    if (memcmp(header.magic, OSInterface_FLIGHT_RECORD_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != OSInterface_FLIGHT_RECORD_VERSION || header.headerSize < sizeof(header) ||
+        contents.size() < static_cast<uint64_t>(header.headerSize) + header.stringTableSize + header.recordAreaSize ||
+        header.stringTableUsed > header.stringTableSize || header.recordAreaSize == 0 ||
+        header.head - header.tail > header.recordAreaSize)
+    {
+        fprintf(stderr, "'%s' is not a valid flight-recorder file\n", argv[1]);
+        return 1;
+    }
+    const uint8_t* strings = contents.data() + header.headerSize;
+    const uint8_t* records = strings + header.stringTableSize;
+
+    std::vector<const char*> tags;
+    std::vector<Message>     messages;
+    for (uint64_t position = 0; position + sizeof(OSInterface_FlightRecordString) <= header.stringTableUsed;)
+    {
+        const auto  entry = load<OSInterface_FlightRecordString>(strings + position);
+        const auto* bytes = reinterpret_cast<const char*>(strings + position + sizeof(entry));
+        position += sizeof(entry) + entry.length;
+        if (entry.length == 0 || position > header.stringTableUsed || bytes[entry.length - 1] != '\0')
+        {
+            fprintf(stderr, "Corrupted string table\n");
+            return 1;
+        }
+        if (entry.kind == OSInterface_FLIGHT_RECORD_TAG)
+        {
+            tags.push_back(bytes);
+        }
+        else if (entry.kind == OSInterface_FLIGHT_RECORD_MESSAGE)
+        {
+            const size_t formatLength = strlen(bytes) + 1;
+            messages.push_back({bytes, formatLength < entry.length ? bytes + formatLength : ""});
+        }
+    }
+
+    const uint32_t        area    = header.recordAreaSize;
+    uint64_t              corrupt = 0;
+    std::vector<Argument> arguments;
+    for (uint64_t position = header.tail; position < header.head;)
+    {
+        const uint64_t offset = position % area;
+        if (area - offset < sizeof(uint16_t) || load<uint16_t>(records + offset) == 0)
+        {
+            position += area - offset;
+            continue;
+        }
+        if (area - offset < sizeof(OSInterface_FlightRecordHeader))
+        {
+            corrupt++;
+            break;
+        }
+        const auto record = load<OSInterface_FlightRecordHeader>(records + offset);
+        if (record.size < sizeof(record) || record.size > area - offset)
+        {
+            corrupt++;
+            break;
+        }
+        position += record.size;
+
+        const uint8_t* data = records + offset + sizeof(record);
+        arguments.clear();
+        if (record.tag >= tags.size() || record.message >= messages.size())
+        {
+            corrupt++;
+            continue;
+        }
+        const Message& message = messages[record.message];
+        if (record.padding > record.size - sizeof(record) ||
+            !decodeArguments(header, message.signature, data, record.size - sizeof(record) - record.padding,
+                             arguments))
+        {
+            corrupt++;
+            continue;
+        }
+        arguments.insert(arguments.begin(), Argument{true, 0, 0, 0, tags[record.tag]});
+        printTimestamp(header, record.timestamp_ns);
+        fputs(formatRecord(message.format, arguments).c_str(), stdout);
+    }
+
+    if (header.droppedRecords != 0)
+    {
+        fprintf(stderr, "%" PRIu64 " records were dropped while recording\n", header.droppedRecords);
+    }
+    if (corrupt != 0)
+    {
+        fprintf(stderr, "%" PRIu64 " corrupted records were skipped\n", corrupt);
+    }
+    return 0;
+}